@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file oled_cjkfont.py
+@brief 生成 OLED_ShowText 使用的非ASCII(中文)字形表(主机端).
+
+字形表格式(见 dvc_oled_data.h 的 OLED_WideFont)：
+    Code[]   各字形的 Unicode 码点，按升序排列，显示时二分查找
+    Glyphs[] 各字形按页取模，每个字形先存第0页的各列，再存第1页的各列(纵向8点，高位在下)，
+             12像素高的字形第1页只用低4位
+
+字形来源：
+    --bdf 指定的 12 像素 BDF 点阵字库. 工程自带 Tools/fonts/arkui_cjk12.bdf(为本工程逐点画的12个菜单常用字
+    开关设置返回是否中文上下)，dvc_oled_data.c 中的 OLED_CJK12 由它 --all 生成；需要更多的字时换用
+    文泉驿点阵宋体(WenQuanYi Bitmap Song)12px，即 wqy-bitmapsong 中的 wenquanyi_9pt.bdf，并用 --chars 指定.
+    要取的字默认是源码(User/)字符串中用到的全部非ASCII字符(与 oled_fontsubset.py 的扫描相同)，
+    --all 取字库中的全部字形；字库里没有的字会列出，显示时按'?'处理.
+    生成结果替换 dvc_oled_data.c 中的 OLED_CJK12 定义，然后重新运行 oled_fontsubset.py --emit
+
+用法：
+    python oled_cjkfont.py --bdf wenquanyi_9pt.bdf                打印取到的字形预览与大小
+    python oled_cjkfont.py --bdf wenquanyi_9pt.bdf --emit         输出 OLED_CJK12 的C定义
+    python oled_cjkfont.py --bdf wenquanyi_9pt.bdf --chars 设置亮度 --emit
+    python oled_cjkfont.py --bdf fonts/arkui_cjk12.bdf --all --emit      工程中 OLED_CJK12 的生成命令
+    python oled_cjkfont.py --bdf fonts/arkui_cjk12.bdf --all --rows out.h
+                                                    把各字形的行位图写成C数组，供主机端测试 Tools/test/test_utf8
+                                                    与 OLED_CJK12 的显示逐像素对比
+"""
+
+import os
+import sys
+
+from oled_fontsubset import ROOT, scan
+
+NAME = 'CJK12'
+WIDTH = 12
+HEIGHT = 12
+
+def load_bdf(path, chars):
+    """从 BDF 点阵字库中取出 chars 中各字(chars 为 None 时取全部)的行位图，按 BBX 摆进 WIDTH x HEIGHT 字格，
+    返回 (字库名, {字: 行位图})"""
+    want = None if chars is None else {ord(c) for c in chars}
+    found = {}
+    with open(path, encoding='latin-1') as f:
+        lines = iter(f.read().splitlines())
+    ascent = HEIGHT
+    family, pixels = os.path.basename(path), None
+    for line in lines:
+        if line.startswith('FONT_ASCENT'):
+            ascent = int(line.split()[1])
+        elif line.startswith('FAMILY_NAME'):
+            family = line.split(None, 1)[1].strip().strip('"')
+        elif line.startswith('PIXEL_SIZE'):
+            pixels = int(line.split()[1])
+        if not line.startswith('STARTCHAR'):
+            continue
+        code, bbx, bitmap = None, None, []
+        for line in lines:
+            if line.startswith('ENCODING'):
+                code = int(line.split()[1])
+            elif line.startswith('BBX'):
+                bbx = [int(v) for v in line.split()[1:5]]
+            elif line.startswith('BITMAP'):
+                for line in lines:
+                    if line.startswith('ENDCHAR'):
+                        break
+                    bitmap.append(int(line, 16) << (32 - len(line) * 4))
+                break
+        if (want is not None and code not in want) or bbx is None:
+            continue
+        w, h, xoff, yoff = bbx
+        top = ascent - yoff - h
+        rows = [0] * HEIGHT
+        for r, bits in enumerate(bitmap):
+            y = top + r
+            if 0 <= y < HEIGHT:
+                rows[y] = (bits >> (32 - WIDTH + xoff)) & ((1 << WIDTH) - 1) if xoff >= WIDTH - 32 else 0
+        found[chr(code)] = rows
+    if pixels is not None:
+        family = '%s %dpx' % (family, pixels)
+    return family, found
+
+
+def pack(rows):
+    """行位图 -> 页取模字节：先第0页各列，再第1页各列"""
+    out = bytearray()
+    for page in range((HEIGHT + 7) // 8):
+        for col in range(WIDTH):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < HEIGHT and rows[y] >> (WIDTH - 1 - col) & 1:
+                    byte |= 1 << bit
+            out.append(byte)
+    return bytes(out)
+
+
+def collect(argv):
+    """按命令行参数得到 (要取的字, 字库名, {字: 行位图})"""
+    if '--chars' in argv:
+        chars = argv[argv.index('--chars') + 1]
+    elif '--all' in argv:
+        chars = None
+    else:
+        chars = ''.join(sorted(c for c in scan([os.path.join(ROOT, 'User')])[0] if ord(c) >= 0x80))
+    family, glyphs = load_bdf(argv[argv.index('--bdf') + 1], chars)
+    if chars is None:
+        chars = ''.join(sorted(glyphs, key=ord))
+    return chars, family, glyphs
+
+
+def emit(family, glyphs):
+    codes = sorted(glyphs, key=ord)
+    size = WIDTH * ((HEIGHT + 7) // 8)
+    out = ['/** ',
+           ' * @brief %dx%d中文字形(由 Tools/oled_cjkfont.py 从 %s 生成)，%d 字，字模 %d 字节 + 码点表 %d 字节'
+           % (WIDTH, HEIGHT, family, len(codes), len(codes) * size, len(codes) * 2),
+           ' */',
+           'extern const unsigned short OLED_%s_Code[] = {' % NAME]
+    out.append(','.join('0x%04X' % ord(c) for c in codes) or '0')
+    out.append('};')
+    out.append('extern const unsigned char OLED_%s_Glyph[][%d] = {' % (NAME, size))
+    for c in codes:
+        out.append('\t{%s},// %s' % (','.join('0x%02X' % b for b in pack(glyphs[c])), c))
+    if not codes:
+        out.append('\t{0}')
+    out.append('};')
+    out.append('extern const OLED_WideFont OLED_%s = {OLED_%s_Code, &OLED_%s_Glyph[0][0], %d, %d, %d};'
+               % (NAME, NAME, NAME, len(codes), WIDTH, HEIGHT))
+    return '\n'.join(out)
+
+
+def rows_header(family, glyphs):
+    """测试用：各字形的码点与行位图(每行一个整数，最高的 WIDTH 位中左边的像素在高位)，不经过 pack()"""
+    codes = sorted(glyphs, key=ord)
+    out = ['/* 由 Tools/oled_cjkfont.py --rows 从 %s 生成：各字形的码点与行位图 */' % family,
+           'static const unsigned short %sRowsCode[%d] = {%s};' % (NAME, len(codes) or 1, ','.join('0x%04X' % ord(c) for c in codes) or '0'),
+           'static const unsigned short %sRows[%d][%d] = {' % (NAME, len(codes) or 1, HEIGHT)]
+    for c in codes:
+        out.append('\t{%s},' % ','.join('0x%03X' % r for r in glyphs[c]))
+    if not codes:
+        out.append('\t{0}')
+    out.append('};')
+    out.append('#define %s_ROWS_COUNT %d' % (NAME, len(codes)))
+    return '\n'.join(out) + '\n'
+
+
+def main(argv):
+    if '--bdf' not in argv:
+        print(__doc__)
+        return 1
+    chars, family, glyphs = collect(argv)
+    missing = ''.join(c for c in chars if c not in glyphs)
+    if missing:
+        print('missing in %s: %s' % (family, missing), file=sys.stderr)
+    if '--emit' in argv:
+        print(emit(family, glyphs))
+        return 0
+    if '--rows' in argv:
+        with open(argv[argv.index('--rows') + 1], 'w', encoding='utf-8', newline='\n') as f:
+            f.write(rows_header(family, glyphs))
+        return 0
+
+    for c in sorted(glyphs, key=ord):
+        print('U+%04X %s' % (ord(c), c))
+        for r in glyphs[c]:
+            print('  ' + ''.join('#' if r >> (WIDTH - 1 - x) & 1 else '.' for x in range(WIDTH)))
+    print('%d glyphs, %d bytes' % (len(glyphs), len(glyphs) * (WIDTH * ((HEIGHT + 7) // 8) + 2)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
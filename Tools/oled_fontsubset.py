@@ -0,0 +1,311 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file oled_fontsubset.py
+@brief 按源码中实际用到的字符生成字库子集(主机端). 配合 dvc_oled_data.h 中的 OLED_USE_FONT_SUBSET 使用.
+
+步骤：
+    1. 扫描源码(默认 User/ 下全部 .c/.cpp/.h，菜单文字在 ArkUI/arkui_register.c)中的字符串与字符字面量，
+       按UTF-8解码；格式串中的转换说明(%d、%.2f 等)不计入，按其类型补上会输出的字符
+    2. 再加上数字与数值显示用到的符号(FORMAT_CHARS)，以及缺字时显示的'?'
+    3. 从 dvc_oled_data.c 的完整字库中取出这些字：
+       ASCII字体(OLED_F6x8/OLED_F8x16/OLED_FP8/OLED_FP16)只保留用到的字形，
+       另出一张95字节的 OLED_Subset_Map(字符序号 -> 字形序号，各字体共用)，查找仍是O(1)；
+       中文字形表 OLED_CJK12 只保留用到的字，码点表仍升序，二分查找
+    4. 输出 dvc_oled_font_subset.c，工程中加入该文件并把 OLED_USE_FONT_SUBSET 置1
+
+用法：
+    python oled_fontsubset.py                       打印字符集与各字库节省的字节数
+    python oled_fontsubset.py --emit                重新生成 dvc_oled_font_subset.c
+    python oled_fontsubset.py --emit a.c b.c        只扫描指定的源文件/目录
+    python oled_fontsubset.py --check               检查 dvc_oled_font_subset.c 是否与当前源码、字库一致，
+                                                    不一致(界面文字或字库改过而没有重新 --emit)时返回1，
+                                                    一致时打印各字库的字节数(与生成文件开头的表相同)
+    python oled_fontsubset.py --strings out.h       把扫描到的每个字符串按显示的样子写成C数组，
+                                                    供主机端测试 Tools/test/test_subset 用完整字库与子集分别显示对比
+
+Tools/test 的 make test 会先运行 --check，再运行 test_subset.
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+OLED_DIR = os.path.join(ROOT, 'User', '2_Device', 'SSD1317_9696_SPI_OLED')
+DATA_FILE = os.path.join(OLED_DIR, 'dvc_oled_data.c')
+OUT_FILE = os.path.join(OLED_DIR, 'dvc_oled_font_subset.c')
+SKIP_FILES = ('dvc_oled_data.c', 'dvc_oled_font_subset.c')
+
+FIRST_CHAR = 0x20
+CHAR_COUNT = 95
+FORMAT_CHARS = '0123456789+-. %?'                  # 数值显示(OLED_ShowFixedNum/%d/%f 等)与缺字替代
+CONV_CHARS = {'x': '0123456789abcdef', 'X': '0123456789ABCDEF',
+              'f': 'nanifov', 'F': 'nanifov'}      # %x/%X 的十六进制字母，%f 的 nan/inf/ovf
+
+# 名字: (字形数组, 偏移数组, 步进数组, 每字形字节数) ，偏移/步进为None表示等宽
+ASCII_FONTS = [
+    ('OLED_F8x16', None, None, 16),
+    ('OLED_F6x8', None, None, 6),
+    ('OLED_FP8_Glyph', 'OLED_FP8_Offset', 'OLED_FP8_Advance', None),
+    ('OLED_FP16_Glyph', 'OLED_FP16_Offset', 'OLED_FP16_Advance', None),
+]
+FORMAT_SPEC = re.compile(r'%[-+ 0#]*(?:\*|\d+)?(?:\.(?:\*|\d+))?(?:hh|h|ll|l)?([diucsxXfFk%])')
+
+
+def literals(text):
+    """返回源码中全部字符串/字符字面量的内容(已去掉注释，未处理转义)"""
+    out = []
+    i, n = 0, len(text)
+    while i < n:
+        c = text[i]
+        if text.startswith('//', i):
+            i = text.find('\n', i)
+            i = n if i < 0 else i
+        elif text.startswith('/*', i):
+            i = text.find('*/', i + 2)
+            i = n if i < 0 else i + 2
+        elif c in '"\'':
+            j = i + 1
+            while j < n and text[j] != c:
+                j += 2 if text[j] == '\\' else 1
+            out.append(text[i + 1:j])
+            i = j + 1
+        else:
+            i += 1
+    return out
+
+
+def unescape(body):
+    """处理C转义，返回按UTF-8解码后的字符串"""
+    raw = bytearray()
+    i = 0
+    data = body.encode('utf-8')
+    simple = {ord('n'): 10, ord('t'): 9, ord('r'): 13, ord('0'): 0, ord('\\'): 92,
+              ord('"'): 34, ord('\''): 39, ord('a'): 7, ord('b'): 8, ord('f'): 12, ord('v'): 11}
+    while i < len(data):
+        if data[i] == 0x5C and i + 1 < len(data):
+            m = re.match(rb'x([0-9a-fA-F]{1,2})|([0-7]{1,3})', data[i + 1:])
+            if m:
+                raw.append(int(m.group(1), 16) if m.group(1) else int(m.group(2), 8) & 0xFF)
+                i += 1 + m.end()
+                continue
+            raw.append(simple.get(data[i + 1], data[i + 1]))
+            i += 2
+        else:
+            raw.append(data[i])
+            i += 1
+    return raw.decode('utf-8', errors='replace')
+
+
+def shown_text(s):
+    """字面量显示出来可能有的字符：转换说明换成它会输出的字符"""
+    return FORMAT_SPEC.sub(lambda m: CONV_CHARS.get(m.group(1), '%' if m.group(1) == '%' else ''), s)
+
+
+def scan(paths, texts=None):
+    """扫描源码，返回 (用到的字符集合, 扫描的文件数)；texts 不为None时按顺序追加各字面量的 shown_text"""
+    files = []
+    for p in paths:
+        if os.path.isdir(p):
+            for d, _, names in os.walk(p):
+                files += [os.path.join(d, f) for f in names if f.endswith(('.c', '.cpp', '.h'))]
+        else:
+            files.append(p)
+    chars = set(FORMAT_CHARS)
+    for path in files:
+        if os.path.basename(path) in SKIP_FILES:
+            continue
+        with open(path, encoding='utf-8', errors='replace') as f:
+            text = re.sub(r'^\s*#\s*include.*$|extern\s+"C"', '', f.read(), flags=re.M)
+            for lit in literals(text):
+                s = shown_text(unescape(lit))
+                chars.update(s)
+                if texts is not None:
+                    texts.append(''.join(c for c in s if c >= ' ' and c != '\x7f'))
+    return {c for c in chars if c >= ' ' and c != '\x7f'}, len(files)
+
+
+def parse_tables(text):
+    """解析 const unsigned char/short 数组，返回 {名字: [数值]}"""
+    tables = {}
+    pattern = re.compile(r'const\s+unsigned\s+(?:char|short)\s+(\w+)\s*((?:\[[^\]]*\])+)\s*=\s*\{(.*?)\};', re.S)
+    for m in pattern.finditer(text):
+        body = re.sub(r'//[^\n]*|/\*.*?\*/', '', m.group(3), flags=re.S)
+        tables[m.group(1)] = [int(v, 0) for v in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body)]
+    return tables
+
+
+def c_array(decl, values, fmt, per_line):
+    lines = [decl + ' = {']
+    for k in range(0, len(values), per_line):
+        lines.append(','.join(fmt % v for v in values[k:k + per_line]) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    return lines
+
+
+def subset_ascii(tables, used):
+    """返回 (字形序号列表, Map, [(字体名, C定义行, 原字节数, 子集字节数)])"""
+    keep = [i for i in range(CHAR_COUNT) if chr(FIRST_CHAR + i) in used or i == 0]
+    fallback = keep.index(ord('?') - FIRST_CHAR)
+    remap = [keep.index(i) if i in keep else fallback for i in range(CHAR_COUNT)]
+    fonts = []
+    for glyph, offset, advance, size in ASCII_FONTS:
+        data = tables[glyph]
+        lines = []
+        if offset is None:
+            rows = [data[i * size:(i + 1) * size] for i in keep]
+            lines.append('extern const unsigned char %s[][%d] = ' % (glyph, size))
+            lines.append('{')
+            for i, r in zip(keep, rows):
+                lines.append('\t{%s},// %s' % (','.join('0x%02X' % b for b in r), chr(FIRST_CHAR + i)))
+            lines.append('};')
+            before, after = len(data), len(rows) * size
+        else:
+            offs, advs = tables[offset], tables[advance]
+            ends = offs[1:] + [len(data)]
+            new_data, new_offs = [], []
+            for i in keep:
+                new_offs.append(len(new_data))
+                new_data += data[offs[i]:ends[i]]
+            lines += c_array('extern const unsigned char %s[]' % glyph, new_data, '0x%02X', 16)
+            lines += c_array('extern const unsigned short %s[]' % offset, new_offs, '%d', 16)
+            lines += c_array('extern const unsigned char %s[]' % advance, [advs[i] for i in keep], '%d', 16)
+            before = len(data) + len(offs) * 3
+            after = len(new_data) + len(keep) * 3
+        fonts.append((glyph.replace('_Glyph', ''), lines, before, after))
+    return keep, remap, fonts
+
+
+def subset_cjk(tables, text, used):
+    count, width, height = [int(v) for v in re.search(
+        r'OLED_WideFont\s+OLED_CJK12\s*=\s*\{[^}]*?(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\}', text).groups()]
+    size = width * ((height + 7) // 8)
+    codes, glyphs = tables['OLED_CJK12_Code'][:count], tables['OLED_CJK12_Glyph'][:count * size]   # 空表只有占位的0
+    keep = [k for k, c in enumerate(codes) if chr(c) in used]
+    lines = c_array('extern const unsigned short OLED_CJK12_Code[]', [codes[k] for k in keep] or [0], '0x%04X', 16)
+    lines.append('extern const unsigned char OLED_CJK12_Glyph[][%d] = {' % size)
+    for k in keep:
+        lines.append('\t{%s},// %s' % (','.join('0x%02X' % b for b in glyphs[k * size:(k + 1) * size]), chr(codes[k])))
+    if not keep:
+        lines.append('\t{0}')
+    lines.append('};')
+    lines.append('extern const OLED_WideFont OLED_CJK12 = {OLED_CJK12_Code, &OLED_CJK12_Glyph[0][0], %d, %d, %d};'
+                 % (len(keep), width, height))
+    missing = sorted(c for c in used if ord(c) >= 0x80 and ord(c) not in codes)
+    return lines, len(codes) * (size + 2), len(keep) * (size + 2), missing
+
+
+def emit_strings(path, texts):
+    """把字符串写成C数组，非ASCII与引号、反斜杠用八进制转义"""
+    out = ['/* 由 Tools/oled_fontsubset.py --strings 生成：源码中各字符串显示的字符，第一条是 FORMAT_CHARS */',
+           'static const char *const SubsetStrings[] = {']
+    for t in sorted(set(texts + [FORMAT_CHARS]) - {''}, key=lambda t: (t != FORMAT_CHARS, t)):
+        body = ''.join(c if ' ' <= c < '\x7f' and c not in '"\\?' else
+                       ''.join('\\%03o' % b for b in c.encode('utf-8')) for c in t)
+        out.append('\t"%s",' % body)
+    out.append('};')
+    with open(path, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+def main(argv):
+    strings = argv[argv.index('--strings') + 1] if '--strings' in argv else None
+    args = [a for a in argv[1:] if not a.startswith('--') and a != strings]
+    texts = []
+    used, nfiles = scan(args or [os.path.join(ROOT, 'User')], texts)
+    if strings is not None:
+        emit_strings(strings, texts)
+        return 0
+    with open(DATA_FILE, encoding='utf-8') as f:
+        data_text = f.read()
+    tables = parse_tables(data_text)
+
+    keep, remap, fonts = subset_ascii(tables, used)
+    cjk_lines, cjk_before, cjk_after, missing = subset_cjk(tables, data_text, used)
+    ascii_used = ''.join(chr(FIRST_CHAR + i) for i in keep)
+    wide_used = ''.join(sorted(c for c in used if ord(c) >= 0x80))
+
+    report = ['%-18s %8s %8s %8s' % ('font', 'full', 'subset', 'saved')]
+    total_before = total_after = 0
+    for name, _, before, after in fonts + [('OLED_CJK12', None, cjk_before, cjk_after)]:
+        report.append('%-18s %8d %8d %8d' % (name, before, after, before - after))
+        total_before += before
+        total_after += after
+    report.append('%-18s %8s %8d %8s' % ('OLED_Subset_Map', '', CHAR_COUNT, ''))
+    total_after += CHAR_COUNT
+    report.append('%-18s %8d %8d %8d' % ('total', total_before, total_after, total_before - total_after))
+
+    if '--emit' not in argv and '--check' not in argv:
+        print('%d files, %d ASCII chars: %s' % (nfiles, len(keep), ascii_used))
+        print('%d wide chars: %s' % (len(wide_used), wide_used))
+        if missing:
+            print('missing in OLED_CJK12 (shown as ?): %s' % ''.join(missing))
+        print('\n'.join(report))
+        return 0
+
+    out = ['/**',
+           ' * @file dvc_oled_font_subset.c',
+           ' * @author Wang Fangzhuo (WeChat: ncasjifa)',
+           ' * @brief Ark OLED 字库子集(由 Tools/oled_fontsubset.py 从 dvc_oled_data.c 生成，请勿手改). 兼容 C/C++ 工程.',
+           ' * @note OLED_USE_FONT_SUBSET 为1时代替 dvc_oled_data.c 中的完整字库；界面文字改动后重新运行',
+           ' *       python Tools/oled_fontsubset.py --emit',
+           ' * @version 1.0',
+           ' * @copyright Wang Fangzhuo (c) 2026',
+           ' */',
+           '',
+           '/* Includes ------------------------------------------------------------------*/',
+           '#include "dvc_oled_data.h"',
+           '',
+           '#if OLED_USE_FONT_SUBSET',
+           '',
+           '/* Private variables ---------------------------------------------------------*/',
+           '',
+           '/**',
+           ' * @brief 用到的ASCII字符(%d个)：%s' % (len(keep), ascii_used.replace('*/', '* /').replace('/*', '/ *')),
+           ' *        用到的中文(%d个)：%s' % (len(wide_used), wide_used),
+           ' * @note 各字库字节数(完整 -> 子集)：']
+    out += [' *       ' + line for line in report]
+    out.append(' */')
+    out.append('')
+    out.append('/** ')
+    out.append(' * @brief 字符序号(Char - \' \')到子集字形序号的映射，各ASCII字体共用，没有的字映射到\'?\'')
+    out.append(' */')
+    out += c_array('extern const unsigned char OLED_Subset_Map[%d]' % CHAR_COUNT, remap, '%d', 19)
+    for name, lines, _, _ in fonts:
+        out.append('')
+        out += lines
+    out.append('')
+    out += cjk_lines
+    out += ['',
+            '/** ',
+            ' * @brief 字体描述，与 dvc_oled_data.c 中的相同，另加 OLED_Subset_Map',
+            ' */',
+            'extern const OLED_Font OLED_Font6x8  = {&OLED_F6x8[0][0],  0, 0, OLED_Subset_Map, \' \', 95, 6, 8, 0, &OLED_CJK12};',
+            'extern const OLED_Font OLED_Font8x16 = {&OLED_F8x16[0][0], 0, 0, OLED_Subset_Map, \' \', 95, 8, 16, 0, &OLED_CJK12};',
+            'extern const OLED_Font OLED_FontP8   = {OLED_FP8_Glyph,  OLED_FP8_Offset,  OLED_FP8_Advance,  OLED_Subset_Map, \' \', 95, 6, 8, 1, &OLED_CJK12};',
+            'extern const OLED_Font OLED_FontP16  = {OLED_FP16_Glyph, OLED_FP16_Offset, OLED_FP16_Advance, OLED_Subset_Map, \' \', 95, 8, 16, 1, &OLED_CJK12};',
+            '',
+            '#endif /* OLED_USE_FONT_SUBSET */',
+            '',
+            '/************************ COPYRIGHT(C) 2026 WANG FANGZHUO **************************/',
+            '']
+    if '--check' in argv:
+        with open(OUT_FILE, encoding='utf-8') as f:
+            stale = f.read() != '\n'.join(out)
+        if stale:
+            print('%s is stale: run python Tools/oled_fontsubset.py --emit' % os.path.relpath(OUT_FILE, ROOT))
+            if missing:
+                print('missing in OLED_CJK12 (shown as ?): %s' % ''.join(missing))
+            return 1
+        print('\n'.join(report))
+        return 0
+    with open(OUT_FILE, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out))
+    print('\n'.join(report))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
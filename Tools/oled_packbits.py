@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file oled_packbits.py
+@brief 页取模位图的 PackBits 压缩工具(主机端). 配合 dvc_arkoled.c 中的 OLED_ShowImagePacked 使用.
+
+压缩格式(与 Apple PackBits 相同，按取模顺序逐页逐列连续编码，跨页不断开)：
+    头字节 n = 0 ~ 127     : 后面跟 n+1 个原样字节
+    头字节 n = -1 ~ -127   : 后面跟 1 个字节，重复 1-n 次
+    头字节 n = -128        : 空操作(本工具不会生成)
+
+用法：
+    python oled_packbits.py dvc_oled_data.c                 打印各图像的压缩报告
+    python oled_packbits.py dvc_oled_data.c --emit Fonzo    输出 Fonzo_Packed[] 的C定义
+    python oled_packbits.py images.c --emit                 不写名字时输出文件中全部原始数组的压缩版本
+    python oled_packbits.py dvc_oled_data.c --unpack Fonzo  由 Fonzo_Packed[] 还原出原始取模数组(用于修改图像)
+"""
+
+import re
+import sys
+
+
+def parse_arrays(text):
+    """解析 C 源文件中的 const unsigned char 数组，返回 {名字: bytes}"""
+    arrays = {}
+    pattern = re.compile(r'const\s+unsigned\s+char\s+(\w+)\s*((?:\[[^\]]*\])+)\s*=\s*\{(.*?)\};', re.S)
+    for m in pattern.finditer(text):
+        body = re.sub(r'//[^\n]*|/\*.*?\*/', '', m.group(3), flags=re.S)
+        values = re.findall(r'0[xX][0-9a-fA-F]+|\d+', body)
+        arrays[m.group(1)] = bytes(int(v, 0) for v in values)
+    return arrays
+
+
+def pack(data):
+    """PackBits 编码：长度不小于 3 的重复串编为重复游程，其余编为原样游程"""
+    out = bytearray()
+    i, n = 0, len(data)
+    literal = bytearray()
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:128]
+
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            flush_literal()
+            out.append((1 - run) & 0xFF)
+            out.append(data[i])
+            i += run
+        else:
+            literal.extend(data[i:i + run])
+            i += run
+    flush_literal()
+    return bytes(out)
+
+
+def unpack(packed):
+    """解码整个压缩流，用于自检与还原原始数组"""
+    out = bytearray()
+    i = 0
+    while i < len(packed):
+        h = packed[i]
+        i += 1
+        if h < 128:
+            out.extend(packed[i:i + h + 1])
+            i += h + 1
+        elif h > 128:
+            out.extend(packed[i:i + 1] * (257 - h))
+            i += 1
+    return bytes(out)
+
+
+def emit_raw(name, data):
+    lines = ['extern const unsigned char %s[] = {' % name]
+    for k in range(0, len(data), 16):
+        lines.append(','.join('0x%02X' % b for b in data[k:k + 16]) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def emit(name, data):
+    packed = pack(data)
+    lines = ['/** ',
+             ' * @brief %s 的 PackBits 压缩版本(由 Tools/oled_packbits.py 生成)，原始 %d 字节，压缩后 %d 字节'
+             % (name, len(data), len(packed)),
+             ' */',
+             'extern const unsigned char %s_Packed[] = {' % name]
+    for k in range(0, len(packed), 16):
+        lines.append(','.join('0x%02X' % b for b in packed[k:k + 16]) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    with open(argv[1], encoding='utf-8') as f:
+        arrays = parse_arrays(f.read())
+
+    if len(argv) >= 3 and argv[2] == '--emit':
+        names = argv[3:] or [name for name in arrays if not name.endswith('_Packed')]
+        for name in names:
+            print(emit(name, arrays[name]))
+            print()
+        return 0
+
+    if len(argv) >= 4 and argv[2] == '--unpack':
+        for name in argv[3:]:
+            packed = arrays[name + '_Packed']
+            print(emit_raw(name, unpack(packed)))
+            print()
+        return 0
+
+    total_raw = total_packed = 0
+    print('%-16s %8s %8s %8s %7s' % ('asset', 'raw', 'packed', 'saved', 'ratio'))
+    for name, data in arrays.items():
+        if name.endswith('_Packed'):
+            continue
+        packed = pack(data)
+        assert unpack(packed) == data
+        total_raw += len(data)
+        total_packed += len(packed)
+        print('%-16s %8d %8d %8d %6.1f%%' % (name, len(data), len(packed),
+                                            len(data) - len(packed), 100.0 * len(packed) / len(data)))
+    print('%-16s %8d %8d %8d' % ('total', total_raw, total_packed, total_raw - total_packed))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file oled_propfont.py
+@brief 由等宽 ASCII 字库生成比例字体(主机端). 配合 dvc_arkoled.c 中的 OLED_ShowText / OLED_MeasureText 使用.
+
+生成方法：
+    每个字形去掉左右两侧的空列，只保存有笔画的列，右侧再留 1 列字间距(不存入字模)；
+    空格保留 FONT_SPACE 列宽；数字 0~9 保持原宽度(等宽数字)，数值右对齐、逐帧变化时不会左右跳动.
+字模格式与原字库相同(纵向8点，高位在下)，16像素高的字形先存上半页的各列，再存下半页的各列.
+
+用法：
+    python oled_propfont.py dvc_oled_data.c                 打印比例字体与原字库的宽度/大小对比
+    python oled_propfont.py dvc_oled_data.c --emit P8 P16   输出 OLED_FP8 / OLED_FP16 的C定义
+"""
+
+import re
+import sys
+
+from oled_packbits import parse_arrays
+
+# 名字: (源字库, 字宽, 字高, 空格宽度)
+FONTS = {
+    'P8':  ('OLED_F6x8', 6, 8, 3),
+    'P16': ('OLED_F8x16', 8, 16, 4),
+}
+FIRST_CHAR = 0x20
+SPACING = 1
+
+
+def split_glyphs(data, width, height):
+    """把原字库切成 [(上半页各列, 下半页各列), ...]"""
+    size = width * height // 8
+    glyphs = []
+    for k in range(0, len(data), size):
+        g = data[k:k + size]
+        pages = [g[p * width:(p + 1) * width] for p in range(height // 8)]
+        glyphs.append(pages)
+    return glyphs
+
+
+def trim(pages, code, width, space):
+    """去掉左右空列，返回保留的各页列数据"""
+    if chr(code) == ' ':
+        return [bytes(space - SPACING) for _ in pages]
+    cols = [any(p[i] for p in pages) for i in range(width)]
+    if not any(cols):
+        return [bytes(1) for _ in pages]
+    left = cols.index(True)
+    right = width - cols[::-1].index(True)
+    if chr(code).isdigit():
+        # 等宽数字：只去掉所有数字共有的左侧空列
+        left, right = 1 if width == 6 else 0, width - (0 if width == 6 else 1)
+    return [p[left:right] for p in pages]
+
+
+def build(name):
+    src, width, height, space = FONTS[name]
+    with open(sys.argv[1], encoding='utf-8') as f:
+        arrays = parse_arrays(f.read())
+    glyphs = split_glyphs(arrays[src], width, height)
+    data, offset, advance = bytearray(), [], []
+    for i, pages in enumerate(glyphs):
+        kept = trim(pages, FIRST_CHAR + i, width, space)
+        offset.append(len(data))
+        for p in kept:
+            data.extend(p)
+        advance.append(len(kept[0]) + SPACING)
+    return src, width, height, data, offset, advance
+
+
+def emit_bytes(decl, values, fmt, per_line):
+    lines = [decl + ' = {']
+    for k in range(0, len(values), per_line):
+        lines.append(','.join(fmt % v for v in values[k:k + per_line]) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def emit(name):
+    src, width, height, data, offset, advance = build(name)
+    count = len(offset)
+    return '\n'.join([
+        '/** ',
+        ' * @brief %d像素高比例字体(由 Tools/oled_propfont.py 从 %s 生成)，字模 %d 字节 + 偏移/步进表 %d 字节'
+        % (height, src, len(data), count * 3),
+        ' */',
+        emit_bytes('extern const unsigned char OLED_F%s_Glyph[]' % name, data, '0x%02X', 16),
+        emit_bytes('extern const unsigned short OLED_F%s_Offset[]' % name, offset, '%d', 16),
+        emit_bytes('extern const unsigned char OLED_F%s_Advance[]' % name, advance, '%d', 16),
+        '',
+    ])
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+
+    if len(argv) >= 4 and argv[2] == '--emit':
+        for name in argv[3:]:
+            print(emit(name))
+        return 0
+
+    print('%-6s %10s %12s %10s %10s' % ('font', 'src bytes', 'prop bytes', 'avg adv', 'chars/96px'))
+    for name in FONTS:
+        src, width, height, data, offset, advance = build(name)
+        printable = [a for i, a in enumerate(advance) if chr(FIRST_CHAR + i).isalpha()]
+        avg = sum(printable) / len(printable)
+        print('%-6s %10d %12d %10.2f %5.1f vs %.1f' % (name, len(offset) * width * height // 8,
+                                                      len(data) + len(offset) * 3, avg, 96 / avg, 96 / width))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,91 @@
+/**
+ * @file harness.h
+ * @brief 主机测试的公共工具：随机数、显存逐像素读写、计时与失败计数
+ */
+
+#ifndef TEST_HARNESS_H
+#define TEST_HARNESS_H
+
+#include "dvc_arkoled.h"
+#include "panel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+extern uint8_t OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+
+typedef uint8_t Frame[OLED_PAGES][OLED_WIDTH];
+
+static long test_failures = 0;
+
+/*条件不成立时计一次失败，只打印前10条*/
+#define EXPECT(Cond, ...)                                                       \
+    do {                                                                        \
+        if (!(Cond) && test_failures++ < 10)                                    \
+        {                                                                       \
+            printf("  FAIL %s:%d: ", __FILE__, __LINE__);                       \
+            printf(__VA_ARGS__);                                                \
+            printf("\n");                                                       \
+        }                                                                       \
+    } while (0)
+
+/*[a, b] 内的随机整数*/
+static inline int Rand(int a, int b)
+{
+    return a + rand() % (b - a + 1);
+}
+
+static inline int FramePixel(const Frame f, int x, int y)
+{
+    return (f[y >> 3][x] >> (y & 7)) & 1;
+}
+
+static inline void FrameSetPixel(Frame f, int x, int y, int v)
+{
+    if (v) f[y >> 3][x] |= (uint8_t)(1 << (y & 7));
+    else   f[y >> 3][x] &= (uint8_t)~(1 << (y & 7));
+}
+
+static inline void FrameRandom(Frame f)
+{
+    for (int p = 0; p < OLED_PAGES; p++)
+        for (int x = 0; x < OLED_WIDTH; x++) f[p][x] = (uint8_t)rand();
+}
+
+/*第一个不同的像素，相同返回0*/
+static inline int FrameDiff(const Frame a, const Frame b, int *x, int *y)
+{
+    for (int yy = 0; yy < OLED_HEIGHT; yy++)
+        for (int xx = 0; xx < OLED_WIDTH; xx++)
+            if (FramePixel(a, xx, yy) != FramePixel(b, xx, yy)) { *x = xx; *y = yy; return 1; }
+    return 0;
+}
+
+static inline double NowUs(void)
+{
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+/*让编译器认为显存被读过，计时循环不会被优化掉*/
+static inline void Touch(const void *p)
+{
+    asm volatile("" : : "r"(p) : "memory");
+}
+
+/*命令行带 bench 时除了正确性测试还跑性能测试*/
+static inline int WantBench(int argc, char **argv)
+{
+    return argc > 1 && strcmp(argv[1], "bench") == 0;
+}
+
+/*打印结果，返回进程退出码*/
+static inline int TestReport(const char *name)
+{
+    printf("%-14s %s (%ld failures)\n", name, test_failures ? "FAILED" : "ok", test_failures);
+    return test_failures != 0;
+}
+
+#endif
@@ -0,0 +1,11 @@
+/**
+ * @file delay.cpp
+ * @brief 主机测试用的延时库桩：不真的等待，立即返回(ArkUI 的开机画面、过渡动画里用到)
+ */
+
+#include "delay.h"
+
+void Delay_Init(uint32_t hclk_hz) { (void)hclk_hz; }
+void Delay_us(uint32_t us) { (void)us; }
+void Delay_ms(uint32_t ms) { (void)ms; }
+void Delay_s(uint32_t s) { (void)s; }
@@ -0,0 +1,222 @@
+/**
+ * @file panel.cpp
+ * @brief 主机测试用的SSD1317屏幕模型与GPIO桩
+ * @note 软件SPI：在CS为低时按D0(SCK)上升沿采样D1(MOSI)，MSB在前，每8位按DC电平作为命令或数据.
+ *       一个CS窗口内DC只允许 命令* 数据* 命令* 的顺序(整帧突发传输的 命令头 + 数据 + 命令尾)，
+ *       其它顺序、CS为高时的时钟、不完整的字节都计入 framingErrors.
+ *       硬件SPI：SPI2数据寄存器的写入立即作为一个字节；DMA1通道5的传输由测试程序调用 panel_dma_run 推进，
+ *       搬完时置传输完成标志并像中断一样调用 OLED_DMA_IRQHandler
+ */
+
+#include "stm32f10x.h"
+#include "panel.h"
+#include "dvc_arkoled.h"
+#include <stdint.h>
+#include <string.h>
+
+/*与 dvc_arkoled.c 的接线一致*/
+#define PIN_CS      GPIO_Pin_8      // PA8
+#if OLED_USE_HW_SPI_DMA
+#define PIN_DC      GPIO_Pin_12     // PB12，SCK/MOSI由SPI外设模型直接给出字节
+#define PIN_SCK     0
+#define PIN_MOSI    0
+#else
+#define PIN_DC      GPIO_Pin_15     // PB15
+#define PIN_SCK     GPIO_Pin_12     // PB12
+#define PIN_MOSI    GPIO_Pin_13     // PB13
+#endif
+
+GPIO_TypeDef stubGPIOA = {0, 0, 0, 0, {0}, {0}, 0};
+GPIO_TypeDef stubGPIOB = {0, 0, 0, 0, {1}, {1}, 0};
+Panel panel;
+
+static int cs = 1, dc = 0, sck = 0, mosi = 0;
+static int bits = 0;
+static uint8_t shift = 0;
+static int dcPhase = 0;                 // 当前CS窗口的DC阶段：0 命令头，1 数据，2 命令尾
+static int argLeft = 0, argCount = 0;
+static uint8_t argCmd = 0, args[4];
+
+static int CommandArgs(uint8_t c)
+{
+    switch (c)
+    {
+        case 0x81: case 0xD5: case 0xA8: case 0xD3: case 0xDA:
+        case 0xD9: case 0xDB: case 0x8D: case 0x20: case 0xAD:
+            return 1;
+        case 0x21: case 0x22:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+static void Command(uint8_t c)
+{
+    panel.cmdBytes++;
+    if (argLeft)
+    {
+        args[argCount++] = c;
+        if (--argLeft) return;
+        switch (argCmd)
+        {
+            case 0x81: panel.contrast = args[0]; break;
+            case 0x20: panel.addrMode = args[0] & 3; break;
+            case 0x21: panel.c0 = args[0] & 0x7F; panel.c1 = args[1] & 0x7F; panel.col = panel.c0; break;
+            case 0x22: panel.p0 = args[0] & 0x0F; panel.p1 = args[1] & 0x0F; panel.page = panel.p0; break;
+            case 0xD3: panel.offset = args[0] & 0x7F; break;
+        }
+        return;
+    }
+    if (CommandArgs(c)) { argLeft = CommandArgs(c); argCount = 0; argCmd = c; return; }
+    if (c >= 0xB0 && c <= 0xBF) panel.page = c & 0x0F;
+    else if (c >= 0x10 && c <= 0x17) panel.col = (panel.col & 0x0F) | ((c & 0x07) << 4);
+    else if (c <= 0x0F) panel.col = (panel.col & 0x70) | c;
+    else if (c >= 0x40 && c <= 0x7F) panel.startLine = c & 0x3F;
+    else if (c == 0xA6 || c == 0xA7) panel.inverted = c & 1;
+    else if (c == 0xAE || c == 0xAF) panel.on = c & 1;
+}
+
+static void Data(uint8_t d)
+{
+    panel.dataBytes++;
+    panel.gddram[panel.page][panel.col] = d;
+    if (panel.addrMode == 0)
+    {
+        if (panel.col < panel.c1) { panel.col++; return; }
+        panel.col = panel.c0;
+        panel.page = (panel.page < panel.p1) ? panel.page + 1 : panel.p0;
+    }
+    else if (panel.col < PANEL_COLS - 1)
+    {
+        panel.col++;
+    }
+}
+
+extern "C" void panel_byte(int Dc, uint8_t Byte)
+{
+    if (cs) { panel.framingErrors++; return; }
+    if (Dc) { if (dcPhase == 2) panel.framingErrors++; dcPhase = 1; Data(Byte); }
+    else    { if (dcPhase == 1) dcPhase = 2; Command(Byte); }
+}
+
+extern "C" void panel_cs(int Level)
+{
+    if (Level == cs) return;
+    if (Level)
+    {
+        if (bits) panel.framingErrors++;
+        panel.csFrames++;
+    }
+    cs = Level;
+    bits = 0;
+    dcPhase = 0;
+}
+
+extern "C" void stub_gpio_write(int Port, uint16_t Pins, int Level)
+{
+    if (Port == 0)
+    {
+        if (Pins & PIN_CS) panel_cs(Level);
+        return;
+    }
+    if (Pins & PIN_DC)
+    {
+        if (bits && Level != dc) panel.framingErrors++;
+        dc = Level;
+    }
+    if (Pins & PIN_MOSI) mosi = Level;
+    if (Pins & PIN_SCK)
+    {
+        if (Level && !sck)
+        {
+            if (cs) panel.framingErrors++;
+            else
+            {
+                shift = (uint8_t)((shift << 1) | mosi);
+                if (++bits == 8) { bits = 0; panel_byte(dc, shift); }
+            }
+        }
+        sck = Level;
+    }
+}
+
+/*------------------------SPI2 + DMA1通道5 外设模型------------------------*/
+
+SPI_TypeDef stubSPI2;
+DMA_Channel_TypeDef stubDMA1_Channel5;
+volatile uint32_t stubDMA1_ISR;
+int panel_in_isr = 0;
+
+static const uint8_t *dmaSrc = NULL;    // DMA使能时从CMAR取出的源地址
+
+/*CPU写DR：字节立即按当前DC电平移出；DMA还有数据没搬完时写DR会和DMA的字节交错*/
+extern "C" void SPI_I2S_SendData(SPI_TypeDef *SPIx, uint16_t Data)
+{
+    (void)SPIx;
+    if ((DMA1_Channel5->CCR & DMA_CCR_EN) && DMA1_Channel5->CNDTR) panel.framingErrors++;
+    panel_byte(dc, (uint8_t)Data);
+}
+
+extern "C" void DMA_Cmd(DMA_Channel_TypeDef *Channel, FunctionalState State)
+{
+    if (!State) { Channel->CCR &= ~DMA_CCR_EN; return; }
+    Channel->CCR |= DMA_CCR_EN;
+    dmaSrc = (const uint8_t *)(uintptr_t)Channel->CMAR;
+    if (Channel->CPAR != (uint32_t)(uintptr_t)&SPI2->DR) panel.framingErrors++;
+}
+
+extern "C" int panel_dma_run(int MaxBytes)
+{
+    DMA_Channel_TypeDef *ch = DMA1_Channel5;
+    int n = 0;
+
+    if (!(ch->CCR & DMA_CCR_EN) || ch->CNDTR == 0) return 0;
+    while (n < MaxBytes && ch->CNDTR)
+    {
+        panel_byte(dc, *dmaSrc++);
+        ch->CNDTR--;
+        n++;
+    }
+    if (ch->CNDTR == 0)
+    {
+        stubDMA1_ISR |= DMA1_IT_TC5;
+#if OLED_USE_HW_SPI_DMA
+        if (ch->CCR & DMA_IT_TC)
+        {
+            panel_in_isr = 1;
+            OLED_DMA_IRQHandler();
+            panel_in_isr = 0;
+        }
+#endif
+    }
+    return n;
+}
+
+extern "C" void panel_reset_counters(void)
+{
+    panel.cmdBytes = panel.dataBytes = panel.csFrames = panel.framingErrors = 0;
+}
+
+extern "C" void panel_reset(void)
+{
+    panel.page = panel.col = 0;
+    panel.addrMode = 2;
+    panel.c0 = 0; panel.c1 = PANEL_COLS - 1;
+    panel.p0 = 0; panel.p1 = PANEL_PAGES - 1;
+    panel.startLine = panel.offset = 0;
+    panel.contrast = 0x7F; panel.inverted = 0; panel.on = 0;
+    argLeft = 0;
+    panel_reset_counters();
+}
+
+extern "C" void panel_fill(uint8_t Fill)
+{
+    memset(panel.gddram, Fill, sizeof(panel.gddram));
+}
+
+extern "C" int panel_pixel(int X, int Y)
+{
+    int row = (panel.startLine + panel.offset + Y) & (PANEL_PAGES * 8 - 1);
+    return (panel.gddram[row >> 3][X + PANEL_COL_OFFSET] >> (row & 7)) & 1;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file panel.h
+ * @brief 主机测试用的SSD1317屏幕模型：按引脚电平(或SPI数据寄存器)收字节，执行命令、写GDDRAM
+ * @note 只实现驱动用到的命令：页/水平寻址、列/页窗口、起始行、对比度、反色、开关屏
+ */
+
+#ifndef TEST_PANEL_H
+#define TEST_PANEL_H
+
+#include <stdint.h>
+
+/*GDDRAM 128列 x 16页(128行)；屏幕显示第16~111列、从起始行开始的96行*/
+#define PANEL_COLS          (128)
+#define PANEL_PAGES         (16)
+#define PANEL_COL_OFFSET    (16)
+
+typedef struct {
+    uint8_t gddram[PANEL_PAGES][PANEL_COLS];
+    int page, col;              // 当前写入地址
+    int addrMode;               // 0：水平寻址，2：页寻址
+    int c0, c1, p0, p1;         // 水平寻址的列/页窗口
+    int startLine;              // 显示起始行寄存器(0x40|line，6位)
+    int offset;                 // 显示偏移(0xD3)
+    int contrast, inverted, on;
+    long cmdBytes, dataBytes;   // 收到的命令/数据字节数
+    long csFrames;              // CS窗口数(CS拉低又拉高一次)
+    long framingErrors;         // CS为高时的时钟、CS窗口内不完整的字节、字节中途DC变化
+} Panel;
+
+extern Panel panel;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void panel_reset(void);             // 寄存器复位为上电值、计数清零(GDDRAM不变)
+void panel_reset_counters(void);
+void panel_fill(uint8_t Fill);      // GDDRAM全部填成 Fill(模拟上电后的未知内容)
+int  panel_pixel(int X, int Y);     // 屏幕坐标(X, Y)上显示的像素(按起始行/偏移映射，不含反色)
+void panel_byte(int Dc, uint8_t Byte);  // 收到一个完整字节(供SPI外设模型调用)
+void panel_cs(int Level);           // CS电平变化(供SPI外设模型调用)
+int  panel_dma_run(int MaxBytes);   // DMA最多再搬 MaxBytes 个字节，搬完时调用 OLED_DMA_IRQHandler；返回搬的字节数
+extern int panel_in_isr;            // 1：正在(模拟的)DMA完成中断里
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,178 @@
+/**
+ * @file stm32f10x.h
+ * @brief 主机测试用的 stm32f10x.h 桩：只提供驱动与ArkUI用到的SPL类型、常量和函数
+ * @note 测试程序按C++编译，GPIO的BSRR/BRR写入被转发给 stub_gpio_write，
+ *       由 panel.cpp 中的屏幕模型按引脚电平解码SPI；SPI2/DMA1通道5由同一文件中的外设模型执行
+ */
+
+#ifndef STM32F10X_STUB_H
+#define STM32F10X_STUB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" void stub_gpio_write(int Port, uint16_t Pins, int Level);
+
+/*GPIO置位/复位寄存器：写入时把引脚变化告诉屏幕模型*/
+struct StubBSRR {
+    int Port;
+    void operator=(uint32_t v)
+    {
+        if (v & 0xFFFF) stub_gpio_write(Port, (uint16_t)(v & 0xFFFF), 1);
+        if (v >> 16)    stub_gpio_write(Port, (uint16_t)(v >> 16), 0);
+    }
+};
+struct StubBRR {
+    int Port;
+    void operator=(uint32_t v) { if (v & 0xFFFF) stub_gpio_write(Port, (uint16_t)v, 0); }
+};
+
+typedef struct {
+    volatile uint32_t CRL, CRH, IDR, ODR;
+    StubBSRR BSRR;
+    StubBRR BRR;
+    volatile uint32_t LCKR;
+} GPIO_TypeDef;
+#else
+/*按C编译时(make check-c)只做语法检查，寄存器写入不转发*/
+void stub_gpio_write(int Port, uint16_t Pins, int Level);
+
+typedef struct {
+    volatile uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR;
+} GPIO_TypeDef;
+#endif
+
+extern GPIO_TypeDef stubGPIOA, stubGPIOB;
+#define GPIOA (&stubGPIOA)
+#define GPIOB (&stubGPIOB)
+
+typedef enum { Bit_RESET = 0, Bit_SET } BitAction;
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+
+#define GPIO_Pin_0  ((uint16_t)0x0001)
+#define GPIO_Pin_1  ((uint16_t)0x0002)
+#define GPIO_Pin_7  ((uint16_t)0x0080)
+#define GPIO_Pin_8  ((uint16_t)0x0100)
+#define GPIO_Pin_12 ((uint16_t)0x1000)
+#define GPIO_Pin_13 ((uint16_t)0x2000)
+#define GPIO_Pin_14 ((uint16_t)0x4000)
+#define GPIO_Pin_15 ((uint16_t)0x8000)
+
+typedef enum { GPIO_Mode_IPU = 0x48, GPIO_Mode_Out_PP = 0x10, GPIO_Mode_AF_PP = 0x18 } GPIOMode_TypeDef;
+typedef enum { GPIO_Speed_50MHz = 3 } GPIOSpeed_TypeDef;
+typedef struct {
+    uint16_t GPIO_Pin;
+    GPIOSpeed_TypeDef GPIO_Speed;
+    GPIOMode_TypeDef GPIO_Mode;
+} GPIO_InitTypeDef;
+
+#define RCC_APB2Periph_GPIOA ((uint32_t)0x00000004)
+#define RCC_APB2Periph_GPIOB ((uint32_t)0x00000008)
+
+static inline void GPIO_WriteBit(GPIO_TypeDef *GPIOx, uint16_t Pin, BitAction Val)
+{
+    stub_gpio_write(GPIOx == GPIOA ? 0 : 1, Pin, Val != Bit_RESET);
+}
+static inline uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef *GPIOx, uint16_t Pin) { (void)GPIOx; (void)Pin; return 1; }
+static inline void GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *Init) { (void)GPIOx; (void)Init; }
+static inline void RCC_APB2PeriphClockCmd(uint32_t Periph, FunctionalState State) { (void)Periph; (void)State; }
+
+/*------------------------SPI2 + DMA1通道5(OLED_USE_HW_SPI_DMA)------------------------*/
+/*数据寄存器写入与DMA传输由 panel.cpp 中的外设模型执行；DMA地址寄存器只有32位，
+  所以测试程序按 -no-pie 链接，静态变量的地址都在低4G*/
+
+typedef struct { volatile uint32_t CR1, CR2, SR, DR; } SPI_TypeDef;
+typedef struct { volatile uint32_t CCR, CNDTR, CPAR, CMAR; } DMA_Channel_TypeDef;
+
+extern SPI_TypeDef stubSPI2;
+extern DMA_Channel_TypeDef stubDMA1_Channel5;
+extern volatile uint32_t stubDMA1_ISR;
+#define SPI2            (&stubSPI2)
+#define DMA1_Channel5   (&stubDMA1_Channel5)
+
+#define RCC_APB1Periph_SPI2         ((uint32_t)0x00004000)
+#define RCC_AHBPeriph_DMA1          ((uint32_t)0x00000001)
+
+#define SPI_Direction_1Line_Tx      ((uint16_t)0xC000)
+#define SPI_Mode_Master             ((uint16_t)0x0104)
+#define SPI_DataSize_8b             ((uint16_t)0x0000)
+#define SPI_CPOL_Low                ((uint16_t)0x0000)
+#define SPI_CPHA_1Edge              ((uint16_t)0x0000)
+#define SPI_NSS_Soft                ((uint16_t)0x0200)
+#define SPI_BaudRatePrescaler_4     ((uint16_t)0x0008)
+#define SPI_FirstBit_MSB            ((uint16_t)0x0000)
+#define SPI_I2S_DMAReq_Tx           ((uint16_t)0x0002)
+#define SPI_I2S_FLAG_TXE            ((uint16_t)0x0002)
+#define SPI_I2S_FLAG_BSY            ((uint16_t)0x0080)
+
+typedef struct {
+    uint16_t SPI_Direction, SPI_Mode, SPI_DataSize, SPI_CPOL, SPI_CPHA, SPI_NSS;
+    uint16_t SPI_BaudRatePrescaler, SPI_FirstBit, SPI_CRCPolynomial;
+} SPI_InitTypeDef;
+
+#define DMA_CCR_EN                  ((uint32_t)0x00000001)
+#define DMA_IT_TC                   ((uint32_t)0x00000002)
+#define DMA1_IT_TC5                 ((uint32_t)0x00020000)
+#define DMA_DIR_PeripheralDST       ((uint32_t)0x00000010)
+#define DMA_PeripheralInc_Disable   ((uint32_t)0x00000000)
+#define DMA_MemoryInc_Enable        ((uint32_t)0x00000080)
+#define DMA_PeripheralDataSize_Byte ((uint32_t)0x00000000)
+#define DMA_MemoryDataSize_Byte     ((uint32_t)0x00000000)
+#define DMA_Mode_Normal             ((uint32_t)0x00000000)
+#define DMA_Priority_Medium         ((uint32_t)0x00001000)
+#define DMA_M2M_Disable             ((uint32_t)0x00000000)
+
+typedef struct {
+    uint32_t DMA_PeripheralBaseAddr, DMA_MemoryBaseAddr, DMA_DIR, DMA_BufferSize;
+    uint32_t DMA_PeripheralInc, DMA_MemoryInc, DMA_PeripheralDataSize, DMA_MemoryDataSize;
+    uint32_t DMA_Mode, DMA_Priority, DMA_M2M;
+} DMA_InitTypeDef;
+
+#define DMA1_Channel5_IRQn          (15)
+typedef struct {
+    uint8_t NVIC_IRQChannel, NVIC_IRQChannelPreemptionPriority, NVIC_IRQChannelSubPriority;
+    FunctionalState NVIC_IRQChannelCmd;
+} NVIC_InitTypeDef;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void SPI_I2S_SendData(SPI_TypeDef *SPIx, uint16_t Data);
+void DMA_Cmd(DMA_Channel_TypeDef *Channel, FunctionalState State);
+#ifdef __cplusplus
+}
+#endif
+
+/*模型里字节写入DR即移出：TXE恒为1，BSY恒为0*/
+static inline FlagStatus SPI_I2S_GetFlagStatus(SPI_TypeDef *SPIx, uint16_t Flag)
+{
+    (void)SPIx;
+    return (Flag == SPI_I2S_FLAG_TXE) ? SET : RESET;
+}
+static inline void SPI_Init(SPI_TypeDef *SPIx, SPI_InitTypeDef *Init) { (void)SPIx; (void)Init; }
+static inline void SPI_Cmd(SPI_TypeDef *SPIx, FunctionalState State) { (void)SPIx; (void)State; }
+static inline void SPI_I2S_DMACmd(SPI_TypeDef *SPIx, uint16_t Req, FunctionalState State) { (void)SPIx; (void)Req; (void)State; }
+
+static inline void DMA_DeInit(DMA_Channel_TypeDef *Channel)
+{
+    Channel->CCR = Channel->CNDTR = Channel->CPAR = Channel->CMAR = 0;
+}
+static inline void DMA_Init(DMA_Channel_TypeDef *Channel, DMA_InitTypeDef *Init)
+{
+    Channel->CPAR  = Init->DMA_PeripheralBaseAddr;
+    Channel->CMAR  = Init->DMA_MemoryBaseAddr;
+    Channel->CNDTR = Init->DMA_BufferSize;
+}
+static inline void DMA_ITConfig(DMA_Channel_TypeDef *Channel, uint32_t It, FunctionalState State)
+{
+    if (State) Channel->CCR |= It; else Channel->CCR &= ~It;
+}
+static inline void DMA_SetCurrDataCounter(DMA_Channel_TypeDef *Channel, uint16_t Count) { Channel->CNDTR = Count; }
+static inline ITStatus DMA_GetITStatus(uint32_t It) { return (stubDMA1_ISR & It) ? SET : RESET; }
+static inline void DMA_ClearITPendingBit(uint32_t It) { stubDMA1_ISR &= ~It; }
+static inline void NVIC_Init(NVIC_InitTypeDef *Init) { (void)Init; }
+static inline void RCC_APB1PeriphClockCmd(uint32_t Periph, FunctionalState State) { (void)Periph; (void)State; }
+static inline void RCC_AHBPeriphClockCmd(uint32_t Periph, FunctionalState State) { (void)Periph; (void)State; }
+
+#endif
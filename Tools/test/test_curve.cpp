@@ -0,0 +1,212 @@
+/**
+ * @file test_curve.cpp
+ * @brief 圆、椭圆、圆弧/扇形与圆角矩形的整数光栅化，与优化前浮点实现逐像素对比
+ * @note 已知的两类差异(见 user-010 的提交说明)按类别放行，其余任何不同都算失败：
+ *       1. 椭圆：某行真实半宽恰为 x.4999…，浮点版 sqrtf 舍入误差把它进成了 x+1
+ *       2. 圆弧：边界角恰为 225°/315°(即 -135°/-45°)时，浮点版 cosf/sinf 的误差
+ *          让对角线上的像素落到了射线另一侧；整数版四条对角线处理一致
+ */
+
+#include "harness.h"
+#include "ref_arkoled.h"
+#include <math.h>
+
+extern uint8_t REF_OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+
+static void SetMode(int mode)
+{
+    OLED_SetDrawMode((OLED_DrawMode)mode);
+    REF_OLED_SetDrawMode((REF_OLED_DrawMode)mode);
+}
+
+static void Reset(int random)
+{
+    if (random) FrameRandom(OLED_DisplayBuf);
+    else        memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+    memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+}
+
+/*椭圆第 dy 行的真实半宽是否恰在 .5 附近(浮点版在这里可能多进一位)*/
+static int EllipseHalfTie(int A, int B, int dy)
+{
+    if (B == 0 || dy * dy > B * B) return 0;
+    long double h = (long double)A * sqrtl((long double)(B * B - dy * dy)) / B;
+    return fabsl(h - floorl(h) - 0.5L) < 1e-3L;
+}
+
+/*边界角是否为 225°/315°(任意整圈偏移)*/
+static int DiagonalEdge(int angle)
+{
+    int a = ((angle % 360) + 360) % 360;
+    return a == 225 || a == 315;
+}
+
+/**
+  * @brief 对比两份显存，不同的像素交给 Allowed 判断是否属于已知差异
+  * @return 1=完全相同，0=有已知差异，-1=有未放行的差异
+  */
+template <typename F>
+static int Compare(F Allowed)
+{
+    int result = 1;
+    for (int y = 0; y < OLED_HEIGHT; y++)
+        for (int x = 0; x < OLED_WIDTH; x++)
+            if (FramePixel(OLED_DisplayBuf, x, y) != FramePixel(REF_OLED_DisplayBuf, x, y))
+            {
+                if (!Allowed(x, y)) return -1;
+                result = 0;
+            }
+    return result;
+}
+
+static int Exact(int, int) { return 0; }
+
+int main(int argc, char **argv)
+{
+    srand(10);
+
+    /*圆：r 0~80，圆心在屏内/屏边，必须完全一致*/
+    for (int r = 0; r <= 80; r++)
+        for (int k = 0; k < 8; k++)
+        {
+            int x = k < 4 ? 48 : Rand(-30, 125), y = k < 4 ? 48 : Rand(-30, 125);
+            int filled = k & 1, mode = (k >> 1) & 1;
+            Reset(k >= 4);
+            SetMode(mode);
+            OLED_DrawCircle(x, y, r, filled, 1);
+            REF_OLED_DrawCircle(x, y, r, filled, 1);
+            EXPECT(Compare(Exact) == 1, "DrawCircle (%d,%d) r=%d filled=%d mode=%d", x, y, r, filled, mode);
+        }
+
+    /*圆角矩形：宽高 1~40、半径 0~12 全扫一遍，再加随机位置*/
+    for (int w = 1; w <= 40; w++)
+        for (int h = 1; h <= 40; h++)
+            for (int r = 0; r <= 12; r++)
+            {
+                int filled = (w + h + r) & 1, mode = (w ^ h) & 1;
+                int x = Rand(-10, 90), y = Rand(-10, 90);
+                Reset(0);
+                SetMode(mode);
+                OLED_DrawRoundRect(x, y, w, h, r, filled, 1);
+                REF_OLED_DrawRoundRect(x, y, w, h, r, filled, 1);
+                EXPECT(Compare(Exact) == 1, "DrawRoundRect (%d,%d) %dx%d r=%d filled=%d mode=%d", x, y, w, h, r, filled, mode);
+            }
+
+    /*椭圆：A、B 0~100 全扫，空心/实心、NORMAL/XOR*/
+    int ellipseDiffs = 0;
+    for (int a = 0; a <= 100; a++)
+        for (int b = 0; b <= 100; b++)
+            for (int k = 0; k < 4; k++)
+            {
+                int filled = k & 1, mode = k >> 1;
+                Reset(0);
+                SetMode(mode);
+                OLED_DrawEllipse(48, 48, a, b, filled, 1);
+                REF_OLED_DrawEllipse(48, 48, a, b, filled, 1);
+                int c = Compare([&](int, int y) { return EllipseHalfTie(a, b, y - 48); });
+                EXPECT(c >= 0, "DrawEllipse A=%d B=%d filled=%d mode=%d", a, b, filled, mode);
+                ellipseDiffs += (c == 0);
+            }
+
+    /*圆弧/扇形：r 0~48，起止角每15°取一次(含负角与跨360°)*/
+    int arcDiffs = 0;
+    for (int r = 0; r <= 48; r++)
+        for (int s = -360; s < 360; s += 15)
+            for (int e = s + 15; e <= s + 360; e += 15 * Rand(1, 4))
+            {
+                int filled = Rand(0, 1), mode = Rand(0, 1);
+                Reset(0);
+                SetMode(mode);
+                OLED_DrawArc(48, 48, r, s, e, filled, 1);
+                REF_OLED_DrawArc(48, 48, r, s, e, filled, 1);
+                int diag = DiagonalEdge(s) || DiagonalEdge(e);
+                int c = Compare([&](int x, int y) { return diag && abs(x - 48) == abs(y - 48); });
+                EXPECT(c >= 0, "DrawArc r=%d %d..%d filled=%d mode=%d", r, s, e, filled, mode);
+                arcDiffs += (c == 0);
+            }
+
+    /*随机位置与背景：上述之外的组合，圆弧避开对角线边界角*/
+    for (int it = 0; it < 100000; it++)
+    {
+        if (it % 50 == 0) Reset(1);
+        int mode = Rand(0, 1), filled = Rand(0, 1);
+        SetMode(mode);
+        int x = Rand(-40, 135), y = Rand(-40, 135), r = Rand(0, 60), s, e;
+        const char *what = "";
+        int c = 1;
+        switch (Rand(0, 3))
+        {
+            case 0:
+                what = "DrawCircle";
+                OLED_DrawCircle(x, y, r, filled, 1);
+                REF_OLED_DrawCircle(x, y, r, filled, 1);
+                c = Compare(Exact);
+                break;
+            case 1:
+            {
+                what = "DrawEllipse";
+                int a = Rand(0, 60), b = Rand(0, 60);
+                OLED_DrawEllipse(x, y, a, b, filled, 1);
+                REF_OLED_DrawEllipse(x, y, a, b, filled, 1);
+                c = Compare([&](int, int py) { return EllipseHalfTie(a, b, py - y); });
+                break;
+            }
+            case 2:
+                what = "DrawArc";
+                do { s = Rand(-400, 400); e = s + Rand(0, 400); } while (DiagonalEdge(s) || DiagonalEdge(e));
+                OLED_DrawArc(x, y, r, s, e, filled, 1);
+                REF_OLED_DrawArc(x, y, r, s, e, filled, 1);
+                c = Compare(Exact);
+                break;
+            case 3:
+            {
+                what = "DrawRoundRect";
+                int w = Rand(0, 100), h = Rand(0, 100);
+                OLED_DrawRoundRect(x, y, w, h, r / 3, filled, 1);
+                REF_OLED_DrawRoundRect(x, y, w, h, r / 3, filled, 1);
+                c = Compare(Exact);
+                break;
+            }
+        }
+        EXPECT(c >= 0, "%s iter %d (%d,%d) r=%d filled=%d mode=%d", what, it, x, y, r, filled, mode);
+        if (c != 1) memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+    }
+    EXPECT(ellipseDiffs <= 5, "%d ellipses differ, user-010 measured 5", ellipseDiffs);
+    printf("  known differences: %d ellipses (x.5 half-width), %d arcs (225/315 edge, diagonal pixels)\n",
+           ellipseDiffs, arcDiffs);
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 20000;
+        static const struct { const char *name; int kind, filled; } cases[] = {
+            {"circle r30",        0, 0}, {"disc r30",          0, 1},
+            {"ellipse 40x20",     1, 0}, {"filled ellipse",    1, 1},
+            {"arc 30..250 r30",   2, 0}, {"sector 30..250",    2, 1},
+            {"round rect r4",     3, 0}, {"filled round rect", 3, 1},
+        };
+        SetMode(OLED_DRAWMODE_XOR);
+        for (unsigned k = 0; k < sizeof(cases) / sizeof(cases[0]); k++)
+        {
+            double t[3];
+            for (int impl = 0; impl < 2; impl++)
+            {
+                t[impl] = NowUs();
+                for (int i = 0; i < N; i++)
+                {
+                    int f = cases[k].filled, y = 45 + (i & 3);
+                    switch (cases[k].kind)
+                    {
+                        case 0: impl ? REF_OLED_DrawCircle(48, y, 30, f, 1) : OLED_DrawCircle(48, y, 30, f, 1); break;
+                        case 1: impl ? REF_OLED_DrawEllipse(48, y, 40, 20, f, 1) : OLED_DrawEllipse(48, y, 40, 20, f, 1); break;
+                        case 2: impl ? REF_OLED_DrawArc(48, y, 30, 30, 250, f, 1) : OLED_DrawArc(48, y, 30, 30, 250, f, 1); break;
+                        case 3: impl ? REF_OLED_DrawRoundRect(4, y - 30, 88, 40, 4, f, 1) : OLED_DrawRoundRect(4, y - 30, 88, 40, 4, f, 1); break;
+                    }
+                    Touch(impl ? (const void *)REF_OLED_DisplayBuf : (const void *)OLED_DisplayBuf);
+                }
+            }
+            t[2] = NowUs();
+            printf("  %-18s %.2f us (float %.2f us)\n", cases[k].name, (t[1] - t[0]) / N, (t[2] - t[1]) / N);
+        }
+    }
+    return TestReport("curve");
+}
@@ -0,0 +1,199 @@
+/**
+ * @file test_fill.cpp
+ * @brief 矩形/区域填充(OLED_FillBox 字节掩码内核)与优化前逐像素实现逐像素对比；
+ *        抖动图案填充(OLED_FillPattern)与逐像素 Bayer 阈值判断对比
+ */
+
+#include "harness.h"
+#include "ref_arkoled.h"
+
+extern uint8_t REF_OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+
+/*与驱动相同的 8x8 Bayer 阈值矩阵，[行][列]*/
+static const uint8_t Bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+/*基准：区域(已裁剪到屏幕和裁剪区)内逐像素判断是否属于图案，再按运算方式改写*/
+static void RefPattern(Frame f, int x0, int y0, int x1, int y1, int Level, int Op)
+{
+    for (int y = y0; y <= y1; y++)
+        for (int x = x0; x <= x1; x++)
+        {
+            int on = Bayer8[y & 7][x & 7] < Level, v = FramePixel(f, x, y);
+            if (Op == OLED_PATTERN_AND)      v &= on;
+            else if (Op == OLED_PATTERN_OR)  v |= on;
+            else                             v ^= on;
+            FrameSetPixel(f, x, y, v);
+        }
+}
+
+static void SetMode(int mode)
+{
+    OLED_SetDrawMode((OLED_DrawMode)mode);
+    REF_OLED_SetDrawMode((REF_OLED_DrawMode)mode);
+}
+
+int main(int argc, char **argv)
+{
+    srand(1);
+    for (int it = 0; it < 200000; it++)
+    {
+        if (it % 50 == 0)
+        {
+            FrameRandom(OLED_DisplayBuf);
+            memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+        }
+        SetMode(Rand(0, 1));
+
+        int x = Rand(-20, 110), y = Rand(-20, 110), w = Rand(0, 60), h = Rand(0, 60);
+        int filled = Rand(0, 1), op = Rand(0, 1), v;
+        const char *what = "";
+        switch (Rand(0, 5))
+        {
+            case 0:
+                what = "DrawRectangle";
+                OLED_DrawRectangle(x, y, w, h, filled, op);
+                REF_OLED_DrawRectangle(x, y, w, h, filled, op);
+                break;
+            case 1:
+                what = "ClearArea";
+                if (Rand(0, 9) == 0) x = Rand(-32768, 32500);
+                w = Rand(0, 255); h = Rand(0, 255);
+                OLED_ClearArea(x, y, w, h);
+                REF_OLED_ClearArea(x, y, w, h);
+                break;
+            case 2:
+                what = "ReverseArea";
+                if (Rand(0, 9) == 0) y = Rand(-32768, 32500);
+                w = Rand(0, 255); h = Rand(0, 255);
+                OLED_ReverseArea(x, y, w, h);
+                REF_OLED_ReverseArea(x, y, w, h);
+                break;
+            case 3:
+                /*优化前没有 OLED_FillArea，等价于先清除再取反*/
+                what = "FillArea";
+                if (Rand(0, 3) == 0) { x = Rand(-40, 0); y = Rand(-40, 0); w = Rand(96, 255); h = Rand(96, 255); }
+                v = Rand(0, 1);
+                OLED_FillArea(x, y, w, h, v);
+                REF_OLED_ClearArea(x, y, w, h);
+                if (v) REF_OLED_ReverseArea(x, y, w, h);
+                break;
+            case 4:
+                what = "Clear/Reverse";
+                if (Rand(0, 1)) { OLED_Clear(); REF_OLED_Clear(); }
+                else            { OLED_Reverse(); REF_OLED_Reverse(); }
+                break;
+            case 5:
+                what = "ReverseArea(full)";
+                OLED_ReverseArea(0, 0, OLED_WIDTH, OLED_HEIGHT);
+                REF_OLED_Reverse();
+                break;
+        }
+        int same = memcmp(OLED_DisplayBuf, REF_OLED_DisplayBuf, sizeof(OLED_DisplayBuf)) == 0;
+        EXPECT(same, "%s iter %d x=%d y=%d w=%d h=%d filled=%d op=%d", what, it, x, y, w, h, filled, op);
+        if (!same) memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+    }
+
+    /*抖动图案：任意区域、电平与运算方式，一半在随机裁剪区内*/
+    for (int it = 0; it < 100000; it++)
+    {
+        FrameRandom(OLED_DisplayBuf);
+        Frame expect;
+        memcpy(expect, OLED_DisplayBuf, sizeof(expect));
+        int x = Rand(-20, 100), y = Rand(-20, 100), w = Rand(0, 120), h = Rand(0, 120);
+        int level = Rand(0, OLED_PATTERN_LEVELS), op = Rand(0, 2);
+        int x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y, x1 = x + w - 1, y1 = y + h - 1;
+        int clip = Rand(0, 1);
+        if (clip)
+        {
+            int cx = Rand(0, 95), cy = Rand(0, 95), cw = Rand(1, 96), ch = Rand(1, 96);
+            OLED_PushClip(cx, cy, cw, ch);
+            if (x0 < cx) x0 = cx;
+            if (y0 < cy) y0 = cy;
+            if (x1 > cx + cw - 1) x1 = cx + cw - 1;
+            if (y1 > cy + ch - 1) y1 = cy + ch - 1;
+        }
+        if (x1 > OLED_WIDTH - 1) x1 = OLED_WIDTH - 1;
+        if (y1 > OLED_HEIGHT - 1) y1 = OLED_HEIGHT - 1;
+        OLED_FillPattern(x, y, w, h, level, op);
+        if (clip) OLED_PopClip();
+        RefPattern(expect, x0, y0, x1, y1, level, op);
+
+        int dx = 0, dy = 0;
+        int diff = FrameDiff(OLED_DisplayBuf, expect, &dx, &dy);
+        EXPECT(!diff, "FillPattern iter %d (%d,%d) %dx%d level=%d op=%d clip=%d, first diff (%d,%d)",
+               it, x, y, w, h, level, op, clip, dx, dy);
+    }
+
+    /*头文件里说明的常用电平：1/4 为偶数行的偶数列，1/2 为棋盘格*/
+    memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+    OLED_FillPattern(0, 0, OLED_WIDTH, OLED_HEIGHT, OLED_PATTERN_1_4, OLED_PATTERN_OR);
+    for (int y = 0; y < OLED_HEIGHT; y++)
+        for (int x = 0; x < OLED_WIDTH; x++)
+            EXPECT(FramePixel(OLED_DisplayBuf, x, y) == (!(x & 1) && !(y & 1)), "OLED_PATTERN_1_4 pixel (%d,%d)", x, y);
+    memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+    OLED_FillPattern(0, 0, OLED_WIDTH, OLED_HEIGHT, OLED_PATTERN_1_2, OLED_PATTERN_OR);
+    for (int y = 0; y < OLED_HEIGHT; y++)
+        for (int x = 0; x < OLED_WIDTH; x++)
+            EXPECT(FramePixel(OLED_DisplayBuf, x, y) == !((x + y) & 1), "OLED_PATTERN_1_2 pixel (%d,%d)", x, y);
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 20000;
+        SetMode(OLED_DRAWMODE_NORMAL);
+        double t0 = NowUs();
+        for (int i = 0; i < N; i++) { OLED_DrawRectangle(10, 10 + (i & 7), 60, 40, OLED_FILLED, 1); Touch(OLED_DisplayBuf); }
+        double t1 = NowUs();
+        for (int i = 0; i < N; i++) { REF_OLED_DrawRectangle(10, 10 + (i & 7), 60, 40, OLED_FILLED, 1); Touch(REF_OLED_DisplayBuf); }
+        double t2 = NowUs();
+        SetMode(OLED_DRAWMODE_XOR);
+        for (int i = 0; i < N; i++) { OLED_DrawRoundRect(2, 3 + (i & 7), 90, 12, 2, OLED_FILLED, 1); Touch(OLED_DisplayBuf); }
+        double t3 = NowUs();
+        for (int i = 0; i < N; i++) { REF_OLED_DrawRoundRect(2, 3 + (i & 7), 90, 12, 2, OLED_FILLED, 1); Touch(REF_OLED_DisplayBuf); }
+        double t4 = NowUs();
+        printf("  60x40 box: %.2f us (per-pixel %.2f us); 90x12 XOR round rect: %.2f us (per-pixel %.2f us)\n",
+               (t1 - t0) / N, (t2 - t1) / N, (t3 - t2) / N, (t4 - t3) / N);
+
+        static Frame scratch;
+        t0 = NowUs();
+        for (int i = 0; i < N; i++) { OLED_FillPattern(0, i & 7, OLED_WIDTH, 80, OLED_PATTERN_1_2, OLED_PATTERN_AND); Touch(OLED_DisplayBuf); }
+        t1 = NowUs();
+        for (int i = 0; i < N / 10; i++) { RefPattern(scratch, 0, i & 7, 95, 79 + (i & 7), OLED_PATTERN_1_2, OLED_PATTERN_AND); Touch(scratch); }
+        t2 = NowUs();
+        printf("  96x80 dither AND: %.2f us (per-pixel %.2f us)\n", (t1 - t0) / N, (t2 - t1) / (N / 10));
+
+        /*整屏与区域清除/取反，各自与 ref 对比. 主机上编译器把 ref 整屏的逐字节循环向量化(每次16字节)，
+          板上的 Cortex-M3 没有SIMD，整屏只能看相对值；新实现的耗时里还包含脏区记录*/
+        struct { const char *name; void (*fn)(void); void (*ref)(void); } whole[2] = {
+            {"OLED_Clear", OLED_Clear, REF_OLED_Clear}, {"OLED_Reverse", OLED_Reverse, REF_OLED_Reverse}};
+        for (int k = 0; k < 2; k++)
+        {
+            t0 = NowUs();
+            for (int i = 0; i < N; i++) { whole[k].fn(); Touch(OLED_DisplayBuf); }
+            t1 = NowUs();
+            for (int i = 0; i < N; i++) { whole[k].ref(); Touch(REF_OLED_DisplayBuf); }
+            t2 = NowUs();
+            printf("  %-13s %.3f us (ref %.3f us)\n", whole[k].name, (t1 - t0) / N, (t2 - t1) / N);
+        }
+        struct { const char *name; void (*fn)(int16_t, int16_t, uint8_t, uint8_t); void (*ref)(int16_t, int16_t, uint8_t, uint8_t); } area[2] = {
+            {"ClearArea", OLED_ClearArea, REF_OLED_ClearArea}, {"ReverseArea", OLED_ReverseArea, REF_OLED_ReverseArea}};
+        for (int k = 0; k < 2; k++)
+        {
+            t0 = NowUs();
+            for (int i = 0; i < N; i++) { area[k].fn(10, (int16_t)(10 + (i & 7)), 60, 40); Touch(OLED_DisplayBuf); }
+            t1 = NowUs();
+            for (int i = 0; i < N; i++) { area[k].ref(10, (int16_t)(10 + (i & 7)), 60, 40); Touch(REF_OLED_DisplayBuf); }
+            t2 = NowUs();
+            printf("  60x40 %-11s %.3f us (ref %.3f us)\n", area[k].name, (t1 - t0) / N, (t2 - t1) / N);
+        }
+    }
+    return TestReport("fill");
+}
@@ -0,0 +1,345 @@
+/**
+ * @file test_fixed.cpp
+ * @brief 定点数显示 OLED_ShowFixedNum(OLED_FixedToString)：与64位整数的参照实现按表对比
+ * @note 每个 Scale/FraLength 组合(含超出0~9被截到9的值)、Width 0~OLED_NUM_WIDTH_MAX 及超出、四个标志的全部组合，
+ *       取值含 INT32_MIN/INT32_MAX、恰好一半、舍入后为0的负数；显示的像素与 OLED_ShowString(参照字符串) 对比，
+ *       返回值与参照字符串长度对比. 另有手写的期望字符串表.
+ * @note ArkUI 数值项：改用 OLED_ShowFixedNum 之前 ArkUIDisplayItem 按数量级逐级 printf 的字符串与现在显示的对比，
+ *       现在的小数项必须等于十进制值按64位参照舍入的结果，与原来只允许下列差异：
+ *       整数项的小数部分由截断改为四舍五入；小数项恰好一半时远离0进位(printf 按二进制值舍入，可能舍去)；
+ *       10000~99999 显示数字而不是"..."；9.9996 这类进位后超出5个字符的值显示 "10.00" 而不是 "10.000"；
+ *       舍入后为0的负数显示 "0.000" 而不是 "-0.000"
+ */
+
+#include "harness.h"
+#include <stdint.h>
+#include <math.h>
+
+#define WIDTH_MAX   20      // 与 dvc_arkoled.c 的 OLED_NUM_WIDTH_MAX 相同
+
+static uint64_t Pow10(int n)
+{
+    uint64_t p = 1;
+    while (n-- > 0) p *= 10;
+    return p;
+}
+
+/*参照实现：64位整数，舍入用 (mag + q/2) / q，整数与小数部分用 snprintf 输出；放不下返回0*/
+static int RefFixed(char *Out, int32_t Value, int Scale, int Fra, int Width, int Flags)
+{
+    uint64_t mag = (Value < 0) ? (uint64_t)(-(int64_t)Value) : (uint64_t)Value, m;
+    char digits[64];
+    int n;
+
+    if (Scale > 9) Scale = 9;
+    if (Fra > 9) Fra = 9;
+    if (Width > WIDTH_MAX) Width = WIDTH_MAX;
+    for (;;)
+    {
+        if (Fra < Scale)
+        {
+            uint64_t q = Pow10(Scale - Fra);
+            m = (mag + q / 2) / q;
+        }
+        else
+        {
+            m = mag * Pow10(Fra - Scale);
+        }
+        if (Fra) n = snprintf(digits, sizeof(digits), "%llu.%0*llu", (unsigned long long)(m / Pow10(Fra)), Fra,
+                              (unsigned long long)(m % Pow10(Fra)));
+        else     n = snprintf(digits, sizeof(digits), "%llu", (unsigned long long)m);
+        if ((Flags & OLED_NUM_ZERO) && n < Width)
+        {
+            memmove(digits + Width - n, digits, (size_t)n + 1);
+            memset(digits, '0', (size_t)(Width - n));
+            n = Width;
+        }
+        if (Width == 0 || n <= Width) break;
+        if (!(Flags & OLED_NUM_FIT) || Fra == 0)
+        {
+            Out[0] = '\0';
+            return 0;
+        }
+        Fra--;
+    }
+    /*舍入后为0的负数不带负号*/
+    if (Value < 0 && m != 0)         return snprintf(Out, 32, "-%s", digits);
+    else if (Flags & OLED_NUM_PLUS)  return snprintf(Out, 32, "+%s", digits);
+    else                             return snprintf(Out, 32, "%s", digits);
+}
+
+/*
+ 最多21个字符(126像素)：画成两行，第w行左移96*w像素，拼起来是横坐标0~191.
+ 左对齐从0开始，右对齐的右端在192
+*/
+#define VIEW_RIGHT  (2 * OLED_WIDTH)
+
+static void ClearView(void)
+{
+    memset(OLED_DisplayBuf, 0, 2 * OLED_WIDTH);
+}
+
+static uint8_t ShowFixedView(int32_t Value, uint8_t Scale, uint8_t Fra, uint8_t Width, uint8_t Flags)
+{
+    int16_t x = (Flags & OLED_NUM_RIGHT) ? VIEW_RIGHT : 0;
+    uint8_t len = 0;
+    ClearView();
+    for (int w = 0; w < 2; w++)
+        len = OLED_ShowFixedNum((int16_t)(x - OLED_WIDTH * w), (int16_t)(8 * w), Value, Scale, Fra, Width, Flags, OLED_6X8);
+    return len;
+}
+
+static void ShowStringView(const char *S, int Right)
+{
+    int16_t x = Right ? (int16_t)(VIEW_RIGHT - 6 * (int)strlen(S)) : 0;
+    ClearView();
+    for (int w = 0; w < 2; w++) OLED_ShowString((int16_t)(x - OLED_WIDTH * w), (int16_t)(8 * w), (char *)S, OLED_6X8);
+}
+
+/*显示 Value 并与字符串 Expect 对比：像素、返回值(放不下时 Expect 为空串，应返回0且什么也不画)*/
+static int CheckShown(const char *Expect, int32_t Value, int Scale, int Fra, int Width, int Flags)
+{
+    static uint8_t shown[2][OLED_WIDTH];
+    uint8_t len = ShowFixedView(Value, (uint8_t)Scale, (uint8_t)Fra, (uint8_t)Width, (uint8_t)Flags);
+    memcpy(shown, OLED_DisplayBuf, sizeof(shown));
+    ShowStringView(Expect, Flags & OLED_NUM_RIGHT);
+    int ok = len == strlen(Expect) && memcmp(shown, OLED_DisplayBuf, sizeof(shown)) == 0;
+    EXPECT(ok, "ShowFixedNum(%ld, Scale %d, Fra %d, Width %d, Flags 0x%x): expected \"%s\", returned %d%s",
+           (long)Value, Scale, Fra, Width, Flags, Expect, len, len == strlen(Expect) ? " but the pixels differ" : "");
+    return ok;
+}
+
+/*手写的期望值：Expect 为空串表示放不下*/
+#define FIXED_CASE(Expect, Value, Scale, Fra, Width, Flags)                                         \
+    do {                                                                                            \
+        char ref_[32];                                                                              \
+        RefFixed(ref_, Value, Scale, Fra, Width, Flags);                                            \
+        EXPECT(strcmp(ref_, Expect) == 0, "line %d: table says \"%s\", the 64-bit reference gives \"%s\"", \
+               __LINE__, Expect, ref_);                                                             \
+        CheckShown(Expect, Value, Scale, Fra, Width, Flags);                                        \
+    } while (0)
+
+static void TableCases(void)
+{
+    /*舍入：少于Scale时恰好一半远离0，多于Scale时补0*/
+    FIXED_CASE("12.34", 1234, 2, 2, 0, 0);
+    FIXED_CASE("12.3", 1234, 2, 1, 0, 0);
+    FIXED_CASE("12.4", 1235, 2, 1, 0, 0);
+    FIXED_CASE("-12.4", -1235, 2, 1, 0, 0);
+    FIXED_CASE("13", 1250, 2, 0, 0, 0);
+    FIXED_CASE("12.3400", 1234, 2, 4, 0, 0);
+    FIXED_CASE("0.000012345", 12345, 9, 9, 0, 0);
+    FIXED_CASE("0.000012345", 12345, 12, 12, 0, 0);         // Scale/FraLength 超过9按9
+    FIXED_CASE("1.000", 999999, 6, 3, 0, 0);
+
+    /*舍入后为0的负数不显示负号；0带+号*/
+    FIXED_CASE("0", -4, 1, 0, 0, 0);
+    FIXED_CASE("-1", -5, 1, 0, 0, 0);
+    FIXED_CASE("0.00", -4, 3, 2, 0, 0);
+    FIXED_CASE("-0.01", -5, 3, 2, 0, 0);
+    FIXED_CASE("+0", -4, 1, 0, 0, OLED_NUM_PLUS);
+    FIXED_CASE("+0", 0, 0, 0, 0, OLED_NUM_PLUS);
+    FIXED_CASE("+1.5", 15, 1, 1, 0, OLED_NUM_PLUS);
+
+    /*INT32_MIN/INT32_MAX：绝对值超出int32，最长21个字符*/
+    FIXED_CASE("-2147483648", INT32_MIN, 0, 0, 0, 0);
+    FIXED_CASE("-2.147483648", INT32_MIN, 9, 9, 0, 0);
+    FIXED_CASE("-2.15", INT32_MIN, 9, 2, 0, 0);
+    FIXED_CASE("-21474836.48", INT32_MIN, 2, 2, 0, 0);
+    FIXED_CASE("-2147483648.000000000", INT32_MIN, 0, 9, 0, 0);
+    FIXED_CASE("2147483647.000000000", INT32_MAX, 0, 9, 0, 0);
+    FIXED_CASE("2", INT32_MAX, 9, 0, 0, 0);
+
+    /*Width：不含符号；放不下返回0，OLED_NUM_FIT 逐位减少小数位*/
+    FIXED_CASE("9999", 9999, 0, 0, 4, 0);
+    FIXED_CASE("-9999", -9999, 0, 0, 4, 0);
+    FIXED_CASE("", 10000, 0, 0, 4, 0);
+    FIXED_CASE("", 12345, 1, 1, 4, 0);
+    FIXED_CASE("1235", 12345, 1, 1, 4, OLED_NUM_FIT);
+    FIXED_CASE("12.35", 12345, 3, 3, 5, OLED_NUM_FIT);
+    FIXED_CASE("10.00", 99996, 4, 3, 5, OLED_NUM_FIT);
+    FIXED_CASE("", 999996, 1, 1, 5, OLED_NUM_FIT);          // 进位后6位整数，去掉全部小数也放不下
+
+    /*OLED_NUM_ZERO：整数部分前补0到Width个字符，负号在外*/
+    FIXED_CASE("00042", 42, 0, 0, 5, OLED_NUM_ZERO);
+    FIXED_CASE("-00042", -42, 0, 0, 5, OLED_NUM_ZERO);
+    FIXED_CASE("004.20", 42, 1, 2, 6, OLED_NUM_ZERO);
+    FIXED_CASE("+0000", 0, 0, 0, 4, OLED_NUM_ZERO | OLED_NUM_PLUS);
+    FIXED_CASE("42", 42, 0, 0, 0, OLED_NUM_ZERO);           // Width为0时不补
+
+    /*Width 超过 OLED_NUM_WIDTH_MAX 按20*/
+    FIXED_CASE("00000000000000000042", 42, 0, 0, 25, OLED_NUM_ZERO);
+    FIXED_CASE("-2147483648.000000000", INT32_MIN, 0, 9, 25, 0);
+    FIXED_CASE("", INT32_MIN, 0, 9, 19, 0);
+    FIXED_CASE("-2147483648.00000000", INT32_MIN, 0, 9, 19, OLED_NUM_FIT);
+
+    /*右对齐：X为右端*/
+    FIXED_CASE("-3.5", -35, 1, 1, 0, OLED_NUM_RIGHT);
+    FIXED_CASE("0042", 42, 0, 0, 4, OLED_NUM_RIGHT | OLED_NUM_ZERO);
+}
+
+/*全部组合与参照实现对比*/
+static long AllCombinations(void)
+{
+    static const int32_t values[] = {
+        0, 1, -1, 4, -4, 5, -5, 9, -9, 45, -45, 49, 50, -50, 95, -95, 99, -99, 499, 500, -500, 999, -999,
+        12345, -12345, 99999, -99999, 100000, 1234567, -1234567, 99999995, 999999999, -999999999,
+        1000000000, -1000000000, 2147483645, INT32_MAX, INT32_MIN + 1, INT32_MIN};
+    static const int widths[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 15, 19, WIDTH_MAX, WIDTH_MAX + 1, 255};
+    char expect[32];
+    long cases = 0;
+
+    for (unsigned v = 0; v < sizeof(values) / sizeof(values[0]); v++)
+        for (int scale = 0; scale <= 10; scale++)
+            for (int fra = 0; fra <= 10; fra++)
+                for (unsigned w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+                    for (int flags = 0; flags < 16; flags++)
+                    {
+                        RefFixed(expect, values[v], scale, fra, widths[w], flags);
+                        CheckShown(expect, values[v], scale, fra, widths[w], flags);
+                        cases++;
+                    }
+    return cases;
+}
+
+/*------------------------ArkUI 数值项：改用 OLED_ShowFixedNum 之前与之后------------------------*/
+
+/*改之前 ArkUIDisplayItem 的小数项：按数量级选 printf 的格式*/
+static void OldFloatItem(char *Out, double v)
+{
+    if (v >= 10000 || v <= -10000)      strcpy(Out, "...");
+    else if (v == 0)                    strcpy(Out, "0");
+    else if (v < 10 && v > -10)         snprintf(Out, 32, "%.3f", v);
+    else if (v < 100 && v > -100)       snprintf(Out, 32, "%.2f", v);
+    else if (v < 1000 && v > -1000)     snprintf(Out, 32, "%.1f", v);
+    else                                snprintf(Out, 32, "%.0f", v);
+}
+
+/*改之前的整数项(有符号)：截断成int，4位以内 printf，否则"..."*/
+static void OldIntItem(char *Out, double v)
+{
+    if (v >= 10000 || v <= -10000) strcpy(Out, "...");
+    else                           snprintf(Out, 32, "%d", (int)v);
+}
+
+/*与 arkui.c 的 ArkUIParamToFixed 相同*/
+static int32_t ParamToFixed(double value, uint8_t scale)
+{
+    while (scale--)
+        value *= 10;
+    if (value >= 2147483647.0)
+        return INT32_MAX;
+    if (value <= -2147483647.0)
+        return -INT32_MAX;
+    return (int32_t)(value < 0 ? value - 0.5 + value * 1e-14 : value + 0.5 + value * 1e-14);
+}
+
+/*现在的小数项：与 ArkUIDisplayItem 相同的调用，返回显示的字符串(放不下为"...")*/
+static void NewFloatItem(char *Out, double v)
+{
+    int fra;
+    uint8_t shown = 0;
+    for (fra = (v == 0) ? 0 : 3; ; fra--)
+    {
+        shown = ShowFixedView(ParamToFixed(v, (uint8_t)fra), (uint8_t)fra, (uint8_t)fra, 5, OLED_NUM_RIGHT);
+        if (shown || fra == 0) break;
+    }
+    if (!shown) { strcpy(Out, "..."); return; }
+    RefFixed(Out, ParamToFixed(v, (uint8_t)fra), fra, fra, 5, 0);
+    CheckShown(Out, ParamToFixed(v, (uint8_t)fra), fra, fra, 5, OLED_NUM_RIGHT);
+}
+
+/*显示的数字部分(不含负号)的字符数*/
+static int Digits(const char *S)
+{
+    return (int)strlen(S) - (S[0] == '-');
+}
+
+/*v 的十进制形式在 Fra 位小数之后恰好是5000...(恰好一半)：v 由 N/10^4 得到*/
+static int IsTie(int64_t N, int Fra)
+{
+    int64_t q = (int64_t)Pow10(4 - Fra);
+    int64_t r = (N < 0 ? -N : N) % q;
+    return Fra < 4 && r * 2 == q;
+}
+
+static void LadderCases(void)
+{
+    char oldS[32], newS[32], exact[32];
+    long same = 0, ties = 0, longer = 0, wide = 0, rounded = 0, negZero = 0;
+
+    /*小数项：十进制最多4位小数的值 N/10^4，数量级均匀分布*/
+    for (int i = 0; i < 200000; i++)
+    {
+        int64_t n = (int64_t)rand() % (int64_t)Pow10(Rand(1, 9));
+        if (i & 1) n = -n;
+        double v = (double)n / 10000.0;
+        OldFloatItem(oldS, v);
+        NewFloatItem(newS, v);
+
+        /*现在的显示等于十进制值 N/10^4 按64位参照舍入(恰好一半远离0)的结果*/
+        int fra;
+        for (fra = (n == 0) ? 0 : 3; fra > 0 && !RefFixed(exact, (int32_t)n, 4, fra, 5, 0); fra--) {}
+        if (!RefFixed(exact, (int32_t)n, 4, fra, 5, 0)) strcpy(exact, "...");
+        EXPECT(strcmp(newS, exact) == 0, "float item %.4f: shows \"%s\", the decimal value rounds to \"%s\"", v, newS, exact);
+
+        if (strcmp(oldS, newS) == 0) { same++; continue; }
+
+        fra = (strchr(oldS, '.') != NULL) ? (int)strlen(strchr(oldS, '.') + 1) : 0;
+        if (strcmp(oldS, "...") == 0)
+            wide++;                                         // 10000~99999：现在显示数字
+        else if (IsTie(n, fra))
+        {
+            /*恰好一半：printf 按二进制值舍入(可能舍去)，现在远离0*/
+            EXPECT(fabs(atof(newS)) > fabs(atof(oldS)), "float item %.4f: tie rounded toward 0: old \"%s\", now \"%s\"",
+                   v, oldS, newS);
+            ties++;
+        }
+        else if (Digits(oldS) > 5)
+            longer++;                                       // 进位后超出5个字符：现在少一位小数
+        else if (oldS[0] == '-' && atof(oldS) == 0 && strcmp(oldS + 1, newS) == 0)
+            negZero++;                                      // printf 的 "-0.000"：舍入后为0的负数不带负号
+        else
+            EXPECT(0, "float item %.4f: old ladder \"%s\", now \"%s\"", v, oldS, newS);
+    }
+
+    /*整数项：参数一般是整数；带小数时改之前截断，现在四舍五入*/
+    for (int i = 0; i < 100000; i++)
+    {
+        double v = (i & 1) ? Rand(-12000, 12000) : Rand(-120000, 120000) / 10.0;
+        OldIntItem(oldS, v);
+        if (!RefFixed(newS, ParamToFixed(v, 0), 0, 0, 4, 0)) strcpy(newS, "...");
+        else CheckShown(newS, ParamToFixed(v, 0), 0, 0, 4, OLED_NUM_RIGHT);
+        if (strcmp(oldS, newS) == 0) { same++; continue; }
+        double frac = v - (int)v;
+        EXPECT(frac >= 0.5 || frac <= -0.5, "int item %.1f: old ladder \"%s\", now \"%s\"", v, oldS, newS);
+        rounded++;
+    }
+
+    printf("  ArkUI value items vs the old ladders: %ld same; differences: %ld exact ties (half away from 0), "
+           "%ld values 10000..99999 shown, %ld carries past 5 characters, %ld \"-0.000\" without the sign, "
+           "%ld int params rounded instead of truncated\n",
+           same, ties, wide, longer, negZero, rounded);
+}
+
+int main(int argc, char **argv)
+{
+    srand(22);
+    TableCases();
+    long cases = AllCombinations();
+    LadderCases();
+    printf("  %ld Scale/FraLength/Width/Flags combinations match the 64-bit reference\n", cases);
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 200000;
+        double t0 = NowUs();
+        for (int i = 0; i < N; i++) OLED_ShowFixedNum(10, 10, 1234567 + i, 3, 2, 8, OLED_NUM_RIGHT, OLED_6X8);
+        double t1 = NowUs();
+        for (int i = 0; i < N; i++) OLED_ShowFloatNum(10, 10, (1234567 + i) / 1000.0, 4, 2, OLED_6X8);
+        double t2 = NowUs();
+        Touch(OLED_DisplayBuf);
+        printf("  ShowFixedNum %.3f us, ShowFloatNum %.3f us per call (\"1234.57\")\n", (t1 - t0) / N, (t2 - t1) / N);
+    }
+    return TestReport("fixed");
+}
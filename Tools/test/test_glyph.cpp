@@ -0,0 +1,94 @@
+/**
+ * @file test_glyph.cpp
+ * @brief 字形列字节拼接(OLED_BlitGlyph)：字符、字符串与整数显示，与优化前逐像素实现逐像素对比
+ */
+
+#include "harness.h"
+#include "ref_arkoled.h"
+
+extern uint8_t REF_OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+
+int main(int argc, char **argv)
+{
+    srand(3);
+    for (int it = 0; it < 200000; it++)
+    {
+        if (it % 50 == 0)
+        {
+            FrameRandom(OLED_DisplayBuf);
+            memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+        }
+        int mode = Rand(0, 1);
+        OLED_SetDrawMode((OLED_DrawMode)mode);
+        REF_OLED_SetDrawMode((REF_OLED_DrawMode)mode);
+
+        int x = Rand(-40, 110), y = Rand(-20, 110), size = Rand(0, 1) ? OLED_8X16 : OLED_6X8;
+        int len = Rand(0, 6);
+        uint32_t u = (uint32_t)rand() * 2u + (uint32_t)Rand(0, 1);
+        char s[20];
+        for (int i = 0; i < 19; i++) s[i] = (char)Rand(' ', '~');
+        s[Rand(0, 19)] = '\0';
+        s[19] = '\0';
+
+        const char *what = "";
+        switch (Rand(0, 6))
+        {
+            case 0:
+                what = "ShowChar";
+                OLED_ShowChar(x, y, s[0] ? s[0] : ' ', size);
+                REF_OLED_ShowChar(x, y, s[0] ? s[0] : ' ', size);
+                break;
+            case 1:
+                what = "ShowString";
+                OLED_ShowString(x, y, s, size);
+                REF_OLED_ShowString(x, y, s, size);
+                break;
+            case 2:
+                /*等宽字体描述符走同一条字形路径，ASCII 与 OLED_ShowString 一致*/
+                what = "ShowText";
+                OLED_ShowText(x, y, s, (size == OLED_8X16) ? &OLED_Font8x16 : &OLED_Font6x8);
+                REF_OLED_ShowString(x, y, s, size);
+                break;
+            case 3:
+                what = "ShowNum";
+                OLED_ShowNum(x, y, u % 100000000u, len + 1, size);
+                REF_OLED_ShowNum(x, y, u % 100000000u, len + 1, size);
+                break;
+            case 4:
+                what = "ShowSignedNum";
+                OLED_ShowSignedNum(x, y, (int32_t)(u % 2000000) - 1000000, len + 1, size);
+                REF_OLED_ShowSignedNum(x, y, (int32_t)(u % 2000000) - 1000000, len + 1, size);
+                break;
+            case 5:
+                what = "ShowHexNum";
+                OLED_ShowHexNum(x, y, u, len + 1, size);
+                REF_OLED_ShowHexNum(x, y, u, len + 1, size);
+                break;
+            case 6:
+                what = "ShowBinNum";
+                OLED_ShowBinNum(x, y, u, len + 8, size);
+                REF_OLED_ShowBinNum(x, y, u, len + 8, size);
+                break;
+        }
+        int same = memcmp(OLED_DisplayBuf, REF_OLED_DisplayBuf, sizeof(OLED_DisplayBuf)) == 0;
+        EXPECT(same, "%s iter %d x=%d y=%d size=%d mode=%d \"%s\"", what, it, x, y, size, mode, s);
+        if (!same) memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+    }
+
+    if (WantBench(argc, argv))
+    {
+        static char text[] = "The quick brown fox";
+        const int N = 20000, chars = N * (int)(sizeof(text) - 1);
+        for (int size = OLED_6X8; size <= OLED_8X16; size += OLED_8X16 - OLED_6X8)
+        {
+            double t0 = NowUs();
+            for (int i = 0; i < N; i++) { OLED_ShowString(-3, 3 + (i & 7), text, size); Touch(OLED_DisplayBuf); }
+            double t1 = NowUs();
+            for (int i = 0; i < N; i++) { REF_OLED_ShowString(-3, 3 + (i & 7), text, size); Touch(REF_OLED_DisplayBuf); }
+            double t2 = NowUs();
+            printf("  %s text: %.1fk chars/ms (per-pixel %.1fk chars/ms)\n", size == OLED_6X8 ? "6x8 " : "8x16",
+                   chars / (t1 - t0), chars / (t2 - t1));
+        }
+    }
+    return TestReport("glyph");
+}
@@ -0,0 +1,111 @@
+/**
+ * @file test_hwscroll.cpp
+ * @brief 硬件起始行滚动(-DOLED_USE_HW_SCROLL=1)：随机滚动的列表每帧刷新后，屏幕模型显示的96行与 OLED_DisplayBuf 逐像素对比
+ * @note 覆盖起始行6位回绕、GDDRAM 16页屏幕镜像(显示区外的备用行)、不随内容滚动的叠加层(XOR光标、滚动条)重发，
+ *       以及整屏/区域/差分三种刷新混用；另外统计与不滚动(每帧整屏差分)相比每帧发送的字节数
+ */
+
+#include "harness.h"
+
+/*列表：40行，行高12；Offset 为滚过的像素数，Cursor 为光标所在的屏幕行*/
+static void DrawList(int Offset, int Cursor)
+{
+    char s[16];
+    OLED_Clear();
+    OLED_SetDrawMode(OLED_DRAWMODE_NORMAL);
+    for (int i = 0; i < 40; i++)
+    {
+        int y = i * 12 + 2 - Offset;
+        if (y < -12 || y > OLED_HEIGHT) continue;
+        snprintf(s, sizeof(s), "- Item %d", i);
+        OLED_ShowString(2, (int16_t)y, s, OLED_6X8);
+    }
+    /*叠加层：位置与滚动无关*/
+    OLED_SetDrawMode(OLED_DRAWMODE_XOR);
+    OLED_DrawRoundRect(0, (int16_t)(Cursor * 12), 88, 12, 2, OLED_FILLED, 1);
+    OLED_DrawRectangle(92, (int16_t)(Offset * 77 / 384), 4, 19, OLED_FILLED, 1);
+    OLED_SetDrawMode(OLED_DRAWMODE_NORMAL);
+}
+
+static int VisibleMatches(int *x, int *y)
+{
+    for (int yy = 0; yy < OLED_HEIGHT; yy++)
+        for (int xx = 0; xx < OLED_WIDTH; xx++)
+            if (panel_pixel(xx, yy) != FramePixel(OLED_DisplayBuf, xx, yy)) { *x = xx; *y = yy; return 0; }
+    return 1;
+}
+
+/**
+  * @brief 随机滚动 Frames 帧
+  * @param UseScroll 1：内容移动时调用 OLED_ScrollLines，0：只靠差分刷新
+  * @return 平均每帧发送的字节数
+  */
+static double Run(int Frames, int UseScroll, unsigned Seed)
+{
+    srand(Seed);
+    panel_reset();
+    panel_fill(0x5A);
+    OLED_Init();
+    int offset = 0, lastStart = 0;
+    DrawList(0, 0);
+    OLED_UpdateDirty();
+    int x = 0, y = 0;
+    EXPECT(VisibleMatches(&x, &y), "first frame differs at (%d,%d)", x, y);
+
+    long bytes = 0;
+    for (int f = 0; f < Frames; f++)
+    {
+        /*大多数帧滚动几行；偶尔一次滚很多行(一帧内越过起始行回绕)*/
+        int dy = Rand(0, 2) == 0 ? 0 : Rand(-7, 7);
+        if (Rand(0, 40) == 0) dy = Rand(-90, 90);
+        if (offset + dy < 0) dy = -offset;
+        if (offset + dy > 384) dy = 384 - offset;
+        offset += dy;
+        if (UseScroll && dy) OLED_ScrollLines((int16_t)dy);
+        if (UseScroll) lastStart = (lastStart + dy) & 63;
+
+        DrawList(offset, Rand(0, 7));
+        if (Rand(0, 30) == 0) OLED_DrawCircle(Rand(0, 95), Rand(0, 95), Rand(0, 20), OLED_FILLED, 1);
+
+        panel_reset_counters();
+        int how = Rand(0, 50);
+        if (how == 0) OLED_Update();
+        else if (how == 1)
+        {
+            /*先只发一块，再差分补齐其余部分*/
+            OLED_UpdateArea(Rand(-5, 90), Rand(-5, 90), Rand(0, 96), Rand(0, 96));
+            OLED_UpdateDirty();
+        }
+        else OLED_UpdateDirty();
+        bytes += panel.dataBytes + panel.cmdBytes;
+
+        EXPECT(panel.framingErrors == 0, "frame %d: %ld framing errors", f, panel.framingErrors);
+        EXPECT(panel.startLine == lastStart, "frame %d: panel start line %d, expected %d", f, panel.startLine, lastStart);
+        EXPECT(VisibleMatches(&x, &y), "frame %d (scroll=%d offset=%d start=%d how=%d): visible image differs at (%d,%d)",
+               f, UseScroll, offset, panel.startLine, how, x, y);
+    }
+    return (double)bytes / Frames;
+}
+
+int main(int argc, char **argv)
+{
+    double scrolled = Run(20000, 1, 16);
+    double plain = Run(20000, 0, 16);
+
+    /*起始行寄存器6位：连续同向滚动越过63后回绕，屏幕内容仍正确*/
+    panel_reset();
+    OLED_Init();
+    for (int k = 0; k < 200; k++)
+    {
+        OLED_ScrollLines(5);
+        DrawList(k % 300, k & 7);
+        OLED_UpdateDirty();
+        int x = 0, y = 0;
+        EXPECT(panel.startLine == (k + 1) * 5 % 64, "wrap step %d: start line %d", k, panel.startLine);
+        EXPECT(VisibleMatches(&x, &y), "wrap step %d (start line %d): visible image differs at (%d,%d)", k, panel.startLine, x, y);
+    }
+
+    if (WantBench(argc, argv))
+        printf("  list scroll: %.0f bytes/frame with OLED_ScrollLines, %.0f bytes/frame with diff flush only\n", scrolled, plain);
+    return TestReport("hwscroll");
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_image.cpp
+ * @brief OLED_ShowImage 四种混合方式与优化前的 REF_OLED_ShowImage 逐像素对比
+ * @note 覆盖/叠加直接与 ref 对比；取反/擦除的基准是 ref 在全黑显存上叠加得到的图像像素，再与原显存异或/清除.
+ *       随机的显存内容、任意(含负数、不按页对齐)的X/Y、Height%8 不为0(取模最后一页高度以外的位随机，
+ *       与 ref 一样写进显存)；一半的情况带随机裁剪区，裁剪区外的像素应保持原样(ref 没有裁剪区).
+ *       bench 打印各混合方式按页对齐/不对齐显示 32x32 图标每毫秒的个数，与 ref 对比
+ */
+
+#include "harness.h"
+#include "ref_arkoled.h"
+
+extern uint8_t REF_OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+
+static const char *const modeName[4] = {"COPY", "OR", "XOR", "ANDNOT"};
+
+static uint8_t image[96 * 12];
+
+/*基准：before 上按 Mode 显示图像，裁剪区(屏幕内的闭区间)外保持 before*/
+static void RefImage(Frame expect, const Frame before, int X, int Y, int W, int H, int Mode,
+                     int cx0, int cy0, int cx1, int cy1)
+{
+    Frame shown;
+    if (Mode == OLED_IMAGE_COPY || Mode == OLED_IMAGE_OR)
+    {
+        memcpy(REF_OLED_DisplayBuf, before, sizeof(Frame));
+        REF_OLED_ShowImage((int16_t)X, (int16_t)Y, (uint8_t)W, (uint8_t)H, image, (unsigned char)Mode);
+        memcpy(shown, REF_OLED_DisplayBuf, sizeof(Frame));
+    }
+    else
+    {
+        memset(REF_OLED_DisplayBuf, 0, sizeof(Frame));
+        REF_OLED_ShowImage((int16_t)X, (int16_t)Y, (uint8_t)W, (uint8_t)H, image, 1);
+        for (int p = 0; p < OLED_PAGES; p++)
+            for (int x = 0; x < OLED_WIDTH; x++)
+                shown[p][x] = (uint8_t)(Mode == OLED_IMAGE_XOR ? before[p][x] ^ REF_OLED_DisplayBuf[p][x]
+                                                               : before[p][x] & ~REF_OLED_DisplayBuf[p][x]);
+    }
+    memcpy(expect, before, sizeof(Frame));
+    for (int y = cy0; y <= cy1; y++)
+        for (int x = cx0; x <= cx1; x++) FrameSetPixel(expect, x, y, FramePixel(shown, x, y));
+}
+
+int main(int argc, char **argv)
+{
+    long cases[4] = {0, 0, 0, 0};
+
+    srand(8);
+    for (int it = 0; it < 60000; it++)
+    {
+        int W = Rand(0, 96), H = Rand(0, 96), mode = it & 3;
+        if (it % 4 == 1) H = Rand(1, 12) * 8;        // 取模没有多余位
+        int X = Rand(-W - 8, OLED_WIDTH + 4), Y = Rand(-H - 12, OLED_HEIGHT + 4);
+        if (it % 8 == 2) Y &= ~7;                    // 按页对齐(覆盖模式整页复制)
+        for (int i = 0; i < ((H - 1) / 8 + 1) * W; i++) image[i] = (uint8_t)rand();
+
+        int clipped = Rand(0, 1);
+        int cx0 = 0, cy0 = 0, cx1 = OLED_WIDTH - 1, cy1 = OLED_HEIGHT - 1;
+        Frame before, expect;
+        FrameRandom(before);
+        memcpy(OLED_DisplayBuf, before, sizeof(before));
+        if (clipped)
+        {
+            int x = Rand(0, 95), y = Rand(0, 95), w = Rand(1, 96), h = Rand(1, 96);
+            OLED_PushClip(x, y, w, h);
+            cx0 = x; cy0 = y;
+            cx1 = x + w - 1 > cx1 ? cx1 : x + w - 1;
+            cy1 = y + h - 1 > cy1 ? cy1 : y + h - 1;
+        }
+        OLED_ShowImage((int16_t)X, (int16_t)Y, (uint8_t)W, (uint8_t)H, image, (unsigned char)mode);
+        if (clipped) OLED_PopClip();
+        RefImage(expect, before, X, Y, W, H, mode, cx0, cy0, cx1, cy1);
+
+        int x = 0, y = 0;
+        EXPECT(!FrameDiff(OLED_DisplayBuf, expect, &x, &y), "iter %d %dx%d at (%d,%d) %s%s: differs from ref at (%d,%d)",
+               it, W, H, X, Y, modeName[mode], clipped ? " clipped" : "", x, y);
+        cases[mode]++;
+    }
+    printf("  OLED_ShowImage matches ref: COPY %ld, OR %ld, XOR %ld, ANDNOT %ld placements\n",
+           cases[0], cases[1], cases[2], cases[3]);
+
+    if (WantBench(argc, argv))
+    {
+        /*32x32 图标：Y 按页对齐与错开3行；ref 没有取反/擦除，用叠加的耗时对照*/
+        const int N = 200000;
+        for (int i = 0; i < 32 * 4; i++) image[i] = (uint8_t)rand();
+        for (int aligned = 1; aligned >= 0; aligned--)
+        {
+            int16_t y0 = aligned ? 16 : 19;
+            double icons[4];
+            for (int mode = 0; mode < 4; mode++)
+            {
+                double t0 = NowUs();
+                for (int n = 0; n < N; n++)
+                {
+                    OLED_ShowImage((int16_t)(n & 63), y0, 32, 32, image, (unsigned char)mode);
+                    Touch(OLED_DisplayBuf);
+                }
+                icons[mode] = N / ((NowUs() - t0) / 1000);
+            }
+            double ref[2];
+            for (int mix = 0; mix < 2; mix++)
+            {
+                double t0 = NowUs();
+                for (int n = 0; n < N / 10; n++)
+                {
+                    REF_OLED_ShowImage((int16_t)(n & 63), y0, 32, 32, image, (unsigned char)mix);
+                    Touch(REF_OLED_DisplayBuf);
+                }
+                ref[mix] = N / 10 / ((NowUs() - t0) / 1000);
+            }
+            printf("  32x32 icon, Y %s: COPY %.0f (ref %.0f), OR %.0f (ref %.0f), XOR %.0f, ANDNOT %.0f icons/ms\n",
+                   aligned ? "page aligned" : "aligned + 3 ", icons[0], ref[0], icons[1], ref[1], icons[2], icons[3]);
+        }
+    }
+    return TestReport("image");
+}
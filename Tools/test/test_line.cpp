@@ -0,0 +1,139 @@
+/**
+ * @file test_line.cpp
+ * @brief 直线(页字节横/竖线、Bresenham游程)与空心三角形，与优化前逐像素实现逐像素对比
+ * @note 四分之一的情况带随机裁剪区：优化前没有裁剪区，裁剪区外的像素按画之前的显存核对
+ * @note bench 另外打印经 OLED_ROP_DISPATCH 按写入方式展开的各内核(直线、空心圆/椭圆/圆弧、字符)在
+ *       NORMAL 点亮、NORMAL 熄灭、XOR 三种写入方式下的耗时，与 ref 同样操作的耗时对比；
+ *       各内核的代码大小见 make size-rop
+ */
+
+#include "harness.h"
+#include "ref_arkoled.h"
+
+extern uint8_t REF_OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+
+int main(int argc, char **argv)
+{
+    srand(2);
+    for (int it = 0; it < 300000; it++)
+    {
+        if (it % 50 == 0)
+        {
+            FrameRandom(OLED_DisplayBuf);
+            memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+        }
+        int mode = Rand(0, 1), op = Rand(0, 1), ends = Rand(0, 1);
+        OLED_SetDrawMode((OLED_DrawMode)mode);
+        REF_OLED_SetDrawMode((REF_OLED_DrawMode)mode);
+
+        /*三分之一横线、三分之一竖线，其余任意方向(含超出屏幕很远的端点)*/
+        int span = (it % 20 == 0) ? 2000 : 130;
+        int x0 = Rand(-span / 2, span / 2) + 48, y0 = Rand(-span / 2, span / 2) + 48;
+        int x1 = Rand(-span / 2, span / 2) + 48, y1 = Rand(-span / 2, span / 2) + 48;
+        switch (Rand(0, 3))
+        {
+            case 0: y1 = y0; break;
+            case 1: x1 = x0; break;
+            default: break;
+        }
+        Frame before;
+        int clip = Rand(0, 3) == 0;
+        int cx = Rand(0, 95), cy = Rand(0, 95), cw = Rand(1, 96), ch = Rand(1, 96);
+        memcpy(before, OLED_DisplayBuf, sizeof(before));
+        if (clip) OLED_PushClip(cx, cy, cw, ch);
+        const char *what;
+        if (Rand(0, 4))
+        {
+            what = "DrawLine";
+            OLED_DrawLine(x0, y0, x1, y1, ends, op);
+            REF_OLED_DrawLine(x0, y0, x1, y1, ends, op);
+        }
+        else
+        {
+            what = "DrawTriangle(hollow)";
+            int x2 = Rand(-20, 115), y2 = Rand(-20, 115);
+            OLED_DrawTriangle(x0, y0, x1, y1, x2, y2, OLED_UNFILLED, op);
+            REF_OLED_DrawTriangle(x0, y0, x1, y1, x2, y2, OLED_UNFILLED, op);
+        }
+        if (clip)
+        {
+            OLED_PopClip();
+            for (int y = 0; y < OLED_HEIGHT; y++)
+                for (int x = 0; x < OLED_WIDTH; x++)
+                    if (x < cx || x >= cx + cw || y < cy || y >= cy + ch) FrameSetPixel(REF_OLED_DisplayBuf, x, y, FramePixel(before, x, y));
+        }
+        int same = memcmp(OLED_DisplayBuf, REF_OLED_DisplayBuf, sizeof(OLED_DisplayBuf)) == 0;
+        EXPECT(same, "%s iter %d (%d,%d)-(%d,%d) ends=%d mode=%d op=%d clip=%d", what, it, x0, y0, x1, y1, ends, mode, op, clip);
+        if (!same) memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+    }
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 50000;
+        static const struct { const char *name; int x0, y0, x1, y1; } lines[] = {
+            {"horizontal 90", 2, 40, 91, 40},
+            {"vertical 90",   40, 2, 40, 91},
+            {"diagonal 90",   2, 2, 91, 91},
+            {"shallow 90x20", 2, 30, 91, 49},
+        };
+        OLED_SetDrawMode(OLED_DRAWMODE_XOR);
+        REF_OLED_SetDrawMode(REF_OLED_DRAWMODE_XOR);
+        for (unsigned k = 0; k < sizeof(lines) / sizeof(lines[0]); k++)
+        {
+            double t0 = NowUs();
+            for (int i = 0; i < N; i++) { OLED_DrawLine(lines[k].x0, lines[k].y0, lines[k].x1, lines[k].y1, 1, 1); Touch(OLED_DisplayBuf); }
+            double t1 = NowUs();
+            for (int i = 0; i < N; i++) { REF_OLED_DrawLine(lines[k].x0, lines[k].y0, lines[k].x1, lines[k].y1, 1, 1); Touch(REF_OLED_DisplayBuf); }
+            double t2 = NowUs();
+            printf("  %-14s %.3f us (per-pixel %.3f us)\n", lines[k].name, (t1 - t0) / N, (t2 - t1) / N);
+        }
+
+        /*OLED_ROP_DISPATCH 的各内核：SET/CLEAR/XOR 三份实例分别计时(写入方式在图元入口解析一次)*/
+        static const char *const kernel[5] = {"line 90x50", "circle r30", "ellipse 40x20", "arc 30..250", "6x8 text x16"};
+        static const char *const ropName[3] = {"SET", "CLEAR", "XOR"};
+        static char text[] = "ArkUI 0123456789";
+        printf("  OLED_ROP_DISPATCH kernels, us per call (ref):\n");
+        for (int k = 0; k < 5; k++)
+        {
+            double us[3][2];
+            for (int rop = 0; rop < 3; rop++)
+            {
+                /*SET/CLEAR：NORMAL 模式 operation 为1/0；XOR：XOR 模式*/
+                uint8_t op = (uint8_t)(rop != 1);
+                OLED_SetDrawMode(rop == 2 ? OLED_DRAWMODE_XOR : OLED_DRAWMODE_NORMAL);
+                REF_OLED_SetDrawMode(rop == 2 ? REF_OLED_DRAWMODE_XOR : REF_OLED_DRAWMODE_NORMAL);
+                for (int impl = 0; impl < 2; impl++)
+                {
+                    int n = impl ? N / 10 : N;
+                    double t0 = NowUs();
+                    for (int i = 0; i < n; i++)
+                    {
+                        int16_t y = (int16_t)(20 + (i & 3));
+                        switch (k)
+                        {
+                            case 0: impl ? REF_OLED_DrawLine(2, y, 91, y + 50, 1, op) : OLED_DrawLine(2, y, 91, y + 50, 1, op); break;
+                            case 1: impl ? REF_OLED_DrawCircle(48, y + 25, 30, 0, op) : OLED_DrawCircle(48, y + 25, 30, 0, op); break;
+                            case 2: impl ? REF_OLED_DrawEllipse(48, y + 25, 40, 20, 0, op) : OLED_DrawEllipse(48, y + 25, 40, 20, 0, op); break;
+                            case 3: impl ? REF_OLED_DrawArc(48, y + 25, 30, 30, 250, 0, op) : OLED_DrawArc(48, y + 25, 30, 30, 250, 0, op); break;
+                            case 4:
+                                /*字符没有 operation 参数：CLEAR 用XOR模式画两次的一半代替不了，这里只计 SET/XOR*/
+                                if (rop == 1) break;
+                                impl ? REF_OLED_ShowString(0, y, text, OLED_6X8) : OLED_ShowString(0, y, text, OLED_6X8);
+                                break;
+                        }
+                        Touch(impl ? (const void *)REF_OLED_DisplayBuf : (const void *)OLED_DisplayBuf);
+                    }
+                    us[rop][impl] = (NowUs() - t0) / n;
+                }
+            }
+            if (k == 4)
+                printf("    %-14s SET %.3f (%.3f)  XOR %.3f (%.3f)\n", kernel[k], us[0][0], us[0][1], us[2][0], us[2][1]);
+            else
+                printf("    %-14s %s %.3f (%.3f)  %s %.3f (%.3f)  %s %.3f (%.3f)\n", kernel[k],
+                       ropName[0], us[0][0], us[0][1], ropName[1], us[1][0], us[1][1], ropName[2], us[2][0], us[2][1]);
+        }
+        OLED_SetDrawMode(OLED_DRAWMODE_NORMAL);
+        REF_OLED_SetDrawMode(REF_OLED_DRAWMODE_NORMAL);
+    }
+    return TestReport("line");
+}
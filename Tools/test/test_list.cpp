@@ -0,0 +1,245 @@
+/**
+ * @file test_list.cpp
+ * @brief 显示列表(OLED_USE_DISPLAY_LIST)：同一串随机帧经 OLED_List* 记录、按条带重放发送，与整屏显存直接绘制的屏幕内容逐帧对比
+ * @note 同一份源文件编译多次：test_list_ref 用整屏显存(普通绘图函数 + OLED_Update)，
+ *       test_list / test_list_s1 / _s3 / _s5 / _s12 用 -DOLED_USE_DISPLAY_LIST=1，条带高度 OLED_STRIP_PAGES 为 2/1/3/5/12 页.
+ *       列表版本通过管道运行 test_list_ref dump 取得每帧屏幕模型上的内容并逐像素比较.
+ *       每帧随机混合：图形、字符串/字体文字/数字/ListPrintf、图像(含PackBits)、精灵、缩放图像、
+ *       嵌套裁剪区的压入弹出、绘图模式切换，以及逐点画出的步长2点阵(检查 OLED_ListDrawPoint 的合并)
+ * @note bench：典型菜单帧与整屏点阵帧每帧的耗时(空传输后端，只计绘制/重放)，与整屏显存+差分刷新对比；
+ *       列表模式的RAM占用与列表用量(驱动整体的静态RAM对比见 make size)
+ */
+
+#include "harness.h"
+#include "dvc_oled_data.h"
+
+#if OLED_USE_DISPLAY_LIST
+#define DRAW(Fn, ...)   OLED_List##Fn(__VA_ARGS__)
+#else
+#define DRAW(Fn, ...)   OLED_##Fn(__VA_ARGS__)
+#endif
+
+static uint8_t image[OLED_PAGES * OLED_WIDTH];
+static uint8_t sprite[2 * OLED_PAGES * OLED_WIDTH];
+static const OLED_Font *const fonts[4] = {&OLED_Font6x8, &OLED_Font8x16, &OLED_FontP8, &OLED_FontP16};
+
+static void BeginFrame(void)
+{
+#if OLED_USE_DISPLAY_LIST
+    OLED_ListBegin();
+#else
+    OLED_Clear();
+#endif
+}
+
+static void EndFrame(void)
+{
+#if OLED_USE_DISPLAY_LIST
+    OLED_ListRender();
+#else
+    OLED_Update();
+#endif
+}
+
+/*逐点画步长2的点阵(ArkUI 的虚化/过渡)；Ragged 不为0时各行长度不同，点阵要拆成多条命令*/
+static void Lattice(int X, int Y, int Columns, int Rows, int Ragged, uint8_t Op)
+{
+    for (int r = 0; r < Rows; r++)
+    {
+        int n = Ragged ? Rand(1, Columns) : Columns;
+        for (int c = 0; c < n; c++) DRAW(DrawPoint, (int16_t)(X + 2 * c), (int16_t)(Y + 2 * r), Op);
+    }
+}
+
+/*随机的一帧：两个版本的 Rand 调用序列完全相同*/
+static void RandomFrame(void)
+{
+    char s[24];
+    char fmt[] = "%d|%-4s|%.2f|%x";
+    int depth = 0;
+
+    BeginFrame();
+    int n = Rand(4, 18);
+    for (int k = 0; k < n; k++)
+    {
+        int16_t x = (int16_t)Rand(-30, 100), y = (int16_t)Rand(-30, 100);
+        uint8_t w = (uint8_t)Rand(0, 60), h = (uint8_t)Rand(0, 60);
+        switch (Rand(0, 16))
+        {
+            case 0: DRAW(SetDrawMode, Rand(0, 1) ? OLED_DRAWMODE_XOR : OLED_DRAWMODE_NORMAL); break;
+            case 1: DRAW(DrawPoint, x, y, (uint8_t)Rand(0, 1)); break;
+            case 2:
+                /*参差的点阵每行一条命令，行数少一些免得列表放不下*/
+                if (Rand(0, 1)) Lattice(x, y, w / 2 + 1, h / 8 + 1, 1, (uint8_t)Rand(0, 1));
+                else            Lattice(x, y, w / 2 + 1, h / 2 + 1, 0, (uint8_t)Rand(0, 1));
+                break;
+            case 3: DRAW(DrawRectangle, x, y, w, h, (uint8_t)Rand(0, 1), (uint8_t)Rand(0, 1)); break;
+            case 4: DRAW(DrawRoundRect, x, y, w, h, (uint8_t)Rand(0, 12), (uint8_t)Rand(0, 1), (uint8_t)Rand(0, 1)); break;
+            case 5: DRAW(FillPattern, x, y, w, h, (uint8_t)Rand(0, OLED_PATTERN_LEVELS), (uint8_t)Rand(0, 2)); break;
+            case 6:
+                snprintf(s, sizeof(s), "Item %d:%c", Rand(0, 999), (char)Rand(' ', '~'));
+                DRAW(ShowString, x, y, s, Rand(0, 1) ? OLED_8X16 : OLED_6X8);
+                break;
+            case 7:
+                snprintf(s, sizeof(s), "Vol %d%%", Rand(0, 100));
+                DRAW(ShowText, x, y, s, fonts[Rand(0, 3)]);
+                break;
+            case 8: DRAW(ShowFloatNum, x, y, Rand(-99999, 99999) / 100.0, (uint8_t)Rand(1, 3), (uint8_t)Rand(0, 3), Rand(0, 1) ? OLED_8X16 : OLED_6X8); break;
+            case 9:
+                DRAW(ShowFixedNum, x, y, Rand(-200000, 200000), (uint8_t)Rand(0, 3), (uint8_t)Rand(0, 3), (uint8_t)Rand(0, 8),
+                     (uint8_t)Rand(0, 15), Rand(0, 1) ? OLED_8X16 : OLED_6X8);
+                break;
+            case 10: DRAW(Printf, x, y, Rand(0, 1) ? OLED_8X16 : OLED_6X8, fmt, Rand(-500, 500), "ab", Rand(0, 9999) / 100.0, Rand(0, 4095)); break;
+            case 11: DRAW(ShowImage, x, y, w, h, image, (unsigned char)Rand(0, 3)); break;
+            case 12: DRAW(ShowImagePacked, (int16_t)Rand(-60, 60), (int16_t)Rand(-60, 60), 96, 96, Fonzo_Packed, (unsigned char)Rand(0, 3)); break;
+            case 13: DRAW(ShowSprite, x, y, w, h, sprite, (unsigned char)Rand(0, 2)); break;
+            case 14: DRAW(ShowImageScaled, x, y, (uint8_t)Rand(1, 32), (uint8_t)Rand(1, 32), image, w, h, (unsigned char)Rand(0, 3)); break;
+            case 15:
+                if (depth < 3) depth += DRAW(PushClip, x, y, w, h);
+                break;
+            default:
+                if (depth > 0) { DRAW(PopClip); depth--; }
+                break;
+        }
+    }
+    while (depth-- > 0) DRAW(PopClip);
+    EndFrame();
+}
+
+/*典型菜单帧的绘制：7行标题与数值、XOR光标、滚动条；Dots 不为0时再叠一层整屏点阵(过渡/虚化)*/
+static void MenuFrame(int Tick, int Dots)
+{
+    char s[16];
+    DRAW(ShowString, 2, 2, (char *)"[Settings]", OLED_6X8);
+    for (int i = 0; i < 7; i++)
+    {
+        snprintf(s, sizeof(s), "- Item %d", i + Tick % 5);
+        DRAW(ShowString, 2, (int16_t)(14 + i * 12), s, OLED_6X8);
+        DRAW(ShowFixedNum, 88, (int16_t)(14 + i * 12), 1234 * i + Tick, 2, 1, 0, OLED_NUM_RIGHT, OLED_6X8);
+    }
+    DRAW(SetDrawMode, OLED_DRAWMODE_XOR);
+    DRAW(DrawRoundRect, 0, (int16_t)(12 + (Tick % 7) * 12), 90, 12, 2, 1, 1);
+    DRAW(SetDrawMode, OLED_DRAWMODE_NORMAL);
+    DRAW(DrawRectangle, 92, (int16_t)(Tick % 70), 3, 26, 1, 1);
+    if (Dots) Lattice(Tick & 1, 0, 48, 48, 0, 0);
+}
+
+static void NullInit(void) {}
+static void NullCommand(uint8_t) {}
+static void NullData(const uint8_t *, uint16_t) {}
+static const OLED_Transport nullTransport = {NullInit, NullCommand, NullData, 0, NULL};
+
+/*每帧耗时(us)：Dots 见 MenuFrame；整屏显存版本用差分刷新(ArkUI 默认)*/
+static double FrameTime(int Dots)
+{
+    const int N = 20000;
+    OLED_SetTransport(&nullTransport);
+    double t0 = NowUs();
+    for (int n = 0; n < N; n++)
+    {
+        BeginFrame();
+        MenuFrame(n, Dots);
+#if OLED_USE_DISPLAY_LIST
+        OLED_ListRender();
+#else
+        OLED_UpdateDirty();
+#endif
+    }
+    return (NowUs() - t0) / N;
+}
+
+int main(int argc, char **argv)
+{
+    const int Frames = 3000;
+
+    srand(14);
+    for (unsigned i = 0; i < sizeof(image); i++) image[i] = (uint8_t)rand();
+    for (unsigned i = 0; i < sizeof(sprite); i++) sprite[i] = (uint8_t)rand();
+
+    panel_reset();
+    OLED_Init();
+
+#if !OLED_USE_DISPLAY_LIST
+    /*整屏显存版本只作为参照：dump 输出每帧屏幕内容，bench 输出两种帧的耗时*/
+    if (argc > 1 && strcmp(argv[1], "dump") == 0)
+    {
+        for (int f = 0; f < Frames; f++)
+        {
+            RandomFrame();
+            Frame shown;
+            for (int y = 0; y < OLED_HEIGHT; y++)
+                for (int x = 0; x < OLED_WIDTH; x++) FrameSetPixel(shown, x, y, panel_pixel(x, y));
+            fwrite(shown, 1, sizeof(shown), stdout);
+        }
+        return 0;
+    }
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        double menu = FrameTime(0);
+        double dots = FrameTime(1);
+        printf("%f %f\n", menu, dots);
+        return 0;
+    }
+    printf("usage: %s dump|bench\n", argv[0]);
+    return 1;
+#else
+    char cmd[512], name[32];
+    const char *slash = strrchr(argv[0], '/');
+    if (OLED_STRIP_PAGES == 2) snprintf(name, sizeof(name), "list");
+    else                       snprintf(name, sizeof(name), "list_s%d", OLED_STRIP_PAGES);
+    snprintf(cmd, sizeof(cmd), "%.*stest_list_ref dump", slash ? (int)(slash - argv[0] + 1) : 0, argv[0]);
+    FILE *ref = popen(cmd, "r");
+    EXPECT(ref != NULL, "cannot run %s", cmd);
+    if (ref == NULL) return TestReport(name);
+
+    OLED_ListStat stat;
+    int peak = 0;
+    for (int f = 0; f < Frames; f++)
+    {
+        RandomFrame();
+        OLED_GetListStat(&stat);
+        EXPECT(stat.Dropped == 0, "frame %d: %d commands dropped (%d bytes used)", f, stat.Dropped, stat.Bytes);
+        peak = stat.Bytes > peak ? stat.Bytes : peak;
+
+        Frame expect;
+        if (fread(expect, 1, sizeof(expect), ref) != sizeof(expect))
+        {
+            EXPECT(0, "frame %d: reference stream ended", f);
+            break;
+        }
+        int x0 = -1, y0 = -1;
+        for (int y = 0; y < OLED_HEIGHT && x0 < 0; y++)
+            for (int x = 0; x < OLED_WIDTH && x0 < 0; x++)
+                if (panel_pixel(x, y) != FramePixel(expect, x, y)) { x0 = x; y0 = y; }
+        EXPECT(x0 < 0, "frame %d (strip %d pages): panel differs from the full-buffer path at (%d,%d)", f, OLED_STRIP_PAGES, x0, y0);
+        EXPECT(panel.framingErrors == 0, "frame %d: %ld framing errors", f, panel.framingErrors);
+    }
+    pclose(ref);
+
+    /*逐点画出的整屏棋盘格合并为一条点阵命令*/
+    OLED_ListBegin();
+    Lattice(0, 0, 48, 48, 0, 1);
+    OLED_GetListStat(&stat);
+    EXPECT(stat.Commands == 1 && stat.Dropped == 0, "full-screen lattice: %d commands, %d bytes", stat.Commands, stat.Bytes);
+    int latticeBytes = stat.Bytes;
+    OLED_ListRender();
+
+    if (WantBench(argc, argv))
+    {
+        double menu = FrameTime(0), dots = FrameTime(1), refMenu = 0, refDots = 0;
+        OLED_ListBegin();
+        MenuFrame(0, 0);
+        OLED_GetListStat(&stat);
+        snprintf(cmd, sizeof(cmd), "%.*stest_list_ref bench", slash ? (int)(slash - argv[0] + 1) : 0, argv[0]);
+        ref = popen(cmd, "r");
+        if (ref == NULL || fscanf(ref, "%lf %lf", &refMenu, &refDots) != 2) printf("  cannot run %s\n", cmd);
+        if (ref != NULL) pclose(ref);
+        printf("  strip %d pages: menu frame %.2f us (full buffer + diff %.2f us), menu + full-screen dots %.2f us (%.2f us)\n",
+               OLED_STRIP_PAGES, menu, refMenu, dots, refDots);
+        printf("  RAM: strip %d B + list %d B (full buffer + front mirror %d B); menu frame uses %d list bytes, "
+               "full-screen lattice %d, random frames up to %d\n",
+               OLED_STRIP_PAGES * OLED_WIDTH, OLED_LIST_SIZE, 2 * OLED_PAGES * OLED_WIDTH, stat.Bytes, latticeBytes, peak);
+    }
+    return TestReport(name);
+#endif
+}
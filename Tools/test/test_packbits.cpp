@@ -0,0 +1,119 @@
+/**
+ * @file test_packbits.cpp
+ * @brief PackBits 压缩图像 OLED_ShowImagePacked 与 OLED_ShowImage 显示原始取模逐像素对比
+ * @note 同一份源文件编译两次：test_packbits_gen(-DPACKBITS_GEN)输出随机取模图像的C源文件(build/packbits_raw.c)，
+ *       Tools/oled_packbits.py --emit 把其中每个数组压缩成 xxx_Packed[](build/packbits_packed.h)，
+ *       test_packbits 把两者编译进来对比. 图像含长重复游程(超过128字节、跨页)与原样游程，
+ *       尺寸随机(含 Height%8 不为0 与 Height 为0)，取模最后一页 Height 以下的多余位是随机的.
+ * @note 每次对比：随机的显存内容、四种混合方式、任意(含负数、不按页对齐)的X/Y、一半的情况带随机裁剪区；
+ *       OLED_ShowImage 显示多余位清0后的原始数组(OLED_ShowImagePacked 不显示多余位)
+ */
+
+#define IMAGES  64
+
+#ifdef PACKBITS_GEN
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*取模数据：各种长度的重复游程与随机字节交替，按页连续(游程可以跨页)*/
+int main(void)
+{
+    int size[IMAGES][2];
+
+    srand(9);
+    for (int k = 0; k < IMAGES; k++)
+    {
+        int w = 1 + rand() % 96, h = (k % 8 == 0) ? 0 : 1 + rand() % 96;
+        int bytes = ((h - 1) / 8 + 1) * w;
+        if (h == 0) bytes = w;
+        size[k][0] = w;
+        size[k][1] = h;
+
+        printf("const unsigned char Img%d[] = {", k);
+        for (int i = 0; i < bytes; )
+        {
+            int n = 1 + rand() % ((rand() % 4 == 0) ? 200 : 12);
+            int fill = (rand() % 3 == 0) ? -1 : ((rand() % 2) ? 0x00 : ((rand() % 2) ? 0xFF : rand() & 0xFF));
+            for (; n > 0 && i < bytes; n--, i++) printf("%s0x%02X", i ? "," : "", (fill < 0) ? rand() & 0xFF : fill);
+        }
+        printf("};\n");
+    }
+    printf("\nstatic const uint8_t ImgSize[%d][2] = {", IMAGES);
+    for (int k = 0; k < IMAGES; k++) printf("%s{%d,%d}", k ? "," : "", size[k][0], size[k][1]);
+    printf("};\n");
+    printf("static const unsigned char *const ImgRaw[%d] = {", IMAGES);
+    for (int k = 0; k < IMAGES; k++) printf("%sImg%d", k ? "," : "", k);
+    printf("};\n");
+    printf("static const unsigned char *const ImgPacked[%d] = {", IMAGES);
+    for (int k = 0; k < IMAGES; k++) printf("%sImg%d_Packed", k ? "," : "", k);
+    printf("};\n");
+    return 0;
+}
+
+#else
+
+#include "harness.h"
+#include "dvc_oled_data.h"
+#include "packbits_packed.h"
+#include "packbits_raw.c"
+
+static const char *const modeName[4] = {"COPY", "OR", "XOR", "ANDNOT"};
+
+int main(int argc, char **argv)
+{
+    static uint8_t masked[OLED_PAGES * OLED_WIDTH];
+    Frame before, expect;
+    long cases = 0;
+
+    srand(9);
+    for (int k = 0; k < IMAGES; k++)
+    {
+        uint8_t w = ImgSize[k][0], h = ImgSize[k][1];
+        int rows = (h - 1) / 8 + 1;
+        if (h == 0) rows = 1;
+
+        /*多余位清0：取模最后一页只留 Height 以内的行*/
+        memcpy(masked, ImgRaw[k], (size_t)rows * w);
+        for (int i = 0; i < w; i++) masked[(rows - 1) * w + i] &= (uint8_t)(0xFF >> (rows * 8 - h));
+
+        for (int t = 0; t < 300; t++)
+        {
+            int16_t x = (int16_t)Rand(-w - 4, OLED_WIDTH + 4), y = (int16_t)Rand(-h - 12, OLED_HEIGHT + 4);
+            unsigned char mode = (unsigned char)Rand(0, 3);
+            int clipped = Rand(0, 1);
+            int16_t cx = (int16_t)Rand(-10, 90), cy = (int16_t)Rand(-10, 90);
+            uint8_t cw = (uint8_t)Rand(0, 100), ch = (uint8_t)Rand(0, 100);
+
+            FrameRandom(before);
+            memcpy(OLED_DisplayBuf, before, sizeof(before));
+            if (clipped) OLED_PushClip(cx, cy, cw, ch);
+            OLED_ShowImage(x, y, w, h, masked, mode);
+            memcpy(expect, OLED_DisplayBuf, sizeof(expect));
+
+            memcpy(OLED_DisplayBuf, before, sizeof(before));
+            OLED_ShowImagePacked(x, y, w, h, ImgPacked[k], mode);
+            if (clipped) OLED_PopClip();
+
+            int dx = 0, dy = 0;
+            EXPECT(!FrameDiff(OLED_DisplayBuf, expect, &dx, &dy),
+                   "image %d (%dx%d) at (%d,%d) %s%s: packed differs from OLED_ShowImage at (%d,%d)",
+                   k, w, h, x, y, modeName[mode], clipped ? " clipped" : "", dx, dy);
+            cases++;
+        }
+    }
+    printf("  %d images packed by oled_packbits.py, %ld placements match OLED_ShowImage\n", IMAGES, cases);
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 20000;
+        double t0 = NowUs();
+        for (int i = 0; i < N; i++) OLED_ShowImagePacked((int16_t)(i & 7), 0, 96, 96, Fonzo_Packed, OLED_IMAGE_COPY);
+        double t1 = NowUs();
+        Touch(OLED_DisplayBuf);
+        printf("  ShowImagePacked 96x96 (Fonzo_Packed): %.2f us\n", (t1 - t0) / N);
+    }
+    return TestReport("packbits");
+}
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ * @file test_polygon.cpp
+ * @brief 多边形扫描线填充(活动边表，奇偶规则)与优化前逐点 OLED_pnpoly 对比，实心三角形与优化前逐像素对比
+ */
+
+#include "harness.h"
+#include "ref_arkoled.h"
+
+extern uint8_t REF_OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+uint8_t REF_OLED_pnpoly(uint8_t nvert, int16_t *vertx, int16_t *verty, int16_t testx, int16_t testy);
+
+/*基准：实心按整屏逐点 pnpoly 判断，空心按边(不含端点)加顶点*/
+static void RefPolygon(int16_t *vx, int16_t *vy, int n, int filled, int op)
+{
+    if (filled)
+    {
+        for (int y = 0; y < OLED_HEIGHT; y++)
+            for (int x = 0; x < OLED_WIDTH; x++)
+                if (REF_OLED_pnpoly(n, vx, vy, x, y)) REF_OLED_DrawPoint(x, y, op);
+        return;
+    }
+    for (int i = 0, j = n - 1; i < n; j = i++)
+    {
+        if (n > 1) REF_OLED_DrawLine(vx[j], vy[j], vx[i], vy[i], 0, op);
+        REF_OLED_DrawPoint(vx[i], vy[i], op);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    srand(11);
+    for (int it = 0; it < 30000; it++)
+    {
+        FrameRandom(OLED_DisplayBuf);
+        memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+        int mode = Rand(0, 1), op = Rand(0, 1), filled = Rand(0, 3) != 0;
+        OLED_SetDrawMode((OLED_DrawMode)mode);
+        REF_OLED_SetDrawMode((REF_OLED_DrawMode)mode);
+
+        /*十分之一的顶点远在屏幕外；五分之一的边是水平边(扫描线的特殊情况)*/
+        int span = (it % 10 == 0) ? 2000 : 140;
+        int16_t vx[OLED_POLYGON_MAX_VERTICES], vy[OLED_POLYGON_MAX_VERTICES];
+        int n = Rand(1, OLED_POLYGON_MAX_VERTICES);
+        for (int i = 0; i < n; i++)
+        {
+            vx[i] = (int16_t)(Rand(-span / 2, span / 2) + 48);
+            vy[i] = (int16_t)(Rand(-span / 2, span / 2) + 48);
+            if (i && Rand(0, 4) == 0) vy[i] = vy[i - 1];
+        }
+        const char *what;
+        if (n == 3 && filled && Rand(0, 1))
+        {
+            what = "DrawTriangle(filled)";
+            OLED_DrawTriangle(vx[0], vy[0], vx[1], vy[1], vx[2], vy[2], OLED_FILLED, op);
+            REF_OLED_DrawTriangle(vx[0], vy[0], vx[1], vy[1], vx[2], vy[2], OLED_FILLED, op);
+        }
+        else
+        {
+            what = "DrawPolygon";
+            OLED_DrawPolygon(vx, vy, n, filled, op);
+            RefPolygon(vx, vy, n, filled, op);
+        }
+        int x = 0, y = 0;
+        int diff = FrameDiff(OLED_DisplayBuf, REF_OLED_DisplayBuf, &x, &y);
+        EXPECT(!diff, "%s iter %d n=%d filled=%d mode=%d op=%d, first diff (%d,%d)", what, it, n, filled, mode, op, x, y);
+    }
+
+    /*超过 OLED_POLYGON_MAX_VERTICES 个顶点时不绘制*/
+    {
+        int16_t vx[OLED_POLYGON_MAX_VERTICES + 1], vy[OLED_POLYGON_MAX_VERTICES + 1];
+        for (int i = 0; i <= OLED_POLYGON_MAX_VERTICES; i++) { vx[i] = (int16_t)(i * 5); vy[i] = (int16_t)(i * i % 90); }
+        memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+        memset(REF_OLED_DisplayBuf, 0, sizeof(REF_OLED_DisplayBuf));
+        OLED_DrawPolygon(vx, vy, OLED_POLYGON_MAX_VERTICES + 1, OLED_FILLED, 1);
+        EXPECT(memcmp(OLED_DisplayBuf, REF_OLED_DisplayBuf, sizeof(OLED_DisplayBuf)) == 0, "DrawPolygon drew %d vertices",
+               OLED_POLYGON_MAX_VERTICES + 1);
+    }
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 20000;
+        static int16_t star_x[] = {48, 58, 92, 64, 76, 48, 20, 32, 4, 38};
+        static int16_t star_y[] = {4, 36, 36, 56, 92, 70, 92, 56, 36, 36};
+        OLED_SetDrawMode(OLED_DRAWMODE_NORMAL);
+        REF_OLED_SetDrawMode(REF_OLED_DRAWMODE_NORMAL);
+
+        double t0 = NowUs();
+        for (int i = 0; i < N; i++) { OLED_DrawTriangle(0, 0, 95, 40 + (i & 7), 20, 95, OLED_FILLED, 1); Touch(OLED_DisplayBuf); }
+        double t1 = NowUs();
+        for (int i = 0; i < N; i++) { REF_OLED_DrawTriangle(0, 0, 95, 40 + (i & 7), 20, 95, OLED_FILLED, 1); Touch(REF_OLED_DisplayBuf); }
+        double t2 = NowUs();
+        printf("  filled triangle 96x96: %.2f us (per-pixel pnpoly %.2f us)\n", (t1 - t0) / N, (t2 - t1) / N);
+
+        t0 = NowUs();
+        for (int i = 0; i < N; i++) { OLED_DrawPolygon(star_x, star_y, 10, OLED_FILLED, 1); Touch(OLED_DisplayBuf); }
+        t1 = NowUs();
+        for (int i = 0; i < N / 10; i++) { RefPolygon(star_x, star_y, 10, OLED_FILLED, 1); Touch(REF_OLED_DisplayBuf); }
+        t2 = NowUs();
+        printf("  filled 10-point star:  %.2f us (per-pixel pnpoly %.2f us)\n", (t1 - t0) / N, (t2 - t1) / (N / 10));
+    }
+    return TestReport("polygon");
+}
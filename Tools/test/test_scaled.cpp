@@ -0,0 +1,116 @@
+/**
+ * @file test_scaled.cpp
+ * @brief 最近邻缩放显示(OLED_ShowImageScaled)与逐点 16.16 像素中心采样对比；不缩放时与优化前 OLED_ShowImage 对比
+ */
+
+#include "harness.h"
+#include "ref_arkoled.h"
+
+extern uint8_t REF_OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+
+static uint8_t image[60 * 8];
+
+static int ImagePixel(int W, int i, int j)
+{
+    return (image[(j >> 3) * W + i] >> (j & 7)) & 1;
+}
+
+/**
+  * @brief 基准：显示矩形内逐点按像素中心取原图，再按混合方式调用优化前的 OLED_DrawPoint
+  * @note 优化前没有裁剪区，裁剪区外的像素由这里跳过
+  */
+static void RefScaled(int X, int Y, int W, int H, int DW, int DH, int Mode, int cx0, int cy0, int cx1, int cy1)
+{
+    if (DW == 0 || DH == 0) return;
+    uint32_t stepX = ((uint32_t)W << 16) / DW, stepY = ((uint32_t)H << 16) / DH;
+    REF_OLED_SetDrawMode(Mode == OLED_IMAGE_XOR ? REF_OLED_DRAWMODE_XOR : REF_OLED_DRAWMODE_NORMAL);
+    for (int i = 0; i < DW; i++)
+        for (int j = 0; j < DH; j++)
+        {
+            int x = X + i, y = Y + j;
+            if (x < cx0 || x > cx1 || y < cy0 || y > cy1) continue;
+            int v = ImagePixel(W, (int)((i * stepX + (stepX >> 1)) >> 16), (int)((j * stepY + (stepY >> 1)) >> 16));
+            switch (Mode)
+            {
+                case OLED_IMAGE_COPY:   REF_OLED_DrawPoint(x, y, v); break;
+                case OLED_IMAGE_OR:     if (v) REF_OLED_DrawPoint(x, y, 1); break;
+                case OLED_IMAGE_XOR:    if (v) REF_OLED_DrawPoint(x, y, 1); break;
+                case OLED_IMAGE_ANDNOT: if (v) REF_OLED_DrawPoint(x, y, 0); break;
+            }
+        }
+}
+
+static void RandomImage(int W, int H)
+{
+    for (int i = 0; i < (H + 7) / 8 * W; i++) image[i] = (uint8_t)rand();
+}
+
+int main(int argc, char **argv)
+{
+    srand(20);
+
+    /*任意缩放比例、四种混合方式，一半在随机裁剪区内*/
+    for (int it = 0; it < 100000; it++)
+    {
+        FrameRandom(OLED_DisplayBuf);
+        memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+        int W = Rand(1, 60), H = Rand(1, 60), DW = Rand(0, 120), DH = Rand(0, 120);
+        int X = Rand(-60, 100), Y = Rand(-60, 100), mode = Rand(0, 3);
+        RandomImage(W, H);
+
+        int cx0 = 0, cy0 = 0, cx1 = OLED_WIDTH - 1, cy1 = OLED_HEIGHT - 1;
+        int clip = Rand(0, 1);
+        if (clip)
+        {
+            int cx = Rand(0, 95), cy = Rand(0, 95), cw = Rand(1, 96), ch = Rand(1, 96);
+            OLED_PushClip(cx, cy, cw, ch);
+            cx0 = cx; cy0 = cy;
+            cx1 = cx + cw - 1 < cx1 ? cx + cw - 1 : cx1;
+            cy1 = cy + ch - 1 < cy1 ? cy + ch - 1 : cy1;
+        }
+        OLED_ShowImageScaled(X, Y, W, H, image, DW, DH, mode);
+        if (clip) OLED_PopClip();
+        RefScaled(X, Y, W, H, DW, DH, mode, cx0, cy0, cx1, cy1);
+
+        int x = 0, y = 0;
+        int diff = FrameDiff(OLED_DisplayBuf, REF_OLED_DisplayBuf, &x, &y);
+        EXPECT(!diff, "ShowImageScaled iter %d (%d,%d) %dx%d -> %dx%d mode=%d clip=%d, first diff (%d,%d)",
+               it, X, Y, W, H, DW, DH, mode, clip, x, y);
+    }
+
+    /*1:1 时与优化前的 OLED_ShowImage 完全一致(覆盖/叠加；取模最后一页高度以外的位清零，
+      因为 OLED_ShowImage 会把这些位也写进显存)*/
+    for (int it = 0; it < 50000; it++)
+    {
+        FrameRandom(OLED_DisplayBuf);
+        memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+        int W = Rand(1, 60), H = Rand(1, 60), X = Rand(-60, 100), Y = Rand(-60, 100), mix = Rand(0, 1);
+        RandomImage(W, H);
+        if (H & 7)
+            for (int i = 0; i < W; i++) image[(H >> 3) * W + i] &= (uint8_t)((1 << (H & 7)) - 1);
+
+        OLED_ShowImageScaled(X, Y, W, H, image, W, H, mix ? OLED_IMAGE_OR : OLED_IMAGE_COPY);
+        REF_OLED_ShowImage(X, Y, W, H, image, mix);
+        int x = 0, y = 0;
+        int diff = FrameDiff(OLED_DisplayBuf, REF_OLED_DisplayBuf, &x, &y);
+        EXPECT(!diff, "ShowImageScaled 1:1 iter %d (%d,%d) %dx%d mix=%d, first diff (%d,%d)", it, X, Y, W, H, mix, x, y);
+    }
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 100000;
+        RandomImage(32, 32);
+        double t0 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ShowImageScaled(28, 18 + (n & 7), 32, 32, image, 40, 40, OLED_IMAGE_OR); Touch(OLED_DisplayBuf); }
+        double t1 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ShowImageScaled(28, 18 + (n & 7), 32, 32, image, 32, 32, OLED_IMAGE_OR); Touch(OLED_DisplayBuf); }
+        double t2 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ShowImage(28, 18 + (n & 7), 32, 32, image, OLED_IMAGE_OR); Touch(OLED_DisplayBuf); }
+        double t3 = NowUs();
+        for (int n = 0; n < N / 10; n++) { RefScaled(28, 18 + (n & 7), 32, 32, 40, 40, OLED_IMAGE_OR, 0, 0, 95, 95); Touch(REF_OLED_DisplayBuf); }
+        double t4 = NowUs();
+        printf("  32x32 icon: scaled to 40x40 %.2f us, scaled 1:1 %.2f us, OLED_ShowImage %.2f us (per-pixel 40x40 %.2f us)\n",
+               (t1 - t0) / N, (t2 - t1) / N, (t3 - t2) / N, (t4 - t3) / (N / 10));
+    }
+    return TestReport("scaled");
+}
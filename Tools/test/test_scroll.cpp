@@ -0,0 +1,100 @@
+/**
+ * @file test_scroll.cpp
+ * @brief 显存区域平移(OLED_ScrollRegion)与逐像素搬移对比，含裁剪区、屏幕边缘和超过区域高度的平移
+ * @note bench：列表滚动一帧(整屏平移3行再补画进入的3行)与整屏重画的耗时对比
+ */
+
+#include "harness.h"
+
+/*基准：区域内逐像素从 y-Lines 处取值，来源在区域外时补0*/
+static void RefScroll(Frame f, int x0, int y0, int x1, int y1, int Lines)
+{
+    Frame before;
+    memcpy(before, f, sizeof(before));
+    for (int x = x0; x <= x1; x++)
+        for (int y = y0; y <= y1; y++)
+        {
+            int sy = y - Lines;
+            FrameSetPixel(f, x, y, (sy >= y0 && sy <= y1) ? FramePixel(before, x, sy) : 0);
+        }
+}
+
+/*一屏9行的列表，Offset 为向上滚过的像素数(0~11)；Clip 不为0时只画最下面3行*/
+static void DrawList(int Offset, int Clip)
+{
+    char s[16];
+    if (Clip) OLED_PushClip(0, OLED_HEIGHT - 3, OLED_WIDTH, 3);
+    for (int k = 0; k < 9; k++)
+    {
+        snprintf(s, sizeof(s), "- Item %d", k);
+        OLED_ShowString(2, (int16_t)(k * 12 + 2 - Offset), s, OLED_6X8);
+    }
+    OLED_ShowString(60, (int16_t)(2 - Offset), (char *)"ON", OLED_6X8);
+    if (Clip) OLED_PopClip();
+}
+
+int main(int argc, char **argv)
+{
+    srand(17);
+    for (int it = 0; it < 100000; it++)
+    {
+        FrameRandom(OLED_DisplayBuf);
+        Frame expect;
+        memcpy(expect, OLED_DisplayBuf, sizeof(expect));
+
+        int X = Rand(-20, 100), Y = Rand(-20, 100), W = Rand(0, 120), H = Rand(0, 120), lines = Rand(-100, 100);
+        int x0 = X, y0 = Y, x1 = X + W - 1, y1 = Y + H - 1;
+        int clip = Rand(0, 1);
+        if (clip)
+        {
+            int cx = Rand(0, 95), cy = Rand(0, 95), cw = Rand(1, 96), ch = Rand(1, 96);
+            OLED_PushClip(cx, cy, cw, ch);
+            if (x0 < cx) x0 = cx;
+            if (y0 < cy) y0 = cy;
+            if (x1 > cx + cw - 1) x1 = cx + cw - 1;
+            if (y1 > cy + ch - 1) y1 = cy + ch - 1;
+        }
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 > OLED_WIDTH - 1) x1 = OLED_WIDTH - 1;
+        if (y1 > OLED_HEIGHT - 1) y1 = OLED_HEIGHT - 1;
+
+        OLED_ScrollRegion(X, Y, W, H, lines);
+        if (clip) OLED_PopClip();
+        if (lines) RefScroll(expect, x0, y0, x1, y1, lines);
+
+        int x = 0, y = 0;
+        int diff = FrameDiff(OLED_DisplayBuf, expect, &x, &y);
+        EXPECT(!diff, "ScrollRegion iter %d (%d,%d) %dx%d lines=%d clip=%d, first diff (%d,%d)", it, X, Y, W, H, lines, clip, x, y);
+    }
+
+    /*平移3行再补画进入的3行，结果与整屏重画相同*/
+    for (int i = 0; i < 12; i++)
+    {
+        OLED_Clear();
+        DrawList(i, 0);
+        OLED_ScrollRegion(0, 0, OLED_WIDTH, OLED_HEIGHT, -3);
+        DrawList(i + 3, 1);
+        Frame shifted;
+        memcpy(shifted, OLED_DisplayBuf, sizeof(shifted));
+        OLED_Clear();
+        DrawList(i + 3, 0);
+        int x = 0, y = 0;
+        EXPECT(!FrameDiff(shifted, OLED_DisplayBuf, &x, &y), "list offset %d: shift+band differs from redraw at (%d,%d)", i, x, y);
+    }
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 20000;
+        double t0 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_Clear(); DrawList(n % 12, 0); Touch(OLED_DisplayBuf); }
+        double t1 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ScrollRegion(0, 0, OLED_WIDTH, OLED_HEIGHT, -3); DrawList(n % 12, 1); Touch(OLED_DisplayBuf); }
+        double t2 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ScrollRegion(0, 0, OLED_WIDTH, OLED_HEIGHT, -3); Touch(OLED_DisplayBuf); }
+        double t3 = NowUs();
+        printf("  list scroll frame: full redraw %.2f us, shift 3 rows + draw band %.2f us (shift alone %.2f us)\n",
+               (t1 - t0) / N, (t2 - t1) / N, (t3 - t2) / N);
+    }
+    return TestReport("scroll");
+}
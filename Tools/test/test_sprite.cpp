@@ -0,0 +1,86 @@
+/**
+ * @file test_sprite.cpp
+ * @brief 带遮罩的精灵(OLED_ShowSprite 页字节拼接)与优化前逐点 OLED_DrawPoint 对比，含屏幕边缘与裁剪区
+ */
+
+#include "harness.h"
+#include "ref_arkoled.h"
+
+extern uint8_t REF_OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+
+static uint8_t sprite[2 * 5 * 40];
+
+/*精灵第 Plane 平面(0=图像，1=遮罩)的像素*/
+static int SpritePixel(int W, int H, int Plane, int i, int j)
+{
+    int rows = (H + 7) / 8;
+    return (sprite[Plane * rows * W + (j >> 3) * W + i] >> (j & 7)) & 1;
+}
+
+/**
+  * @brief 基准：遮罩内逐点调用优化前的 OLED_DrawPoint
+  * @note 优化前没有裁剪区，裁剪区外的像素由这里跳过
+  */
+static void RefSprite(int X, int Y, int W, int H, int Mode, int cx0, int cy0, int cx1, int cy1)
+{
+    REF_OLED_SetDrawMode(Mode == OLED_SPRITE_XOR ? REF_OLED_DRAWMODE_XOR : REF_OLED_DRAWMODE_NORMAL);
+    for (int i = 0; i < W; i++)
+        for (int j = 0; j < H; j++)
+        {
+            int x = X + i, y = Y + j;
+            if (x < cx0 || x > cx1 || y < cy0 || y > cy1 || !SpritePixel(W, H, 1, i, j)) continue;
+            int img = SpritePixel(W, H, 0, i, j);
+            switch (Mode)
+            {
+                case OLED_SPRITE_MASK:   REF_OLED_DrawPoint(x, y, img); break;
+                case OLED_SPRITE_XOR:    if (img) REF_OLED_DrawPoint(x, y, 1); break;
+                case OLED_SPRITE_INVERT: REF_OLED_DrawPoint(x, y, !img); break;
+            }
+        }
+}
+
+int main(int argc, char **argv)
+{
+    srand(19);
+    for (int it = 0; it < 100000; it++)
+    {
+        FrameRandom(OLED_DisplayBuf);
+        memcpy(REF_OLED_DisplayBuf, OLED_DisplayBuf, sizeof(OLED_DisplayBuf));
+        for (unsigned i = 0; i < sizeof(sprite); i++) sprite[i] = (uint8_t)rand();
+
+        int W = Rand(0, 40), H = Rand(0, 40), X = Rand(-45, 100), Y = Rand(-45, 100), mode = Rand(0, 2);
+        int cx0 = 0, cy0 = 0, cx1 = OLED_WIDTH - 1, cy1 = OLED_HEIGHT - 1;
+        int clip = Rand(0, 1);
+        if (clip)
+        {
+            int cx = Rand(0, 95), cy = Rand(0, 95), cw = Rand(1, 96), ch = Rand(1, 96);
+            OLED_PushClip(cx, cy, cw, ch);
+            cx0 = cx; cy0 = cy;
+            cx1 = cx + cw - 1 < cx1 ? cx + cw - 1 : cx1;
+            cy1 = cy + ch - 1 < cy1 ? cy + ch - 1 : cy1;
+        }
+        OLED_ShowSprite(X, Y, W, H, sprite, mode);
+        if (clip) OLED_PopClip();
+        RefSprite(X, Y, W, H, mode, cx0, cy0, cx1, cy1);
+
+        int x = 0, y = 0;
+        int diff = FrameDiff(OLED_DisplayBuf, REF_OLED_DisplayBuf, &x, &y);
+        EXPECT(!diff, "ShowSprite iter %d (%d,%d) %dx%d mode=%d clip=%d, first diff (%d,%d)", it, X, Y, W, H, mode, clip, x, y);
+    }
+
+    if (WantBench(argc, argv))
+    {
+        const int N = 200000, M = 20000;
+        for (int i = 0; i < 64; i++) sprite[i] = (uint8_t)rand();
+        double t0 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ShowSprite((n * 7) % 80, ((n * 13) % 80) & ~7, 16, 16, sprite, OLED_SPRITE_MASK); Touch(OLED_DisplayBuf); }
+        double t1 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ShowSprite((n * 7) % 80, ((n * 13) % 80) | 3, 16, 16, sprite, OLED_SPRITE_MASK); Touch(OLED_DisplayBuf); }
+        double t2 = NowUs();
+        for (int n = 0; n < M; n++) { RefSprite((n * 7) % 80, ((n * 13) % 80) | 3, 16, 16, OLED_SPRITE_MASK, 0, 0, 95, 95); Touch(REF_OLED_DisplayBuf); }
+        double t3 = NowUs();
+        printf("  16x16 sprites/ms: page-aligned %.0f, unaligned %.0f (per-pixel %.0f)\n",
+               N / ((t1 - t0) / 1000), N / ((t2 - t1) / 1000), M / ((t3 - t2) / 1000));
+    }
+    return TestReport("sprite");
+}
@@ -0,0 +1,128 @@
+/**
+ * @file test_subset.cpp
+ * @brief 字库子集(OLED_USE_FONT_SUBSET)：源码中每个字符串用完整字库与子集显示，逐像素、逐宽度对比
+ * @note 同一份源文件编译两次：test_subset_ref 用完整字库，test_subset 用 -DOLED_USE_FONT_SUBSET=1 的
+ *       dvc_oled_font_subset.c. 字符串由 Tools/oled_fontsubset.py --strings 从 User/ 下的源码扫描生成
+ *       (build/subset_strings.h，转换说明已换成它会输出的字符)；test_subset 通过管道运行 test_subset_ref dump
+ *       取得完整字库显示的每一帧与各字体的宽度. 四种字体的 OLED_ShowText 与两种大小的 OLED_ShowString
+ *       画在同一帧的不同行上，超过屏宽的字符串分几帧横向平移显示.
+ *       另外检查子集中没有的ASCII字符显示为'?'
+ */
+
+#include "harness.h"
+#include "dvc_oled_data.h"
+#include "subset_strings.h"
+
+#define FONTS   4
+static const OLED_Font *const fonts[FONTS] = {&OLED_Font6x8, &OLED_Font8x16, &OLED_FontP8, &OLED_FontP16};
+static const char *const fontName[FONTS] = {"6x8", "8x16", "P8", "P16"};
+/*各行的纵坐标：12像素高的中文在6x8行上下各超出2像素，留出间隔*/
+static const int16_t fontY[FONTS] = {2, 14, 34, 46};
+
+/*字符串 S 整体左移 Dx 后画一帧*/
+static void DrawFrame(const char *S, int Dx)
+{
+    OLED_Clear();
+    for (int k = 0; k < FONTS; k++) OLED_ShowText((int16_t)-Dx, fontY[k], S, fonts[k]);
+    OLED_ShowString((int16_t)-Dx, 64, (char *)S, OLED_6X8);
+    OLED_ShowString((int16_t)-Dx, 74, (char *)S, OLED_8X16);
+}
+
+/*需要的帧数：最宽的一行(等宽 8x16 的 OLED_ShowString 每个字节8像素)按屏宽分段*/
+static int FrameCount(const char *S, const uint16_t *Width)
+{
+    int w = (int)strlen(S) * 8;
+    for (int k = 0; k < FONTS; k++) w = Width[k] > w ? Width[k] : w;
+    return w <= OLED_WIDTH ? 1 : (w + OLED_WIDTH - 1) / OLED_WIDTH;
+}
+
+int main(int argc, char **argv)
+{
+    const int Count = (int)(sizeof(SubsetStrings) / sizeof(SubsetStrings[0]));
+
+#if !OLED_USE_FONT_SUBSET
+    /*完整字库：只作为 test_subset 的参照，输出各字符串的宽度与每一帧*/
+    if (argc < 2 || strcmp(argv[1], "dump") != 0)
+    {
+        printf("usage: %s dump\n", argv[0]);
+        return 1;
+    }
+    for (int i = 0; i < Count; i++)
+    {
+        uint16_t width[FONTS];
+        for (int k = 0; k < FONTS; k++) width[k] = OLED_MeasureText(SubsetStrings[i], fonts[k]);
+        fwrite(width, sizeof(width), 1, stdout);
+        for (int f = 0; f < FrameCount(SubsetStrings[i], width); f++)
+        {
+            DrawFrame(SubsetStrings[i], f * OLED_WIDTH);
+            fwrite(OLED_DisplayBuf, 1, sizeof(OLED_DisplayBuf), stdout);
+        }
+    }
+    return 0;
+#else
+    (void)argc;
+    char cmd[512];
+    const char *slash = strrchr(argv[0], '/');
+    snprintf(cmd, sizeof(cmd), "%.*stest_subset_ref dump", slash ? (int)(slash - argv[0] + 1) : 0, argv[0]);
+    FILE *ref = popen(cmd, "r");
+    EXPECT(ref != NULL, "cannot run %s", cmd);
+    if (ref == NULL) return TestReport("subset");
+
+    int frames = 0;
+    for (int i = 0; i < Count; i++)
+    {
+        const char *s = SubsetStrings[i];
+        uint16_t width[FONTS];
+        if (fread(width, sizeof(width), 1, ref) != 1)
+        {
+            EXPECT(0, "reference stream ended at string %d", i);
+            break;
+        }
+        for (int k = 0; k < FONTS; k++)
+            EXPECT(OLED_MeasureText(s, fonts[k]) == width[k], "\"%s\" font %s: width %d with the subset, %d with the full font",
+                   s, fontName[k], OLED_MeasureText(s, fonts[k]), width[k]);
+        for (int f = 0; f < FrameCount(s, width); f++)
+        {
+            Frame expect;
+            if (fread(expect, 1, sizeof(expect), ref) != sizeof(expect))
+            {
+                EXPECT(0, "reference stream ended at string %d frame %d", i, f);
+                break;
+            }
+            DrawFrame(s, f * OLED_WIDTH);
+            frames++;
+            int x = 0, y = 0;
+            EXPECT(!FrameDiff(OLED_DisplayBuf, expect, &x, &y), "\"%s\" (x offset %d): differs from the full font at (%d,%d)",
+                   s, f * OLED_WIDTH, x, y);
+        }
+    }
+    pclose(ref);
+
+    /*子集中没有的ASCII字符按'?'显示，宽度也与'?'相同*/
+    int absent = 0;
+    for (char c = ' ' + 1; c <= '~'; c++)
+    {
+        int used = 0;
+        for (int i = 0; i < Count && !used; i++) used = strchr(SubsetStrings[i], c) != NULL;
+        if (used) continue;
+        absent++;
+        char one[2] = {c, 0};
+        for (int k = 0; k < FONTS; k++)
+        {
+            Frame q;
+            OLED_Clear();
+            OLED_ShowText(0, 0, (char *)"?", fonts[k]);
+            memcpy(q, OLED_DisplayBuf, sizeof(q));
+            OLED_Clear();
+            OLED_ShowText(0, 0, one, fonts[k]);
+            int x = 0, y = 0;
+            EXPECT(!FrameDiff(OLED_DisplayBuf, q, &x, &y) && OLED_MeasureText(one, fonts[k]) == OLED_MeasureText("?", fonts[k]),
+                   "'%c' is not in the subset but font %s does not show it as '?'", c, fontName[k]);
+        }
+    }
+
+    printf("  %d strings, %d frames match the full font; %d ASCII characters not in the subset show as '?'\n",
+           Count, frames, absent);
+    return TestReport("subset");
+#endif
+}
@@ -0,0 +1,165 @@
+/**
+ * @file test_transport.cpp
+ * @brief 传输后端与刷新状态机：屏幕模型收到的字节顺序、CS/DC帧格式、统计与回调
+ * @note 同一份源文件编译两次：test_transport 用软件SPI后端(同步)，
+ *       test_transport_dma 用 -DOLED_USE_HW_SPI_DMA=1 的硬件SPI+DMA后端(异步)。
+ *       异步时测试程序分小段推进DMA(panel_dma_run)，每段之间继续在 OLED_DisplayBuf 上绘制下一帧，
+ *       屏幕上必须是调用刷新函数那一刻的显存；完成中断(OLED_DMA_IRQHandler)由DMA模型在搬完时调用
+ */
+
+#include "harness.h"
+
+static long callbacks = 0, callbacksInIsr = 0;
+static Frame expect;
+
+static void OnFlushDone(void)
+{
+    callbacks++;
+    callbacksInIsr += panel_in_isr;
+}
+
+/*随便画点东西(也用来在DMA发送期间改动显存)*/
+static void Scribble(int Count)
+{
+    for (int k = 0; k < Count; k++)
+    {
+        switch (Rand(0, 3))
+        {
+            case 0: OLED_DrawRectangle(Rand(-10, 95), Rand(-10, 95), Rand(0, 40), Rand(0, 40), Rand(0, 1), Rand(0, 1)); break;
+            case 1: OLED_DrawLine(Rand(-10, 105), Rand(-10, 105), Rand(-10, 105), Rand(-10, 105), 1, Rand(0, 1)); break;
+            case 2: OLED_ShowString(Rand(-10, 95), Rand(-10, 95), (char *)"ArkUI", Rand(0, 1) ? OLED_6X8 : OLED_8X16); break;
+            case 3: OLED_DrawPoint(Rand(0, 95), Rand(0, 95), Rand(0, 1)); break;
+        }
+    }
+}
+
+/**
+  * @brief 等当前帧发完
+  * @note 同步后端返回时已经发完；异步后端每次推进1~300字节，其间继续画下一帧
+  */
+static void Drain(int ScribbleWhileBusy)
+{
+#if OLED_USE_HW_SPI_DMA
+    while (OLED_IsFlushBusy())
+    {
+        int n = panel_dma_run(Rand(1, 300));
+        EXPECT(n > 0, "flush busy but no DMA transfer in progress");
+        if (n == 0) break;
+        if (ScribbleWhileBusy) Scribble(1);
+    }
+#else
+    (void)ScribbleWhileBusy;
+    EXPECT(!OLED_IsFlushBusy(), "synchronous transport still busy after the flush call");
+#endif
+}
+
+/*屏幕上显示的像素与期望一致；Area 不为空时只比较区域内*/
+static int PanelMatches(const Frame f, int x0, int y0, int x1, int y1)
+{
+    for (int y = y0; y <= y1; y++)
+        for (int x = x0; x <= x1; x++)
+            if (panel_pixel(x, y) != FramePixel(f, x, y)) return 0;
+    return 1;
+}
+
+int main()
+{
+    panel_reset();
+    panel_fill(0xA5);
+    OLED_SetFlushCallback(OnFlushDone);
+    OLED_Init();
+    EXPECT(panel.on == 1, "display not switched on by OLED_Init");
+    EXPECT(panel.framingErrors == 0, "%ld framing errors during OLED_Init", panel.framingErrors);
+
+    /*上电后GDDRAM内容未知(这里填的是0xA5)，OLED_Init 之后第一次差分刷新必须整屏发送*/
+    OLED_UpdateDirty();
+    Drain(0);
+    EXPECT(PanelMatches(OLED_DisplayBuf, 0, 0, 95, 95), "first OLED_UpdateDirty after OLED_Init left stale GDDRAM");
+
+    /*字节顺序：每个字节不同的整帧，GDDRAM第p页第16+x列必须正好是 OLED_DisplayBuf[p][x]*/
+    for (int p = 0; p < OLED_PAGES; p++)
+        for (int x = 0; x < OLED_WIDTH; x++) OLED_DisplayBuf[p][x] = (uint8_t)(p * 37 + x * 11 + (x >> 3));
+    memcpy(expect, OLED_DisplayBuf, sizeof(expect));
+    OLED_Update();
+    Drain(1);
+    for (int p = 0; p < OLED_PAGES; p++)
+        for (int x = 0; x < OLED_WIDTH; x++)
+            EXPECT(panel.gddram[p][x + PANEL_COL_OFFSET] == expect[p][x], "byte order: page %d col %d is %02X, expected %02X",
+                   p, x, panel.gddram[p][x + PANEL_COL_OFFSET], expect[p][x]);
+
+    /*随机帧：三种刷新方式、对比度与反色命令、异步时发送期间继续绘制*/
+    srand(5);
+    long flushes = 0, asyncFlushes = 0;
+    callbacksInIsr = 0;
+    int inverted = 0;
+    for (int f = 0; f < 3000; f++)
+    {
+        Scribble(Rand(0, 6));
+        if (Rand(0, 9) == 0) OLED_SetContrast((uint8_t)Rand(0, 255));
+        if (Rand(0, 19) == 0) OLED_InvertDisplay(inverted = !inverted);
+
+        memcpy(expect, OLED_DisplayBuf, sizeof(expect));
+        Frame before;
+        for (int y = 0; y < OLED_HEIGHT; y++)
+            for (int x = 0; x < OLED_WIDTH; x++) FrameSetPixel(before, x, y, panel_pixel(x, y));
+
+        /*how：0 整屏，1 区域(完全在屏幕外时什么都不发)，2 只发命令，其余 差分*/
+        long cmd0 = panel.cmdBytes, data0 = panel.dataBytes, cb0 = callbacks;
+        int how = Rand(0, 9), ax = 0, ay = 0, aw = OLED_WIDTH, ah = OLED_HEIGHT;
+        int x0 = 0, y0 = 0, x1 = OLED_WIDTH - 1, y1 = OLED_HEIGHT - 1;
+        if (how == 1)
+        {
+            ax = Rand(-30, 100); ay = Rand(-30, 100); aw = Rand(0, 60); ah = Rand(0, 60);
+            x0 = ax < 0 ? 0 : ax; y0 = ay < 0 ? 0 : ay;
+            x1 = ax + aw - 1 > 95 ? 95 : ax + aw - 1; y1 = ay + ah - 1 > 95 ? 95 : ay + ah - 1;
+        }
+        int flushed = how != 2 && x0 <= x1 && y0 <= y1;
+        if (how == 0)      OLED_Update();
+        else if (how == 1) OLED_UpdateArea(ax, ay, aw, ah);
+        else if (how == 2) OLED_FlushCommands();
+        else               OLED_UpdateDirty();
+        OLED_FlushStat stat;
+        OLED_GetFlushStat(&stat);
+        if (flushed) { flushes++; asyncFlushes += OLED_USE_HW_SPI_DMA && stat.DataBytes > 0; }
+        Drain(1);
+
+        EXPECT(panel.framingErrors == 0, "frame %d (how=%d): %ld framing errors", f, how, panel.framingErrors);
+        panel.framingErrors = 0;
+        EXPECT(callbacks - cb0 == flushed, "frame %d (how=%d): %ld flush callbacks", f, how, callbacks - cb0);
+        if (flushed || how == 2)
+        {
+            EXPECT(panel.contrast == OLED_GetContrast(), "frame %d: panel contrast %d, set %d", f, panel.contrast, OLED_GetContrast());
+            EXPECT(panel.inverted == inverted, "frame %d: panel inverted %d, set %d", f, panel.inverted, inverted);
+        }
+        if (!flushed)
+        {
+            EXPECT(panel.dataBytes == data0, "frame %d: OLED_UpdateArea(%d,%d,%d,%d) outside the screen sent data", f, ax, ay, aw, ah);
+            continue;
+        }
+
+        EXPECT(panel.dataBytes - data0 == stat.DataBytes && panel.cmdBytes - cmd0 == stat.CmdBytes,
+               "frame %d (how=%d): panel got %ld data / %ld command bytes, OLED_GetFlushStat says %d / %d",
+               f, how, panel.dataBytes - data0, panel.cmdBytes - cmd0, stat.DataBytes, stat.CmdBytes);
+        if (how != 1)
+        {
+            EXPECT(PanelMatches(expect, 0, 0, 95, 95), "frame %d (how=%d): panel differs from the buffer at flush time", f, how);
+        }
+        else
+        {
+            /*区域内必须更新；区域外要么不变，要么是同一页里跟着一起发送的显存内容*/
+            EXPECT(PanelMatches(expect, x0, y0, x1, y1), "frame %d: OLED_UpdateArea(%d,%d,%d,%d) area not updated", f, ax, ay, aw, ah);
+            int stray = 0;
+            for (int y = 0; y < OLED_HEIGHT; y++)
+                for (int x = 0; x < OLED_WIDTH; x++)
+                    if (panel_pixel(x, y) != FramePixel(before, x, y) && panel_pixel(x, y) != FramePixel(expect, x, y)) stray++;
+            EXPECT(stray == 0, "frame %d: OLED_UpdateArea wrote %d pixels that are neither old nor new", f, stray);
+        }
+    }
+
+    /*回调：同步后端在调用者上下文里执行；异步后端有数据要发时在DMA完成中断里执行*/
+    EXPECT(callbacksInIsr == asyncFlushes, "%ld of %ld asynchronous flush callbacks ran in the DMA interrupt",
+           callbacksInIsr, asyncFlushes);
+    printf("  %s: %ld flushes, %ld callbacks in DMA interrupt, %ld CS windows\n",
+           OLED_USE_HW_SPI_DMA ? "SPI2+DMA" : "soft SPI", flushes, callbacksInIsr, panel.csFrames);
+    return TestReport(OLED_USE_HW_SPI_DMA ? "transport_dma" : "transport");
+}
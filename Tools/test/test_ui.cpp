@@ -0,0 +1,152 @@
+/**
+ * @file test_ui.cpp
+ * @brief ArkUI 列表平移滚动(ARKUI_LIST_SHIFT_SCROLL)与整帧重画逐帧对比
+ * @note 同一份源文件编译三次：test_ui 用 -DARKUI_LIST_SHIFT_SCROLL=0(每帧整帧重画，item坐标与原来一样向零取整)，
+ *       test_ui_floor 同样整帧重画但 -DARKUI_LIST_FLOOR_POS=1(坐标向下取整，平移滚动时的取整方式)，
+ *       test_ui_shift 用 -DARKUI_LIST_SHIFT_SCROLL=1. 三者跑同一串随机操作：按键(翻页、进出页面、修改数值)、
+ *       两帧之间改item的数值和标题、在显存上画别的东西(有时还自己刷新一次)；
+ *       test_ui_shift 通过管道运行 test_ui_floor dump 取得整帧重画的每一帧，逐帧比较显存.
+ *       三者在列表/自定义页面的每帧检查屏幕模型上的内容与显存一致(运行中的功能自己决定何时发送，不检查).
+ *       平移一帧与整帧重画的耗时对比见 test_scroll
+ */
+
+#include "harness.h"
+#include "arkui.h"
+#include "arkui_register.h"
+
+extern ArkUIPage_t page4;
+
+/*加长一页，让列表能连续滚动很多行；标题放在可写的缓冲里，测试中途会改*/
+static ArkUIItem_t extra[16];
+static bool extraFlag[16];
+static char extraTitle[16][12];
+
+static void AddLongList(void)
+{
+    ArkUIItemArgs_t args;
+    for (int i = 0; i < 16; i++)
+    {
+        memset(&args, 0, sizeof(args));
+        args.flag = &extraFlag[i];
+        snprintf(extraTitle[i], sizeof(extraTitle[i]), "Extra %d", i);
+        ArkUIAddItem(&page4, &extra[i], extraTitle[i], (i & 1) ? ITEM_SWITCH : ITEM_CHECKBOX, &args);
+    }
+}
+
+static ArkUIPage_t *CurrentPage(void)
+{
+    ArkUIPage_t *page = pageHead;
+    while (page->id != pageIndex[layer]) page = page->next;
+    return page;
+}
+
+/*两帧之间改当前页某个item的数值(开关/复选框取反，参数加一点)*/
+static void ChangeValue(void)
+{
+    ArkUIPage_t *page = CurrentPage();
+    int n = 0;
+    for (ArkUIItem_t *item = page->itemHead; item != NULL; item = item->next) n++;
+    int k = Rand(0, n - 1);
+    for (ArkUIItem_t *item = page->itemHead; item != NULL; item = item->next)
+    {
+        if (k-- != 0) continue;
+        if (item->flag != NULL)  *item->flag = !*item->flag;
+        if (item->param != NULL) *item->param += Rand(1, 9);
+        break;
+    }
+}
+
+#if ARKUI_LIST_SHIFT_SCROLL
+/*统计平移复用上一帧的次数(链接时用 --wrap 截住 ArkUI 对 OLED_ScrollRegion 的调用)*/
+static long shiftFrames = 0;
+extern "C" void __real_OLED_ScrollRegion(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, int16_t Dy);
+extern "C" void __wrap_OLED_ScrollRegion(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, int16_t Dy)
+{
+    shiftFrames++;
+    __real_OLED_ScrollRegion(X, Y, Width, Height, Dy);
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    const int Ticks = 20000;
+    int dump = argc > 1 && strcmp(argv[1], "dump") == 0;
+
+#if ARKUI_LIST_SHIFT_SCROLL
+    /*整帧重画的参照：同目录下的 test_ui_floor(取整方式相同)*/
+    char cmd[512];
+    const char *slash = strrchr(argv[0], '/');
+    snprintf(cmd, sizeof(cmd), "%.*stest_ui_floor dump", slash ? (int)(slash - argv[0] + 1) : 0, argv[0]);
+    FILE *ref = popen(cmd, "r");
+    EXPECT(ref != NULL, "cannot run %s", cmd);
+    if (ref == NULL) return TestReport("ui_shift");
+#endif
+
+    panel_reset();
+    ArkUIInit();
+    AddLongList();
+
+    srand(17);
+    for (int t = 0; t < Ticks; t++)
+    {
+        /*按键：大多是上下移动，偶尔进入/退出；运行中的功能(改数值、小游戏)随机退出*/
+        if (t % 3 == 0)
+        {
+            int r = Rand(0, 39);
+            if (r < 14)      opnDown = 1;
+            else if (r < 24) opnUp = 1;
+            else if (r < 26) opnClick = 1;
+            else if (r < 28) opnExit = 1;
+        }
+        if (functionIsRunning && Rand(0, 3) == 0) opnExit = 1;
+
+        /*两帧之间：数值、标题变化，其他代码在显存上画了东西(一半时候还自己刷新了一次)*/
+        if (Rand(0, 24) == 0) ChangeValue();
+        if (Rand(0, 39) == 0)
+        {
+            int i = Rand(0, 15);
+            snprintf(extraTitle[i], sizeof(extraTitle[i]), Rand(0, 1) ? "Extra %d" : "Item %d!", i);
+        }
+        if (Rand(0, 29) == 0)
+        {
+            OLED_DrawLine(Rand(0, 95), Rand(0, 95), Rand(0, 95), Rand(0, 95), 1, 1);
+            if (Rand(0, 1)) OLED_UpdateDirty();
+        }
+
+        int running = functionIsRunning;
+        ArkUI(20);
+
+        int x = 0, y = 0;
+        int shown = 1;
+        for (y = 0; y < OLED_HEIGHT && shown; y++)
+            for (x = 0; x < OLED_WIDTH && shown; x++) shown = panel_pixel(x, y) == FramePixel(OLED_DisplayBuf, x, y);
+        /*dump 时标准输出是帧数据，不打印；同样的检查在直接运行 test_ui_floor 时做*/
+        if (dump)
+        {
+            fwrite(OLED_DisplayBuf, 1, sizeof(OLED_DisplayBuf), stdout);
+            continue;
+        }
+        EXPECT(shown || running, "tick %d: panel differs from the buffer at (%d,%d)", t, x - 1, y - 1);
+#if ARKUI_LIST_SHIFT_SCROLL
+        Frame expect;
+        if (fread(expect, 1, sizeof(expect), ref) != sizeof(expect))
+        {
+            EXPECT(0, "tick %d: reference stream ended", t);
+            break;
+        }
+        int diff = FrameDiff(OLED_DisplayBuf, expect, &x, &y);
+        EXPECT(!diff, "tick %d (layer %d page %d index %d): differs from full redraw at (%d,%d)",
+               t, layer, pageIndex[layer], itemIndex[layer], x, y);
+#endif
+    }
+
+#if ARKUI_LIST_SHIFT_SCROLL
+    pclose(ref);
+    EXPECT(shiftFrames >= 100, "only %ld of %d ticks reused the previous frame", shiftFrames, Ticks);
+    printf("  %ld of %d ticks shifted the previous frame\n", shiftFrames, Ticks);
+    return TestReport("ui_shift");
+#else
+    if (dump) return 0;
+    return TestReport(ARKUI_LIST_FLOOR_POS ? "ui_floor" : "ui");
+#endif
+}
@@ -0,0 +1,336 @@
+/**
+ * @file test_utf8.cpp
+ * @brief OLED_ShowText / OLED_MeasureText 的UTF-8解码与非ASCII字形表(OLED_WideFont)：与逐字节的严格解码器、
+ *        线性查表、逐像素画字形的基准对比，含非法/截断/超长/代理项序列、表外的字、裁剪区与两种绘制模式
+ * @note 字形表是测试里随机生成的(12x12 与 11x16 两种)，不依赖工程里的 OLED_CJK12.
+ *       工程的 OLED_CJK12 另外检查：与 Tools/oled_cjkfont.py --rows 从 BDF 字库取出的行位图(build/cjk12_rows.h)
+ *       字数、码点相同，四种字体显示每个字都查得到、逐像素与行位图相同；界面字符串(build/subset_strings.h)
+ *       中的非ASCII字符都在表中.
+ *       bench：一行8个中文(12字与3500字的表)的查表+拼接耗时，与一行16个6x8 ASCII字符对比
+ */
+
+#include "harness.h"
+#include "dvc_oled_data.h"
+#include "cjk12_rows.h"
+#include "subset_strings.h"
+
+/*随机字形表：码点升序，字模随机*/
+struct WideTable
+{
+    unsigned short code[4000];
+    unsigned char glyph[4000 * 11 * 2];
+    OLED_WideFont font;
+};
+
+static void MakeTable(WideTable *t, int Count, int Width, int Height)
+{
+    int n = 0;
+    /*少量2字节字符(如带重音的拉丁字母、希腊字母)，其余在中日韩统一表意文字区*/
+    for (unsigned c = 0xC0; c < 0x400 && n < Count / 10; c += (unsigned)Rand(1, 20)) t->code[n++] = (unsigned short)c;
+    unsigned step = (0x9FFF - 0x4E00) / (unsigned)(Count - n);
+    for (unsigned c = 0x4E00; n < Count; c += (unsigned)Rand(1, (int)step)) t->code[n++] = (unsigned short)c;
+    for (int i = 0; i < Count * Width * ((Height + 7) / 8); i++) t->glyph[i] = (unsigned char)rand();
+    t->font.Code = t->code;
+    t->font.Glyphs = t->glyph;
+    t->font.Count = (unsigned short)Count;
+    t->font.Width = (unsigned char)Width;
+    t->font.Height = (unsigned char)Height;
+}
+
+/*UTF-8编码一个码点，返回字节数*/
+static int Encode(char *s, unsigned c)
+{
+    if (c < 0x80)    { s[0] = (char)c; return 1; }
+    if (c < 0x800)   { s[0] = (char)(0xC0 | c >> 6); s[1] = (char)(0x80 | (c & 0x3F)); return 2; }
+    if (c < 0x10000) { s[0] = (char)(0xE0 | c >> 12); s[1] = (char)(0x80 | (c >> 6 & 0x3F)); s[2] = (char)(0x80 | (c & 0x3F)); return 3; }
+    s[0] = (char)(0xF0 | c >> 18); s[1] = (char)(0x80 | (c >> 12 & 0x3F));
+    s[2] = (char)(0x80 | (c >> 6 & 0x3F)); s[3] = (char)(0x80 | (c & 0x3F));
+    return 4;
+}
+
+/**
+  * @brief 基准解码：按 Unicode 表3-7 的合法字节序列逐字节判断，不合法时返回0xFFFD并只跳过首字节
+  */
+static unsigned RefDecode(const unsigned char **p)
+{
+    const unsigned char *s = *p;
+    int n;
+    unsigned lo = 0x80, hi = 0xBF, c;
+    if (s[0] < 0x80) { *p += 1; return s[0]; }
+    if (s[0] >= 0xC2 && s[0] <= 0xDF)      { n = 1; c = s[0] & 0x1F; }
+    else if (s[0] >= 0xE0 && s[0] <= 0xEF) { n = 2; c = s[0] & 0x0F; if (s[0] == 0xE0) lo = 0xA0; if (s[0] == 0xED) hi = 0x9F; }
+    else if (s[0] >= 0xF0 && s[0] <= 0xF4) { n = 3; c = s[0] & 0x07; if (s[0] == 0xF0) lo = 0x90; if (s[0] == 0xF4) hi = 0x8F; }
+    else { *p += 1; return 0xFFFD; }
+    /*只有第二个字节的范围随首字节变化*/
+    if (s[1] < lo || s[1] > hi) { *p += 1; return 0xFFFD; }
+    for (int i = 1; i <= n; i++)
+    {
+        if (s[i] < 0x80 || s[i] > 0xBF) { *p += 1; return 0xFFFD; }
+        c = c << 6 | (s[i] & 0x3F);
+    }
+    *p += n + 1;
+    return c;
+}
+
+/*基准查表：线性查找*/
+static const unsigned char *RefLookup(const OLED_WideFont *w, unsigned c)
+{
+    for (int i = 0; i < w->Count; i++)
+        if (w->Code[i] == c) return w->Glyphs + i * w->Width * ((w->Height + 7) / 8);
+    return NULL;
+}
+
+/*裁剪区(屏幕内的闭区间)*/
+static int cx0, cy0, cx1, cy1;
+
+/**
+  * @brief 基准显示：ASCII与'?'逐字符调用 OLED_ShowText(单字符串，与 test_glyph 覆盖的路径相同)，
+  *        表中的字按字模逐像素画，纵向与字体居中对齐
+  * @return 总步进宽度
+  */
+static int RefShowText(int X, int Y, const char *String, const OLED_Font *Font, int Draw, int Xor)
+{
+    const unsigned char *p = (const unsigned char *)String;
+    int x = X;
+    char one[2] = {0, 0};
+    while (*p)
+    {
+        unsigned c = RefDecode(&p);
+        const unsigned char *g = (c >= 0x80 && Font->Wide) ? RefLookup(Font->Wide, c) : NULL;
+        if (g == NULL)
+        {
+            one[0] = c < 0x80 ? (char)c : '?';
+            if (Draw) OLED_ShowText((int16_t)x, (int16_t)Y, one, Font);
+            x += OLED_MeasureText(one, Font);
+            continue;
+        }
+        const OLED_WideFont *w = Font->Wide;
+        int top = Y + ((int)Font->Height - (int)w->Height) / 2;
+        for (int col = 0; col < w->Width && Draw; col++)
+            for (int row = 0; row < w->Height; row++)
+            {
+                int px = x + col, py = top + row;
+                if (!(g[(row >> 3) * w->Width + col] >> (row & 7) & 1)) continue;
+                if (px < cx0 || px > cx1 || py < cy0 || py > cy1) continue;
+                FrameSetPixel(OLED_DisplayBuf, px, py, Xor ? !FramePixel(OLED_DisplayBuf, px, py) : 1);
+            }
+        x += w->Width;
+    }
+    return x - X;
+}
+
+/*随机字符串：ASCII、表中的字、表外的字、4字节字符，以及各种不合法的字节序列*/
+static void RandomString(char *s, int Max, const OLED_WideFont *w)
+{
+    int n = 0;
+    while (n < Max - 4)
+    {
+        switch (Rand(0, 11))
+        {
+            case 0: case 1: case 2: s[n++] = (char)Rand(' ', '~'); break;
+            case 3: case 4: case 5: n += Encode(s + n, w->Code[Rand(0, w->Count - 1)]); break;
+            case 6: n += Encode(s + n, (unsigned)Rand(0x80, 0xFFFF)); break;
+            case 7: n += Encode(s + n, (unsigned)Rand(0x10000, 0x10FFFF)); break;
+            case 8: s[n++] = (char)Rand(0x80, 0xFF); break;
+            case 9:
+            {
+                /*截断的多字节序列：只保留前面几个字节*/
+                char t[4];
+                int len = Encode(t, w->Code[Rand(0, w->Count - 1)]);
+                int keep = Rand(1, len - 1);
+                memcpy(s + n, t, keep);
+                n += keep;
+                break;
+            }
+            case 10:
+            {
+                /*超长编码、代理项、超出 U+10FFFF*/
+                static const char *bad[] = {"\xC0\x80", "\xC1\xBF", "\xE0\x80\xAF", "\xE0\x9F\xBF", "\xF0\x8F\xBF\xBF",
+                                            "\xED\xA0\x80", "\xED\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF"};
+                const char *b = bad[Rand(0, 9)];
+                memcpy(s + n, b, strlen(b));
+                n += (int)strlen(b);
+                break;
+            }
+            default:
+                if (Rand(0, 3) == 0) goto done;
+                break;
+        }
+    }
+done:
+    s[n] = '\0';
+}
+
+static WideTable table12, table16, tableBig, tableSmall;
+
+int main(int argc, char **argv)
+{
+    srand(24);
+    MakeTable(&table12, 400, 12, 12);
+    MakeTable(&table16, 300, 11, 16);
+
+    const OLED_Font *base[4] = {&OLED_Font6x8, &OLED_Font8x16, &OLED_FontP8, &OLED_FontP16};
+    const char *baseName[4] = {"6x8", "8x16", "P8", "P16"};
+
+    /*已知序列：解码结果逐个核对*/
+    {
+        static const struct { const char *s; unsigned code[4]; } known[] = {
+            {"A\xC3\xA9", {'A', 0xE9}},
+            {"\xE4\xB8\xAD", {0x4E2D}},
+            {"\xF0\x9F\x98\x80", {0x1F600}},
+            {"\xC0\x80", {0xFFFD, 0xFFFD}},
+            {"\xED\xA0\x80", {0xFFFD, 0xFFFD, 0xFFFD}},
+            {"\xE4\xB8", {0xFFFD, 0xFFFD}},
+            {"\xF4\x90\x80\x80", {0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD}},
+        };
+        for (unsigned k = 0; k < sizeof(known) / sizeof(known[0]); k++)
+        {
+            const unsigned char *p = (const unsigned char *)known[k].s;
+            for (int i = 0; *p; i++)
+            {
+                unsigned c = RefDecode(&p);
+                EXPECT(c == known[k].code[i], "reference decoder, sequence %u char %d: U+%04X", k, i, c);
+            }
+        }
+    }
+
+    /*工程的 OLED_CJK12：码点与 BDF 相同，每个字四种字体都查得到并按BDF的行位图显示(含屏幕边缘)*/
+    {
+        const OLED_WideFont *w = &OLED_CJK12;
+        EXPECT(w->Count == CJK12_ROWS_COUNT && w->Width == 12 && w->Height == 12,
+               "OLED_CJK12 has %d glyphs %dx%d, the BDF %d: regenerate it with oled_cjkfont.py --all --emit",
+               w->Count, w->Width, w->Height, CJK12_ROWS_COUNT);
+        int drawn = 0;
+        for (int i = 0; i < CJK12_ROWS_COUNT && i < w->Count; i++)
+        {
+            EXPECT(w->Code[i] == CJK12RowsCode[i], "OLED_CJK12 code %d: U+%04X, the BDF U+%04X", i, w->Code[i], CJK12RowsCode[i]);
+            char s[8];
+            s[Encode(s, CJK12RowsCode[i])] = '\0';
+            for (int k = 0; k < 4; k++)
+            {
+                int X = Rand(-6, 90), Y = Rand(-8, 90);
+                int top = Y + ((int)base[k]->Height - 12) / 2, lit = 0;
+                Frame expect = {{0}};
+                for (int row = 0; row < 12; row++)
+                    for (int col = 0; col < 12; col++)
+                    {
+                        int x = X + col, y = top + row;
+                        if (x < 0 || x >= OLED_WIDTH || y < 0 || y >= OLED_HEIGHT || !(CJK12Rows[i][row] >> (11 - col) & 1)) continue;
+                        FrameSetPixel(expect, x, y, 1);
+                        lit++;
+                    }
+                OLED_Clear();
+                OLED_ShowText((int16_t)X, (int16_t)Y, s, base[k]);
+                int dx = 0, dy = 0;
+                EXPECT(!FrameDiff(OLED_DisplayBuf, expect, &dx, &dy), "U+%04X font %s at (%d,%d): differs from the BDF at (%d,%d)",
+                       CJK12RowsCode[i], baseName[k], X, Y, dx, dy);
+                EXPECT(OLED_MeasureText(s, base[k]) == 12, "U+%04X font %s: MeasureText %d, not found in OLED_CJK12?",
+                       CJK12RowsCode[i], baseName[k], OLED_MeasureText(s, base[k]));
+                drawn += lit > 0;
+            }
+        }
+
+        /*界面字符串中的非ASCII字符都在表中(不显示为'?')*/
+        int used = 0;
+        for (unsigned k = 0; k < sizeof(SubsetStrings) / sizeof(SubsetStrings[0]); k++)
+            for (const unsigned char *p = (const unsigned char *)SubsetStrings[k]; *p; )
+            {
+                unsigned c = RefDecode(&p);
+                if (c < 0x80) continue;
+                used++;
+                EXPECT(RefLookup(w, c) != NULL, "U+%04X in UI string \"%s\" is not in OLED_CJK12 (shown as '?')", c, SubsetStrings[k]);
+            }
+        printf("  OLED_CJK12: %d glyphs match the BDF in 4 fonts (%d placements with pixels on screen), %d non-ASCII UI characters\n",
+               w->Count, drawn, used);
+        OLED_Clear();
+    }
+
+    /*表中的字步进为字宽；表外的字、4字节字符按一个'?'，不合法序列每个字节一个'?'*/
+    {
+        OLED_Font f = OLED_Font6x8;
+        f.Wide = &table12.font;
+        char s[16];
+        int n = Encode(s, table12.code[7]);
+        n += Encode(s + n, 0x1F600);
+        memcpy(s + n, "\xED\xA0\x80", 4);
+        int q = OLED_MeasureText("?", &f);
+        EXPECT(OLED_MeasureText(s, &f) == 12 + 4 * q, "MeasureText of wide + 4-byte + surrogate: %d", OLED_MeasureText(s, &f));
+        f.Wide = NULL;
+        EXPECT(OLED_MeasureText(s, &f) == 5 * q, "MeasureText without a wide table: %d", OLED_MeasureText(s, &f));
+    }
+
+    /*随机字符串：显示与基准逐像素对比，宽度与基准相同*/
+    for (int it = 0; it < 300000; it++)
+    {
+        int k = Rand(0, 3);
+        OLED_Font f = *base[k];
+        WideTable *t = Rand(0, 1) ? &table12 : &table16;
+        f.Wide = Rand(0, 9) ? &t->font : NULL;
+        char s[64];
+        RandomString(s, Rand(5, (int)sizeof(s)), &t->font);
+
+        int xor_ = Rand(0, 1), clip = Rand(0, 3) == 0;
+        int X = Rand(-60, 100), Y = Rand(-20, 100);
+        OLED_SetDrawMode(xor_ ? OLED_DRAWMODE_XOR : OLED_DRAWMODE_NORMAL);
+        cx0 = 0; cy0 = 0; cx1 = OLED_WIDTH - 1; cy1 = OLED_HEIGHT - 1;
+        if (clip)
+        {
+            int x = Rand(0, 95), y = Rand(0, 95), w = Rand(1, 96), h = Rand(1, 96);
+            OLED_PushClip(x, y, w, h);
+            cx0 = x; cy0 = y;
+            cx1 = x + w - 1 > cx1 ? cx1 : x + w - 1;
+            cy1 = y + h - 1 > cy1 ? cy1 : y + h - 1;
+        }
+
+        Frame before, shown;
+        if (it % 20 == 0) FrameRandom(OLED_DisplayBuf);
+        memcpy(before, OLED_DisplayBuf, sizeof(before));
+        OLED_ShowText((int16_t)X, (int16_t)Y, s, &f);
+        memcpy(shown, OLED_DisplayBuf, sizeof(shown));
+        memcpy(OLED_DisplayBuf, before, sizeof(before));
+        int width = RefShowText(X, Y, s, &f, 1, xor_);
+
+        if (clip) OLED_PopClip();
+        OLED_SetDrawMode(OLED_DRAWMODE_NORMAL);
+
+        int x = 0, y = 0;
+        EXPECT(!FrameDiff(shown, OLED_DisplayBuf, &x, &y), "iter %d font %s wide %s (%d,%d) xor=%d clip=%d: first diff (%d,%d)",
+               it, baseName[k], f.Wide ? (t == &table12 ? "12x12" : "11x16") : "none", X, Y, xor_, clip, x, y);
+        EXPECT(OLED_MeasureText(s, &f) == width, "iter %d font %s: MeasureText %d, expected %d",
+               it, baseName[k], OLED_MeasureText(s, &f), width);
+    }
+
+    if (WantBench(argc, argv))
+    {
+        /*一行：8个中文(表中的字，均匀分布)或16个ASCII*/
+        MakeTable(&tableSmall, 12, 12, 12);
+        MakeTable(&tableBig, 3500, 12, 12);
+        char small[32], big[32];
+        int ns = 0, nb = 0;
+        for (int i = 0; i < 8; i++)
+        {
+            ns += Encode(small + ns, tableSmall.code[i * 12 / 8]);
+            nb += Encode(big + nb, tableBig.code[i * 3500 / 8 + 17]);
+        }
+        small[ns] = big[nb] = '\0';
+        OLED_Font fs = OLED_Font6x8, fb = OLED_Font6x8;
+        fs.Wide = &tableSmall.font;
+        fb.Wide = &tableBig.font;
+
+        const int N = 200000;
+        double t0 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ShowText(0, (int16_t)(n & 63), small, &fs); Touch(OLED_DisplayBuf); }
+        double t1 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ShowText(0, (int16_t)(n & 63), big, &fb); Touch(OLED_DisplayBuf); }
+        double t2 = NowUs();
+        for (int n = 0; n < N; n++) { OLED_ShowText(0, (int16_t)(n & 63), (char *)"Brightness: 75%!", &fs); Touch(OLED_DisplayBuf); }
+        double t3 = NowUs();
+        volatile unsigned sum = 0;
+        for (int n = 0; n < N; n++) sum += OLED_MeasureText(big, &fb);
+        double t4 = NowUs();
+        printf("  one 96 px line: 8 CJK with 12-entry table %.2f us, with 3500-entry table %.2f us, 16 ASCII 6x8 %.2f us\n",
+               (t1 - t0) / N, (t2 - t1) / N, (t3 - t2) / N);
+        printf("  decode + lookup only (OLED_MeasureText, 3500 entries): %.1f ns/glyph\n", (t4 - t3) * 1000 / N / 8);
+    }
+    return TestReport("utf8");
+}
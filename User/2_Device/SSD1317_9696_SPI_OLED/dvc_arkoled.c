@@ -34,26 +34,366 @@
 
 /* Private macros ------------------------------------------------------------*/
 
+/*引脚定义*/
+#if OLED_USE_HW_SPI_DMA
+/*硬件SPI2的SCK/MOSI固定在PB13/PB15，因此DC改接PB12(与软件SPI接线不同)*/
+#define OLED_DC_PORT        GPIOB
+#define OLED_DC_PIN         GPIO_Pin_12
+#else
+#define OLED_D0_PORT        GPIOB
+#define OLED_D0_PIN         GPIO_Pin_12
+#define OLED_D1_PORT        GPIOB
+#define OLED_D1_PIN         GPIO_Pin_13
+#define OLED_DC_PORT        GPIOB
+#define OLED_DC_PIN         GPIO_Pin_15
+#endif
+#define OLED_RES_PORT       GPIOB
+#define OLED_RES_PIN        GPIO_Pin_14
+#define OLED_CS_PORT        GPIOA
+#define OLED_CS_PIN         GPIO_Pin_8
+
+#if !OLED_USE_HW_SPI_DMA
+/*软件SPI移位：D0与D1在同一端口，一次写BSRR同时给出数据位并拉低D0，再写一次拉高D0产生上升沿*/
+#define OLED_SPI_BIT(Byte, Mask)                                                        \
+    do {                                                                                \
+        OLED_D0_PORT->BSRR = (((Byte) & (Mask)) ? OLED_D1_PIN : ((uint32_t)OLED_D1_PIN << 16)) \
+                           | ((uint32_t)OLED_D0_PIN << 16);                             \
+        OLED_SPI_DELAY();                                                               \
+        OLED_D0_PORT->BSRR = OLED_D0_PIN;                                               \
+        OLED_SPI_DELAY();                                                               \
+    } while (0)
+/*若主频较高导致SCLK超过屏幕时序要求，可在此插入若干 __NOP()*/
+#define OLED_SPI_DELAY()
+#endif
+
+/*显存按4字节对齐，整屏操作可以按32位字读写*/
+#define OLED_ALIGN4             __attribute__((aligned(4)))
+
+/*绘图函数写入的目标缓冲：整屏显存，或显示列表模式下的条带缓冲(屏幕第oled_strip_page0页起的OLED_STRIP_PAGES页)*/
+#if OLED_USE_DISPLAY_LIST
+#if OLED_STRIP_PAGES < 1 || OLED_STRIP_PAGES > OLED_PAGES
+#error "OLED_STRIP_PAGES must be 1~OLED_PAGES"
+#endif
+#define OLED_TARGET_BUF         (oled_strip_buf)
+#define OLED_TARGET_PAGE0       (oled_strip_page0)
+#define OLED_TARGET_PAGES       (OLED_STRIP_PAGES)
+#define OLED_FLUSH_SRC(Page)    (OLED_TARGET_ROW(Page))         // 条带缓冲直接发送，没有屏幕镜像
+#define OLED_RUN_QUEUE_LEN      (OLED_STRIP_PAGES)              // 每次只发送一个条带的整页
+#else
+#define OLED_TARGET_BUF         (OLED_DisplayBuf)
+#define OLED_TARGET_PAGE0       (0)
+#define OLED_TARGET_PAGES       (OLED_PAGES)
+#define OLED_FLUSH_SRC(Page)    (OLED_FrontBuf[Page])
+#define OLED_RUN_QUEUE_LEN      (OLED_FLUSH_MAX_RUNS)
+#endif
+/*屏幕第Page页在目标缓冲中的那一行，Page必须落在目标缓冲内(裁剪区保证)*/
+#define OLED_TARGET_ROW(Page)   (OLED_TARGET_BUF[(Page) - OLED_TARGET_PAGE0])
+#define OLED_BUF_WORDS          (OLED_TARGET_PAGES * OLED_WIDTH / 4)
+
+/*强制内联：以常量Rop调用时编译器为每种写入方式单独展开一份，内层循环不再判断绘图模式*/
+#define OLED_FORCE_INLINE       inline __attribute__((always_inline))
+
+/*把 Kernel(..., Rop) 按 SET/CLEAR/XOR 展开成三份常量实例(相当于按写入方式实例化的模板)，
+  绘图模式只在图元入口解析一次，逐像素循环里没有模式分支*/
+#define OLED_ROP_DISPATCH(Rop, Kernel, ...)                                     \
+    do {                                                                        \
+        switch (Rop)                                                            \
+        {                                                                       \
+            case OLED_ROP_SET:   Kernel(__VA_ARGS__, OLED_ROP_SET);   break;    \
+            case OLED_ROP_CLEAR: Kernel(__VA_ARGS__, OLED_ROP_CLEAR); break;    \
+            default:             Kernel(__VA_ARGS__, OLED_ROP_XOR);   break;    \
+        }                                                                       \
+    } while (0)
+
+/*整帧突发传输：水平寻址窗口(GDDRAM列偏移16)*/
+#define OLED_GDDRAM_COL_OFFSET  (16)
+
+/*GDDRAM共16页(128行)，屏幕显示其中96行；硬件滚动时屏幕镜像覆盖整个GDDRAM，否则只覆盖显示的12页*/
+#if OLED_USE_HW_SCROLL
+#if OLED_USE_DISPLAY_LIST
+#error "OLED_USE_HW_SCROLL needs the full frame buffer (OLED_USE_DISPLAY_LIST 0)"
+#endif
+#define OLED_GDDRAM_PAGES       (16)
+#define OLED_SCROLL_LINE        (oled_scroll_line)
+#else
+#define OLED_GDDRAM_PAGES       (OLED_PAGES)
+#define OLED_SCROLL_LINE        (0)
+#endif
+#define OLED_GDDRAM_ROWS        (OLED_GDDRAM_PAGES * 8)
+#if OLED_FLUSH_MAX_RUNS < OLED_GDDRAM_PAGES
+#error "OLED_FLUSH_MAX_RUNS must not be less than OLED_GDDRAM_PAGES"
+#endif
+
+/*显示起始行寄存器(0x40|line)只有6位*/
+#define OLED_START_LINES        (64)
+
 /* Private types -------------------------------------------------------------*/
 
+/**
+  * @brief 显存写入操作(由oled_draw_mode与operation共同决定)
+  * NORMAL模式: operation=1 -> SET,  operation=0 -> CLEAR
+  * XOR模式:    operation=1 -> XOR,  operation=0 -> CLEAR
+  */
+typedef enum {
+    OLED_ROP_SET = 0,   // 置位(点亮)
+    OLED_ROP_CLEAR,     // 清零(熄灭)
+    OLED_ROP_XOR        // 翻转
+} OLED_RasterOp;
+
+/**
+  * @brief 一段待发送的游程：OLED_FrontBuf[Page][X ... X+Count-1]
+  */
+typedef struct {
+    uint8_t Page;
+    uint8_t X;
+    uint8_t Count;
+} OLED_FlushRun;
+
+/**
+  * @brief GDDRAM的一个物理页由显存的哪几行组成(按当前显示起始行映射，见 OLED_MapPhysPage)
+  * 物理页字节 = (OLED_DisplayBuf[LoPage] >> Shift | OLED_DisplayBuf[HiPage] << (8-Shift)) 中 Visible 的位
+  *            + 屏幕镜像中其余位(备用行，不显示)
+  */
+typedef struct {
+    uint8_t LoPage;     // 提供低位的显存页，0xFF：这几行是备用行
+    uint8_t HiPage;     // 提供高位的显存页(Shift不为0时)，0xFF：这几行是备用行或Shift为0
+    uint8_t Shift;
+    uint8_t Visible;    // 显示窗口内的行对应的位，0：整页都是备用行
+} OLED_PhysPage;
+
+/**
+  * @brief PackBits压缩位图的流式解码状态(格式见 Tools/oled_packbits.py)
+  */
+typedef struct {
+    const uint8_t *Src;     // 下一个要读取的压缩字节
+    uint8_t Left;           // 当前游程剩余的字节数
+    uint8_t Repeat;         // 1：重复游程，0：原样游程
+} OLED_Unpacker;
+
+/**
+  * @brief 多边形扫描线填充的一条边(活动边表的表项)
+  * @note 交点与 OLED_pnpoly 完全一致：x = vx[i] + trunc(dx * (y - vy[i]) / dy)，
+  *       即从基准顶点 vx[i] 出发、向 vx[i] 方向取整，逐行用商和余数增量推进，不做除法
+  */
+typedef struct {
+    int16_t YTop, YBot;     // 该边参与的扫描行 [YTop, YBot)
+    int16_t BaseX, BaseY;   // 基准顶点(pnpoly中的第i个顶点)
+    int8_t  Sign;           // dx的符号
+    int8_t  Step;           // +1：基准顶点在上方，|y - BaseY|逐行增大；-1：逐行减小
+    uint16_t A, B;          // |dx|, |dy|
+    uint16_t Aq, Ar;        // A / B 的商与余数
+    int32_t Q, R;           // 当前行的 floor(A * |y - BaseY| / B) 与余数
+} OLED_PolyEdge;
+
+/**
+  * @brief 裁剪矩形(含两端点)，始终位于屏幕内；X0>X1 表示空区域，任何绘制都被拒绝
+  */
+typedef struct {
+    int16_t X0, Y0;
+    int16_t X1, Y1;
+} OLED_ClipRect;
+
+/**
+  * @brief 格式化输出的去向(见 OLED_Format)：格式化出的字符逐个交给Put，不经过中间字符串
+  * @note Put返回0表示之后的字符都不需要了(已越过裁剪区右边/列表已满)，格式化随即结束
+  */
+typedef struct OLED_FormatSink {
+    uint8_t (*Put)(struct OLED_FormatSink *Sink, char Char);
+    int32_t X;              // 下一个字符的横坐标(直接绘制)
+    int16_t Page;           // 字形所在页与页内偏移(直接绘制)
+    uint8_t Shift;
+    uint8_t FontSize, Height;
+    OLED_RasterOp Rop;
+} OLED_FormatSink;
+
+#if OLED_USE_DISPLAY_LIST
+/**
+  * @brief 显示列表的命令码，每条命令 = 1字节命令码 + 后面注明的参数
+  */
+typedef enum {
+    OLED_CMD_MODE = 0,      // 1字节绘图模式
+    OLED_CMD_DOTS,          // OLED_ListDots
+    OLED_CMD_RECT,          // OLED_ListShape
+    OLED_CMD_RRECT,         // OLED_ListShape
+    OLED_CMD_STRING,        // OLED_ListText + 以'\0'结尾的字符串
+    OLED_CMD_FLOAT,         // OLED_ListFloat
+    OLED_CMD_IMAGE,         // OLED_ListImage
+    OLED_CMD_PUSH_CLIP,     // OLED_ListShape(只用X/Y/Width/Height)
+    OLED_CMD_POP_CLIP,      // 无参数
+    OLED_CMD_PATTERN,       // OLED_ListShape(Radius为Level，Operation为Op)
+    OLED_CMD_SPRITE,        // OLED_ListImage(IsMix为Mode)
+    OLED_CMD_SCALED,        // OLED_ListScaled
+    OLED_CMD_TEXT           // OLED_ListFontText + 以'\0'结尾的字符串
+} OLED_ListCmd;
+
+/**
+  * @brief 横纵步长都为2的点阵：Rows行，前Rows-1行每行Columns个点，最后一行Last个点
+  * @note 逐点调用 OLED_ListDrawPoint 画出的棋盘格(过渡/虚化动画)会合并成一条命令，按原顺序重放
+  */
+typedef struct {
+    int16_t X, Y;           // 第一个点
+    uint8_t Columns, Rows, Last;
+    uint8_t Operation;
+} OLED_ListDots;
+
+/**
+  * @brief 矩形/圆角矩形/裁剪矩形的参数
+  */
+typedef struct {
+    int16_t X, Y;
+    uint16_t Width, Height;
+    uint8_t Radius, IsFilled, Operation;
+} OLED_ListShape;
+
+/**
+  * @brief 字符串的参数，字符串本身紧跟在后面
+  */
+typedef struct {
+    int16_t X, Y;
+    uint8_t FontSize;
+} OLED_ListText;
+
+/**
+  * @brief 按字体描述显示的字符串的参数，字符串本身紧跟在后面
+  */
+typedef struct {
+    int16_t X, Y;
+    const OLED_Font *Font;
+} OLED_ListFontText;
+
+/**
+  * @brief 浮点数的参数(重放时调用 OLED_ShowFloatNum，保证与直接绘制完全一致)
+  */
+typedef struct {
+    double Number;
+    int16_t X, Y;
+    uint8_t IntLength, FraLength, FontSize;
+} OLED_ListFloat;
+
+/**
+  * @brief 位图的参数，只记录取模数组的地址(取模数组须在列表重放期间有效，通常在Flash中)
+  */
+typedef struct {
+    const uint8_t *Image;
+    int16_t X, Y;
+    uint8_t Width, Height, IsMix, IsPacked;
+} OLED_ListImage;
+
+/**
+  * @brief 缩放位图的参数，同样只记录取模数组的地址
+  */
+typedef struct {
+    const uint8_t *Image;
+    int16_t X, Y;
+    uint8_t Width, Height, DstWidth, DstHeight, IsMix;
+} OLED_ListScaled;
+#endif
+
 /* Private variables ---------------------------------------------------------*/
 
+#if OLED_USE_DISPLAY_LIST
+/**
+  * @brief 条带缓冲(显示列表模式)
+  * OLED_ListRender 每次把它当作屏幕第 oled_strip_page0 页起的 OLED_STRIP_PAGES 页，
+  * 清空后重放显示列表，再直接从这里发送到屏幕
+  */
+static uint8_t oled_strip_buf[OLED_STRIP_PAGES][OLED_WIDTH] OLED_ALIGN4;
+static int16_t oled_strip_page0 = 0;
+#else
 /**
   * @brief OLED显存数组
   * 所有的显示函数，都只是对此显存数组进行读写
   * 随后调用OLED_Update函数或OLED_UpdateArea函数
   * 才会将显存数组的数据发送到OLED硬件，进行显示
   */
-uint8_t OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH];
+uint8_t OLED_DisplayBuf[OLED_PAGES][OLED_WIDTH] OLED_ALIGN4;
+
+/**
+  * @brief 屏幕当前实际显示内容的镜像(即最近一次发送到GDDRAM的数据)，按GDDRAM物理页存放
+  * OLED_UpdateDirty 只发送 OLED_DisplayBuf(经显示起始行映射后)与它不同的字节
+  */
+static uint8_t OLED_FrontBuf[OLED_GDDRAM_PAGES][OLED_WIDTH] OLED_ALIGN4;
+#endif
 static OLED_DrawMode oled_draw_mode = OLED_DRAWMODE_NORMAL;
+static uint8_t oled_front_valid = 0;    // 0：屏幕内容未知(上电/初始化后)，下一次刷新必须全屏发送
+
+/**
+  * @brief 每页的脏列范围 [oled_dirty_x0, oled_dirty_x1]，x0 > x1 表示该页干净
+  * 所有写显存的函数都会在这里记录自己改动过的列
+  */
+static uint8_t oled_dirty_x0[OLED_PAGES];
+static uint8_t oled_dirty_x1[OLED_PAGES];
+static uint32_t oled_draw_stamp = 0;    // 显存写入计数：每次记录脏区加1，刷新不清零
+
+static OLED_FlushStat oled_flush_stat;
+
+/**
+  * @brief 裁剪区栈：oled_clip 为当前生效的裁剪矩形(栈顶)，栈中保存被压住的外层裁剪矩形
+  * 所有写显存的绘图函数都只改动 oled_clip 内的像素(OLED_Clear/OLED_Reverse 除外)
+  */
+static OLED_ClipRect oled_clip = {0, 0, OLED_WIDTH - 1, OLED_HEIGHT - 1};
+static OLED_ClipRect oled_clip_stack[OLED_CLIP_DEPTH];
+static uint8_t oled_clip_depth = 0;
+
+/**
+  * @brief 传输后端与异步刷新状态
+  * 刷新时先把要发送的字节拷进 OLED_FrontBuf 并排好游程队列，再从 OLED_FrontBuf 发送，
+  * 因此异步(DMA)发送期间，上层可以继续在 OLED_DisplayBuf 上绘制下一帧
+  */
+#if OLED_USE_HW_SPI_DMA
+static const OLED_Transport *oled_transport = &OLED_HWSPITransport;
+#else
+static const OLED_Transport *oled_transport = &OLED_SoftSPITransport;
+#endif
+static OLED_FlushRun oled_run_queue[OLED_RUN_QUEUE_LEN];
+static uint8_t oled_run_count = 0;
+static volatile uint8_t oled_run_next = 0;
+static volatile uint8_t oled_flush_busy = 0;    // 1：游程队列尚未发送完
+static volatile uint8_t oled_xfer_active = 0;   // 1：后端有一段数据正在发送
+static void (*oled_flush_callback)(void) = NULL;
+
+/**
+  * @brief 整帧突发传输的命令头/尾与待发送的显示命令
+  * 命令头 = 待发送的对比度/反色/起始行命令 + 水平寻址 + 列窗口16~111 + 页窗口(屏幕镜像的全部页)
+  * 命令尾 = 恢复页寻址(差分刷新的游程仍用 OLED_SetCursor 定位)
+  */
+#if !OLED_USE_DISPLAY_LIST
+static uint8_t oled_frame_head[12];
+static const uint8_t oled_frame_tail[2] = {0x20, 0x02};
+#endif
+static int16_t oled_pending_contrast = -1;      // -1：无待发送的对比度命令
+static uint8_t oled_contrast = 0x40;            // 最近一次设置的对比度(OLED_Init 写入此值)
+static int8_t  oled_pending_invert = -1;        // -1：无待发送的反色命令
+#if OLED_USE_HW_SCROLL
+static uint8_t oled_scroll_line = 0;            // 显示起始行：显存第r行显示在GDDRAM第(oled_scroll_line+r)%128行
+static int8_t  oled_pending_start_line = -1;    // -1：无待发送的起始行命令
+#endif
+
+#if OLED_USE_DISPLAY_LIST
+/**
+  * @brief 显示列表：命令字节流 [命令码][参数结构体]...，OLED_ListRender 每个条带从头重放一遍
+  * 参数结构体按字节拷入拷出，列表内不要求对齐
+  */
+static uint8_t oled_list_buf[OLED_LIST_SIZE];
+static uint16_t oled_list_len = 0;              // 已用字节数
+static uint16_t oled_list_last = 0;             // 最后一条命令的偏移(oled_list_len为0时无效)，用于合并连续的点
+static uint16_t oled_list_cmds = 0;
+static uint16_t oled_list_dropped = 0;
+static OLED_DrawMode oled_list_mode0 = OLED_DRAWMODE_NORMAL;   // 列表开头的绘图模式，每个条带从它开始重放
+static uint8_t oled_list_clip_depth = 0;        // 记录时的裁剪区栈深度，保证重放时压入/弹出成对
+#endif
 
 /* Private function declarations ---------------------------------------------*/
 
+static inline void OLED_ClearDirty(void);
+void OLED_SetCursor(uint8_t Page, uint8_t X_user);
+
 /* Function definitions -------------------------------------------------------*/
 
 
 /*----------------------引脚配置----------------------*/
 
+#if !OLED_USE_HW_SPI_DMA
 /**
   * @brief OLED写D0（CLK）高低电平
   * @param BitValue 要写入D0的电平值，范围：0/1
@@ -64,7 +404,7 @@ static OLED_DrawMode oled_draw_mode = OLED_DRAWMODE_NORMAL;
 void OLED_W_D0(uint8_t BitValue)
 {
 	/*根据BitValue的值，将D0置高电平或者低电平*/
-	GPIO_WriteBit(GPIOB, GPIO_Pin_12, (BitAction)BitValue);
+	GPIO_WriteBit(OLED_D0_PORT, OLED_D0_PIN, (BitAction)BitValue);
 }
 
 /**
@@ -77,8 +417,9 @@ void OLED_W_D0(uint8_t BitValue)
 void OLED_W_D1(uint8_t BitValue)
 {
 	/*根据BitValue的值，将D1置高电平或者低电平*/
-	GPIO_WriteBit(GPIOB, GPIO_Pin_13, (BitAction)BitValue);
+	GPIO_WriteBit(OLED_D1_PORT, OLED_D1_PIN, (BitAction)BitValue);
 }
+#endif
 
 /**
   * @brief OLED写RES高低电平
@@ -90,7 +431,7 @@ void OLED_W_D1(uint8_t BitValue)
 void OLED_W_RES(uint8_t BitValue)
 {
 	/*根据BitValue的值，将RES置高电平或者低电平*/
-	GPIO_WriteBit(GPIOB, GPIO_Pin_14, (BitAction)BitValue);
+	GPIO_WriteBit(OLED_RES_PORT, OLED_RES_PIN, (BitAction)BitValue);
 }
 
 /**
@@ -103,7 +444,7 @@ void OLED_W_RES(uint8_t BitValue)
 void OLED_W_DC(uint8_t BitValue)
 {
 	/*根据BitValue的值，将DC置高电平或者低电平*/
-	GPIO_WriteBit(GPIOB, GPIO_Pin_15, (BitAction)BitValue);
+	GPIO_WriteBit(OLED_DC_PORT, OLED_DC_PIN, (BitAction)BitValue);
 }
 
 /**
@@ -116,14 +457,15 @@ void OLED_W_DC(uint8_t BitValue)
 void OLED_W_CS(uint8_t BitValue)
 {
 	/*根据BitValue的值，将CS置高电平或者低电平*/
-	GPIO_WriteBit(GPIOA, GPIO_Pin_8, (BitAction)BitValue);
+	GPIO_WriteBit(OLED_CS_PORT, OLED_CS_PIN, (BitAction)BitValue);
 }
 
 /**
   * @brief OLED引脚初始化
   * @param 无
   * @note 当上层函数需要初始化时，此函数会被调用
-  *       用户需要将D0、D1、RES、DC和CS引脚初始化为推挽输出模式
+  *       软件SPI：将D0、D1、RES、DC和CS引脚初始化为推挽输出模式
+  *       硬件SPI：SCK、MOSI初始化为复用推挽输出，RES、DC和CS为推挽输出
   */
 void OLED_GPIO_Init(void)
 {
@@ -135,27 +477,36 @@ void OLED_GPIO_Init(void)
 		for (j = 0; j < 1000; j ++);
 	}
 	
-	/*将D0、D1、RES、DC和CS引脚初始化为推挽输出模式*/
 	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);
 	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
 	
 	GPIO_InitTypeDef GPIO_InitStructure;
- 	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
 	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
-	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_12;
- 	GPIO_Init(GPIOB, &GPIO_InitStructure);
-	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_13;
+#if OLED_USE_HW_SPI_DMA
+	/*硬件SPI：SCK(PB13)、MOSI(PB15)为复用推挽输出*/
+ 	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP;
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_13 | GPIO_Pin_15;
  	GPIO_Init(GPIOB, &GPIO_InitStructure);
-	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_14;
- 	GPIO_Init(GPIOB, &GPIO_InitStructure);
-	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_15;
+#else
+	/*软件SPI：D0、D1为推挽输出*/
+ 	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
+	GPIO_InitStructure.GPIO_Pin = OLED_D0_PIN | OLED_D1_PIN;
  	GPIO_Init(GPIOB, &GPIO_InitStructure);
-	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8;
- 	GPIO_Init(GPIOA, &GPIO_InitStructure);
+#endif
+	/*RES、DC和CS引脚初始化为推挽输出模式*/
+ 	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
+	GPIO_InitStructure.GPIO_Pin = OLED_RES_PIN;
+ 	GPIO_Init(OLED_RES_PORT, &GPIO_InitStructure);
+	GPIO_InitStructure.GPIO_Pin = OLED_DC_PIN;
+ 	GPIO_Init(OLED_DC_PORT, &GPIO_InitStructure);
+	GPIO_InitStructure.GPIO_Pin = OLED_CS_PIN;
+ 	GPIO_Init(OLED_CS_PORT, &GPIO_InitStructure);
 	
 	/*置引脚默认电平*/
+#if !OLED_USE_HW_SPI_DMA
 	OLED_W_D0(0);
 	OLED_W_D1(1);
+#endif
 	OLED_W_RES(1);
 	OLED_W_DC(1);
 	OLED_W_CS(1);
@@ -163,30 +514,30 @@ void OLED_GPIO_Init(void)
 
 /*----------------------通信协议----------------------*/
 
+#if !OLED_USE_HW_SPI_DMA
 /**
   * @brief SPI发送一个字节
   * @param Byte 要发送的一个字节数据，范围：0x00~0xFF
   */
 void OLED_SPI_SendByte(uint8_t Byte)
 {
-	uint8_t i;
-	
-	/*循环8次，主机依次发送数据的每一位*/
-	for (i = 0; i < 8; i++)
-	{
-		/*使用掩码的方式取出Byte的指定一位数据并写入到D1线*/
-		/*两个!的作用是，让所有非零的值变为1*/
-		OLED_W_D1(!!(Byte & (0x80 >> i)));
-		OLED_W_D0(1);	//拉高D0，从机在D0上升沿读取SDA
-		OLED_W_D0(0);	//拉低D0，主机开始发送下一位数据
-	}
+	/*展开8位，直接写GPIO置位/复位寄存器，高位在前*/
+	OLED_SPI_BIT(Byte, 0x80);
+	OLED_SPI_BIT(Byte, 0x40);
+	OLED_SPI_BIT(Byte, 0x20);
+	OLED_SPI_BIT(Byte, 0x10);
+	OLED_SPI_BIT(Byte, 0x08);
+	OLED_SPI_BIT(Byte, 0x04);
+	OLED_SPI_BIT(Byte, 0x02);
+	OLED_SPI_BIT(Byte, 0x01);
+	OLED_D0_PORT->BRR = OLED_D0_PIN;	//D0回到空闲低电平
 }
 
 /**
-  * @brief OLED写命令
+  * @brief 软件SPI后端：写命令
   * @param Command 要写入的命令值，范围：0x00~0xFF
   */
-void OLED_WriteCommand(uint8_t Command)
+static void OLED_SoftSPI_WriteCommand(uint8_t Command)
 {
 	OLED_W_CS(0);					//拉低CS，开始通信
 	OLED_W_DC(0);					//拉低DC，表示即将发送命令
@@ -195,13 +546,13 @@ void OLED_WriteCommand(uint8_t Command)
 }
 
 /**
-  * @brief OLED写数据
+  * @brief 软件SPI后端：写数据(同步，返回即发送完成)
   * @param Data 要写入数据的起始地址
   * @param Count 要写入数据的数量
   */
-void OLED_WriteData(uint8_t *Data, uint8_t Count)
+static void OLED_SoftSPI_WriteData(const uint8_t *Data, uint16_t Count)
 {
-	uint8_t i;
+	uint16_t i;
 	
 	OLED_W_CS(0);					//拉低CS，开始通信
 	OLED_W_DC(1);					//拉高DC，表示即将发送数据
@@ -213,139 +564,692 @@ void OLED_WriteData(uint8_t *Data, uint8_t Count)
 	OLED_W_CS(1);					//拉高CS，结束通信
 }
 
-/*----------------------通信协议----------------------*/
-
-
-/*----------------------硬件配置----------------------*/
-
 /**
-  * @brief OLED初始化
-  * @param 无
-  * @note 使用屏幕前，需要调用此初始化函数
+  * @brief 软件SPI后端：在一个CS窗口内发送 命令头 + 数据 + 命令尾
+  * @param Head HeadCount 数据前的命令(DC=0)
+  * @param Data Count 数据(DC=1)
+  * @param Tail TailCount 数据后的命令(DC=0)
   */
-void OLED_Init(void)
+static void OLED_SoftSPI_WriteFrame(const uint8_t *Head, uint8_t HeadCount,
+                                    const uint8_t *Data, uint16_t Count,
+                                    const uint8_t *Tail, uint8_t TailCount)
 {
-    OLED_GPIO_Init();			//先调用底层的端口初始化
-
-    /*写入一系列的命令，对OLED进行初始化配置*/
-    OLED_WriteCommand(0xAE); // 关屏指令
-
-    OLED_WriteCommand(0xD5); // Set display clock divide ratio/oscillator freq
-    OLED_WriteCommand(0xE1); // recommended value for SSD1317 reference
-
-    OLED_WriteCommand(0xA8); // Set multiplex ratio
-    OLED_WriteCommand(0x5F); // 95 -> 96 rows
-
-    OLED_WriteCommand(0xD3); // Set display offset
-    OLED_WriteCommand(0x00); // 0
+	uint16_t i;
+	
+	OLED_W_CS(0);
+	OLED_W_DC(0);
+	for (i = 0; i < HeadCount; i ++) OLED_SPI_SendByte(Head[i]);
+	OLED_W_DC(1);
+	for (i = 0; i < Count; i ++)     OLED_SPI_SendByte(Data[i]);
+	OLED_W_DC(0);
+	for (i = 0; i < TailCount; i ++) OLED_SPI_SendByte(Tail[i]);
+	OLED_W_CS(1);
+}
 
-    OLED_WriteCommand(0x40); // Set display start line = 0
+/**
+  * @brief 软件SPI传输后端(默认)
+  */
+const OLED_Transport OLED_SoftSPITransport = {
+	OLED_GPIO_Init,
+	OLED_SoftSPI_WriteCommand,
+	OLED_SoftSPI_WriteData,
+	0,
+	OLED_SoftSPI_WriteFrame
+};
+
+#else
+/**
+  * @brief 硬件SPI后端：等待最后一个字节移出移位寄存器
+  */
+static void OLED_HWSPI_WaitIdle(void)
+{
+	while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
+	while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_BSY) == SET);
+}
 
-    OLED_WriteCommand(0xA1); // 0xA1 = column 地址反向映射（SEG127 → column 0），即水平翻转显示。
-    OLED_WriteCommand(0xC0); // 控制 COM 输出的扫描（上下翻转）方向。0xC0 或 0xC8
+/**
+  * @brief 硬件SPI后端：初始化引脚、SPI2与DMA1通道5(SPI2_TX)
+  */
+static void OLED_HWSPI_Init(void)
+{
+	SPI_InitTypeDef SPI_InitStructure;
+	DMA_InitTypeDef DMA_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+	
+	OLED_GPIO_Init();
+	
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_SPI2, ENABLE);
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+	
+	/*只发不收，模式0，MSB在前；APB1 36MHz / 4 = 9MHz，不超过SSD1317的SCLK上限*/
+	SPI_InitStructure.SPI_Direction = SPI_Direction_1Line_Tx;
+	SPI_InitStructure.SPI_Mode = SPI_Mode_Master;
+	SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
+	SPI_InitStructure.SPI_CPOL = SPI_CPOL_Low;
+	SPI_InitStructure.SPI_CPHA = SPI_CPHA_1Edge;
+	SPI_InitStructure.SPI_NSS = SPI_NSS_Soft;
+	SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_4;
+	SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;
+	SPI_InitStructure.SPI_CRCPolynomial = 7;
+	SPI_Init(SPI2, &SPI_InitStructure);
+	SPI_I2S_DMACmd(SPI2, SPI_I2S_DMAReq_Tx, ENABLE);
+	SPI_Cmd(SPI2, ENABLE);
+	
+	DMA_DeInit(DMA1_Channel5);
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)(uintptr_t)&SPI2->DR;
+	DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)(uintptr_t)OLED_FLUSH_SRC(0);
+	DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+	DMA_InitStructure.DMA_BufferSize = 1;
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+	DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+	DMA_Init(DMA1_Channel5, &DMA_InitStructure);
+	DMA_ITConfig(DMA1_Channel5, DMA_IT_TC, ENABLE);
+	
+	NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel5_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_Init(&NVIC_InitStructure);
+}
 
-    OLED_WriteCommand(0xDA); // COM pins hardware configuration
-    OLED_WriteCommand(0x12); // recommended
+/**
+  * @brief 硬件SPI后端：写命令(轮询，命令只有1字节，不值得启动DMA)
+  * @param Command 要写入的命令值，范围：0x00~0xFF
+  */
+static void OLED_HWSPI_WriteCommand(uint8_t Command)
+{
+	OLED_W_CS(0);
+	OLED_W_DC(0);
+	SPI_I2S_SendData(SPI2, Command);
+	OLED_HWSPI_WaitIdle();			//DC/CS必须等最后一位移出后才能切换
+	OLED_W_CS(1);
+}
 
-    OLED_WriteCommand(0x81); // 对比度调节指令
-    OLED_WriteCommand(0x40); // 0x00 - 0xFF
+/**
+  * @brief 硬件SPI后端：启动一段数据的DMA发送，完成后在 OLED_DMA_IRQHandler 中释放CS
+  * @param Data 要写入数据的起始地址(发送完成前不得修改)
+  * @param Count 要写入数据的数量
+  */
+static void OLED_HWSPI_WriteData(const uint8_t *Data, uint16_t Count)
+{
+	OLED_W_CS(0);
+	OLED_W_DC(1);
+	DMA_Cmd(DMA1_Channel5, DISABLE);
+	DMA1_Channel5->CMAR = (uint32_t)(uintptr_t)Data;
+	DMA_SetCurrDataCounter(DMA1_Channel5, Count);
+	DMA_Cmd(DMA1_Channel5, ENABLE);
+}
 
-    OLED_WriteCommand(0xD9); // Pre-charge period
-    OLED_WriteCommand(0xF1); // recommended
+/**
+  * @brief 硬件SPI后端：在一个CS窗口内发送 命令头 + 数据 + 命令尾
+  * @note 命令头轮询发送，数据走DMA，命令尾在DMA完成中断里发送后再释放CS
+  */
+static const uint8_t *oled_hw_tail;
+static uint8_t oled_hw_tail_count;
 
-    OLED_WriteCommand(0xDB); // VCOMH deselect level
-    OLED_WriteCommand(0x30); // recommended
+static void OLED_HWSPI_WriteFrame(const uint8_t *Head, uint8_t HeadCount,
+                                  const uint8_t *Data, uint16_t Count,
+                                  const uint8_t *Tail, uint8_t TailCount)
+{
+	uint8_t i;
+	
+	OLED_W_CS(0);
+	OLED_W_DC(0);
+	for (i = 0; i < HeadCount; i ++)
+	{
+		while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
+		SPI_I2S_SendData(SPI2, Head[i]);
+	}
+	OLED_HWSPI_WaitIdle();
+	
+	oled_hw_tail = Tail;
+	oled_hw_tail_count = TailCount;
+	OLED_W_DC(1);
+	DMA_Cmd(DMA1_Channel5, DISABLE);
+	DMA1_Channel5->CMAR = (uint32_t)(uintptr_t)Data;
+	DMA_SetCurrDataCounter(DMA1_Channel5, Count);
+	DMA_Cmd(DMA1_Channel5, ENABLE);
+}
 
-    OLED_WriteCommand(0xA4); // 0xA4 = 显示 GDDRAM 的内容（正常）；0xA5 = 强制点亮（忽略 GDDRAM）。
-    OLED_WriteCommand(0xA6); // 0xA6 正常（0 = off, 1 = on），0xA7 反色（0→on，1→off）
+/**
+  * @brief 硬件SPI + DMA传输后端
+  */
+const OLED_Transport OLED_HWSPITransport = {
+	OLED_HWSPI_Init,
+	OLED_HWSPI_WriteCommand,
+	OLED_HWSPI_WriteData,
+	1,
+	OLED_HWSPI_WriteFrame
+};
 
-    OLED_WriteCommand(0x8D); // 充电泵
-    OLED_WriteCommand(0x14);
+/**
+  * @brief DMA1通道5(SPI2_TX)传输完成中断处理，需在 DMA1_Channel5_IRQHandler 中调用
+  */
+void OLED_DMA_IRQHandler(void)
+{
+	if (DMA_GetITStatus(DMA1_IT_TC5) != RESET)
+	{
+		DMA_ClearITPendingBit(DMA1_IT_TC5);
+		DMA_Cmd(DMA1_Channel5, DISABLE);
+		OLED_HWSPI_WaitIdle();		//DMA完成只表示最后一个字节进了DR，还要等它移出
+		if (oled_hw_tail_count)
+		{
+			/*整帧突发传输的命令尾*/
+			OLED_W_DC(0);
+			while (oled_hw_tail_count)
+			{
+				while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
+				SPI_I2S_SendData(SPI2, *oled_hw_tail++);
+				oled_hw_tail_count--;
+			}
+			OLED_HWSPI_WaitIdle();
+		}
+		OLED_W_CS(1);
+		OLED_TransportComplete();
+	}
+}
+#endif
 
-    OLED_Clear();
-    OLED_WriteCommand(0xAF); // 开屏指令
+/**
+  * @brief 通过当前传输后端发送一段数据
+  * @param Data 要写入数据的起始地址
+  * @param Count 要写入数据的数量
+  * @note 异步后端只启动传输，oled_xfer_active 在 OLED_TransportComplete 中清零
+  */
+static void OLED_TransportWrite(const uint8_t *Data, uint16_t Count)
+{
+	oled_xfer_active = 1;
+	oled_transport->WriteData(Data, Count);
+	if (!oled_transport->IsAsync) oled_xfer_active = 0;
 }
 
 /**
-  * @brief SSD1317命令函数，控制硬件使屏幕正常或反色显示
-  * @param invert 1：反色显示，0：正常显示
+  * @brief OLED写命令
+  * @param Command 要写入的命令值，范围：0x00~0xFF
   */
-void OLED_InvertDisplay(uint8_t invert) {
-    if (invert) {
-        OLED_WriteCommand(0xA7);  // 反色显示
-    } else {
-        OLED_WriteCommand(0xA6);  // 正常显示
-    }
+void OLED_WriteCommand(uint8_t Command)
+{
+	oled_transport->WriteCommand(Command);
 }
 
-/*----------------------光标与更新----------------------*/
 /**
-  * @brief 设置页 (page) 与列 (X)
-  * @param Page 页地址，范围：0-11
-  * @param X_user 用户指定的列地址，范围：0-95
-  * @note SSD1317 使用： 0xB0 | page
-  *                     col_high = ((X & 0xF0) >> 4) + 0x11
-  *                     col_low  = (X & 0x0F) + 0x00
+  * @brief OLED写数据(阻塞，返回时数据已发送完成)
+  * @param Data 要写入数据的起始地址
+  * @param Count 要写入数据的数量
   */
-void OLED_SetCursor(uint8_t Page, uint8_t X_user)
+void OLED_WriteData(uint8_t *Data, uint8_t Count)
 {
-		const int col_offset = 16; // 模组硬件向右偏移16列 硬件屏幕的0列-95列物理连接到GDDRAM的16列-111列
-		int col = X_user + col_offset;        // 映射到 GDDRAM 列
-		if (col > 127) col = 127;             // 强制在 GDDRAM 范围内
-		OLED_WriteCommand(0xB0 | (Page & 0x0F));     // 页选择 "& 0x0F"的目的是防止越界溢出变成别的命令
-    OLED_WriteCommand(0x10 | ((col >> 4) & 0x0F)); // 高 4bit
-    OLED_WriteCommand(0x00 | (col & 0x0F));        // 低 4bit
+	OLED_TransportWrite(Data, Count);
+	while (oled_xfer_active);
 }
 
-/*----------------------硬件配置----------------------*/
+/*----------------------通信协议----------------------*/
 
 
-/*----------------------工具函数(工具函数仅供内部部分函数使用)----------------------*/
+/*----------------------异步刷新----------------------*/
 
 /**
-  * @brief 次方函数
-  * @param X 底数
-  * @param Y 指数
-  * @return 等于X的Y次方
+  * @brief 发送游程队列中剩余的游程
+  * @note 同步后端一次发完整个队列；异步后端每次只启动一个游程，
+  *       由后端在该游程发送完成时调用 OLED_TransportComplete 继续下一个(可能在中断中)
   */
-uint32_t OLED_Pow(uint32_t X, uint32_t Y)
+static void OLED_FlushPump(void)
 {
-	uint32_t Result = 1;	//结果默认为1
-	while (Y --)			//累乘Y次
+	const OLED_FlushRun *run;
+	
+	while (oled_run_next < oled_run_count)
 	{
-		Result *= X;		//每次把X累乘到结果上
+		run = &oled_run_queue[oled_run_next++];
+		OLED_SetCursor(run->Page, run->X);
+		OLED_TransportWrite(&OLED_FLUSH_SRC(run->Page)[run->X], run->Count);
+		if (oled_transport->IsAsync) return;
 	}
-	return Result;
+	
+	oled_flush_busy = 0;
+	if (oled_flush_callback != NULL) oled_flush_callback();
 }
 
 /**
-  * @brief 判断指定点是否在指定多边形内部
-  * @param nvert 多边形的顶点数
-  * @param vertx verty 包含多边形顶点的x和y坐标的数组
-  * @param testx testy 测试点的X和y坐标
-  * @return 指定点是否在指定多边形内部，1：在内部，0：不在内部
+  * @brief 取出待发送的显示命令(对比度/反色/起始行)
+  * @param Buf 输出缓冲，至少4字节
+  * @return 命令字节数
   */
-uint8_t OLED_pnpoly(uint8_t nvert, int16_t *vertx, int16_t *verty, int16_t testx, int16_t testy)
+static uint8_t OLED_TakePendingCommands(uint8_t *Buf)
 {
-	int16_t i, j, c = 0;
+	uint8_t n = 0;
 	
-	/*此算法由W. Randolph Franklin提出*/
-	/*参考链接：https://wrfranklin.org/Research/Short_Notes/pnpoly.html*/
-	for (i = 0, j = nvert - 1; i < nvert; j = i++)
+	if (oled_pending_contrast >= 0)
 	{
-		if (((verty[i] > testy) != (verty[j] > testy)) &&
-			(testx < (vertx[j] - vertx[i]) * (testy - verty[i]) / (verty[j] - verty[i]) + vertx[i]))
-		{
-			c = !c;
-		}
+		Buf[n++] = 0x81;
+		Buf[n++] = (uint8_t)oled_pending_contrast;
+		oled_pending_contrast = -1;
 	}
-	return c;
+	if (oled_pending_invert >= 0)
+	{
+		Buf[n++] = oled_pending_invert ? 0xA7 : 0xA6;
+		oled_pending_invert = -1;
+	}
+#if OLED_USE_HW_SCROLL
+	if (oled_pending_start_line >= 0)
+	{
+		Buf[n++] = (uint8_t)(0x40 | oled_pending_start_line);
+		oled_pending_start_line = -1;
+	}
+#endif
+	return n;
 }
 
 /**
-  * @brief 判断指定点是否在指定角度内部
-  * @param X Y 指定点的坐标
-  * @param StartAngle EndAngle 起始角度和终止角度，范围：-180~180
+  * @brief 清空游程队列与本帧统计，准备排入新的一帧
+  * @note 调用前必须确认上一帧已发送完(OLED_WaitFlush)
+  */
+static void OLED_BeginFlush(void)
+{
+	oled_run_count = 0;
+	oled_flush_stat.DataBytes = 0;
+	oled_flush_stat.CmdBytes  = 0;
+	oled_flush_stat.Runs      = 0;
+}
+
+/**
+  * @brief 排入一个游程(数据已在 OLED_FrontBuf 中)
+  */
+static void OLED_QueueRun(uint8_t Page, uint8_t X, uint8_t Count)
+{
+	OLED_FlushRun *run = &oled_run_queue[oled_run_count++];
+	run->Page  = Page;
+	run->X     = X;
+	run->Count = Count;
+	
+	oled_flush_stat.DataBytes += Count;
+	oled_flush_stat.CmdBytes  += 3;
+	oled_flush_stat.Runs++;
+}
+
+/**
+  * @brief 开始发送已排好的游程队列
+  */
+static void OLED_StartFlush(void)
+{
+	uint8_t cmd[4], n, i;
+	
+	/*待发送的显示命令在第一个游程之前发出*/
+	n = OLED_TakePendingCommands(cmd);
+	for (i = 0; i < n; i++) OLED_WriteCommand(cmd[i]);
+	oled_flush_stat.CmdBytes += n;
+	
+	oled_flush_stat.Frames++;
+	oled_flush_stat.TotalBytes += oled_flush_stat.DataBytes + oled_flush_stat.CmdBytes;
+	
+	oled_run_next = 0;
+	oled_flush_busy = 1;
+	OLED_FlushPump();
+}
+
+#if !OLED_USE_DISPLAY_LIST
+/**
+  * @brief 整帧突发传输：在一个CS窗口内发送 命令头 + OLED_FrontBuf全部字节(1152，硬件滚动时1536) + 命令尾
+  * @note 需要后端提供 WriteFrame；数据已在 OLED_FrontBuf 中
+  */
+static void OLED_StartFrameFlush(void)
+{
+	uint8_t n = OLED_TakePendingCommands(oled_frame_head);
+	
+	oled_frame_head[n++] = 0x20;	//寻址模式
+	oled_frame_head[n++] = 0x00;	//水平寻址：写满一页自动换到下一页
+	oled_frame_head[n++] = 0x21;	//列窗口
+	oled_frame_head[n++] = OLED_GDDRAM_COL_OFFSET;
+	oled_frame_head[n++] = OLED_GDDRAM_COL_OFFSET + OLED_WIDTH - 1;
+	oled_frame_head[n++] = 0x22;	//页窗口
+	oled_frame_head[n++] = 0;
+	oled_frame_head[n++] = OLED_GDDRAM_PAGES - 1;
+	
+	oled_run_count = 0;
+	oled_flush_stat.DataBytes = OLED_GDDRAM_PAGES * OLED_WIDTH;
+	oled_flush_stat.CmdBytes  = n + sizeof(oled_frame_tail);
+	oled_flush_stat.Runs      = 1;
+	oled_flush_stat.Frames++;
+	oled_flush_stat.TotalBytes += oled_flush_stat.DataBytes + oled_flush_stat.CmdBytes;
+	
+	/*队列为空，发送完成后由 OLED_TransportComplete -> OLED_FlushPump 收尾*/
+	oled_run_next = 0;
+	oled_flush_busy = 1;
+	oled_xfer_active = 1;
+	oled_transport->WriteFrame(oled_frame_head, n, &OLED_FrontBuf[0][0], OLED_GDDRAM_PAGES * OLED_WIDTH,
+	                           oled_frame_tail, sizeof(oled_frame_tail));
+	if (!oled_transport->IsAsync)
+	{
+		oled_xfer_active = 0;
+		OLED_FlushPump();
+	}
+}
+#endif
+
+/**
+  * @brief 传输后端通知一段数据发送完成
+  * @note 异步后端在传输完成(CS已释放)后调用，可以在中断中调用
+  */
+void OLED_TransportComplete(void)
+{
+	oled_xfer_active = 0;
+	if (oled_flush_busy) OLED_FlushPump();
+}
+
+/**
+  * @brief 查询是否有一帧正在发送
+  * @return 1：正在发送，0：空闲
+  */
+uint8_t OLED_IsFlushBusy(void)
+{
+	return (uint8_t)(oled_flush_busy || oled_xfer_active);
+}
+
+/**
+  * @brief 等待当前帧发送完成
+  */
+void OLED_WaitFlush(void)
+{
+	while (oled_flush_busy || oled_xfer_active);
+}
+
+/**
+  * @brief 设置一帧发送完成时的回调
+  * @param Callback 回调函数，NULL表示不需要回调
+  * @note 同步后端下回调在刷新函数返回前由调用者执行；
+  *       异步后端下回调在 DMA1_Channel5 中断(OLED_DMA_IRQHandler -> OLED_TransportComplete)中执行，
+  *       同一中断里还会为下一段调用 OLED_SetCursor 发送命令. 回调应尽量简短，
+  *       不能调用 OLED_WaitFlush 以及会等待发送完成的 OLED_Update/OLED_UpdateArea/OLED_UpdateDirty/OLED_FlushCommands
+  */
+void OLED_SetFlushCallback(void (*Callback)(void))
+{
+	oled_flush_callback = Callback;
+}
+
+/**
+  * @brief 更换传输后端
+  * @param Transport 传输后端(须在整个使用期间有效)
+  * @note 应在 OLED_Init 之前调用；更换后屏幕内容视为未知，下一次刷新全屏发送
+  */
+void OLED_SetTransport(const OLED_Transport *Transport)
+{
+	OLED_WaitFlush();
+	oled_transport = Transport;
+	oled_front_valid = 0;
+}
+
+/*----------------------异步刷新----------------------*/
+
+
+/*----------------------硬件配置----------------------*/
+
+/**
+  * @brief OLED初始化
+  * @param 无
+  * @note 使用屏幕前，需要调用此初始化函数
+  */
+void OLED_Init(void)
+{
+    OLED_WaitFlush();
+    oled_transport->Init();		//先调用传输后端的端口/外设初始化
+
+    /*写入一系列的命令，对OLED进行初始化配置*/
+    OLED_WriteCommand(0xAE); // 关屏指令
+
+    OLED_WriteCommand(0xD5); // Set display clock divide ratio/oscillator freq
+    OLED_WriteCommand(0xE1); // recommended value for SSD1317 reference
+
+    OLED_WriteCommand(0xA8); // Set multiplex ratio
+    OLED_WriteCommand(0x5F); // 95 -> 96 rows
+
+    OLED_WriteCommand(0xD3); // Set display offset
+    OLED_WriteCommand(0x00); // 0
+
+    OLED_WriteCommand(0x40); // Set display start line = 0
+
+    OLED_WriteCommand(0xA1); // 0xA1 = column 地址反向映射（SEG127 → column 0），即水平翻转显示。
+    OLED_WriteCommand(0xC0); // 控制 COM 输出的扫描（上下翻转）方向。0xC0 或 0xC8
+
+    OLED_WriteCommand(0xDA); // COM pins hardware configuration
+    OLED_WriteCommand(0x12); // recommended
+
+    OLED_WriteCommand(0x81); // 对比度调节指令
+    OLED_WriteCommand(oled_contrast); // 0x00 - 0xFF，默认0x40
+
+    OLED_WriteCommand(0xD9); // Pre-charge period
+    OLED_WriteCommand(0xF1); // recommended
+
+    OLED_WriteCommand(0xDB); // VCOMH deselect level
+    OLED_WriteCommand(0x30); // recommended
+
+    OLED_WriteCommand(0xA4); // 0xA4 = 显示 GDDRAM 的内容（正常）；0xA5 = 强制点亮（忽略 GDDRAM）。
+    OLED_WriteCommand(0xA6); // 0xA6 正常（0 = off, 1 = on），0xA7 反色（0→on，1→off）
+
+    OLED_WriteCommand(0x8D); // 充电泵
+    OLED_WriteCommand(0x14);
+
+    oled_front_valid = 0;    // 上电后GDDRAM内容未知，下一次刷新全屏发送
+#if OLED_USE_HW_SCROLL
+    oled_scroll_line = 0;    // 上面已写入起始行0
+    oled_pending_start_line = -1;
+#endif
+    OLED_ResetClip();
+    OLED_ClearDirty();
+    OLED_Clear();
+    OLED_WriteCommand(0xAF); // 开屏指令
+}
+
+/**
+  * @brief SSD1317命令函数，控制硬件使屏幕正常或反色显示
+  * @param invert 1：反色显示，0：正常显示
+  * @note 命令不会立即发送，而是在下一次刷新(OLED_Update/OLED_UpdateDirty等)时与数据一起发出
+  */
+void OLED_InvertDisplay(uint8_t invert) {
+    oled_pending_invert = invert ? 1 : 0;
+}
+
+/**
+  * @brief SSD1317命令函数，设置屏幕对比度(亮度)
+  * @param contrast 对比度，范围：0x00~0xFF
+  * @note 命令不会立即发送，而是在下一次刷新时与数据一起发出
+  */
+void OLED_SetContrast(uint8_t contrast) {
+    oled_pending_contrast = contrast;
+    oled_contrast = contrast;
+}
+
+/**
+  * @brief 读取最近一次设置的对比度(可能还在等待发送)
+  * @return 对比度，范围：0x00~0xFF
+  */
+uint8_t OLED_GetContrast(void) {
+    return oled_contrast;
+}
+
+/**
+  * @brief 立即发送待发送的显示命令(对比度/反色)，不发送任何显存数据
+  * @return 无
+  * @note 用于对比度渐变这类只改命令的场合：每一步只发2个命令字节，不必整帧刷新.
+  *       若有一帧正在发送，先等它发完
+  */
+void OLED_FlushCommands(void)
+{
+    uint8_t cmd[4], n, i;
+
+    OLED_WaitFlush();
+    n = OLED_TakePendingCommands(cmd);
+    for (i = 0; i < n; i++) OLED_WriteCommand(cmd[i]);
+    oled_flush_stat.TotalBytes += n;
+}
+
+/*----------------------光标与更新----------------------*/
+/**
+  * @brief 设置页 (page) 与列 (X)
+  * @param Page 页地址，范围：0-11
+  * @param X_user 用户指定的列地址，范围：0-95
+  * @note SSD1317 使用： 0xB0 | page
+  *                     col_high = ((X & 0xF0) >> 4) + 0x11
+  *                     col_low  = (X & 0x0F) + 0x00
+  */
+void OLED_SetCursor(uint8_t Page, uint8_t X_user)
+{
+		const int col_offset = OLED_GDDRAM_COL_OFFSET; // 模组硬件向右偏移16列 硬件屏幕的0列-95列物理连接到GDDRAM的16列-111列
+		int col = X_user + col_offset;        // 映射到 GDDRAM 列
+		if (col > 127) col = 127;             // 强制在 GDDRAM 范围内
+		OLED_WriteCommand(0xB0 | (Page & 0x0F));     // 页选择 "& 0x0F"的目的是防止越界溢出变成别的命令
+    OLED_WriteCommand(0x10 | ((col >> 4) & 0x0F)); // 高 4bit
+    OLED_WriteCommand(0x00 | (col & 0x0F));        // 低 4bit
+}
+
+/*----------------------硬件配置----------------------*/
+
+
+/*----------------------工具函数(工具函数仅供内部部分函数使用)----------------------*/
+
+/**
+  * @brief 次方函数
+  * @param X 底数
+  * @param Y 指数
+  * @return 等于X的Y次方
+  */
+uint32_t OLED_Pow(uint32_t X, uint32_t Y)
+{
+	uint32_t Result = 1;	//结果默认为1
+	while (Y --)			//累乘Y次
+	{
+		Result *= X;		//每次把X累乘到结果上
+	}
+	return Result;
+}
+
+/**
+  * @brief 整数开平方(向下取整)
+  * @param N 被开方数
+  * @return floor(sqrt(N))
+  * @note 逐位试商，只用移位和加减，没有FPU的Cortex-M3上比sqrtf快得多
+  */
+static uint16_t OLED_ISqrt(uint32_t N)
+{
+    uint32_t root = 0, bit = 1UL << 30;
+
+    while (bit > N) bit >>= 2;
+    while (bit)
+    {
+        if (N >= root + bit)
+        {
+            N   -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)root;
+}
+
+/*半径1~8(UI中光标、复选框、对话框与滚动条用到的圆角)的圆角轮廓：第dy行的水平半宽*/
+#define OLED_CORNER_TABLE_MAX   (8)
+#define OLED_CORNER_OFFSET(r)   (((r) - 1) * ((r) + 2) / 2)     // 半径r的轮廓在表中的起点
+static const uint8_t OLED_CornerDx[] = {
+    1, 0,   // r=1
+    2, 2, 0,   // r=2
+    3, 3, 2, 0,   // r=3
+    4, 4, 3, 3, 0,   // r=4
+    5, 5, 5, 4, 3, 0,   // r=5
+    6, 6, 6, 5, 4, 3, 0,   // r=6
+    7, 7, 7, 6, 6, 5, 4, 0,   // r=7
+    8, 8, 8, 7, 7, 6, 5, 4, 0    // r=8
+};
+
+/**
+  * @brief 圆在相对圆心纵向偏移dy处的水平半宽，round(sqrt(R^2 - dy^2))
+  * @param R 半径
+  * @param DyAbs 纵向偏移的绝对值
+  * @return 水平半宽，|dy| >= R 时为0
+  * @note 与 (int)(sqrtf(t) + 0.5f) 的结果逐一相同(对0~65025已穷举验证)：
+  *       s = floor(sqrt(t))，sqrt(t) >= s + 0.5 等价于 t - s*s > s
+  */
+static int16_t OLED_CircleDx(uint8_t R, int16_t DyAbs)
+{
+    uint32_t t, root;
+
+    if (DyAbs >= R) return 0;
+    if (R <= OLED_CORNER_TABLE_MAX) return OLED_CornerDx[OLED_CORNER_OFFSET(R) + DyAbs];
+    t = (uint32_t)R * R - (uint32_t)DyAbs * DyAbs;
+    root = OLED_ISqrt(t);
+    return (int16_t)(root + (t - root * root > root));
+}
+
+/*sin(0°~90°)，Q30定点数(1.0 = 1 << 30)*/
+static const int32_t OLED_SinQ30[91] = {
+    0x00000000, 0x011DF0B3, 0x023BCB19, 0x035978E9, 0x0476E3DB, 0x0593F5AE, 0x06B09827, 0x07CCB513,
+    0x08E8364B, 0x0A0305B4, 0x0B1D0D3F, 0x0C3636EF, 0x0D4E6CD6, 0x0E65991B, 0x0F7BA5F9, 0x10907DC2,
+    0x11A40ADD, 0x12B637D0, 0x13C6EF37, 0x14D61BD0, 0x15E3A875, 0x16EF8020, 0x17F98DEF, 0x1901BD23,
+    0x1A07F921, 0x1B0C2D77, 0x1C0E45DB, 0x1D0E2E2B, 0x1E0BD274, 0x1F071EEE, 0x20000000, 0x20F66242,
+    0x21EA327D, 0x22DB5DAF, 0x23C9D108, 0x24B579F1, 0x259E4609, 0x26842329, 0x2766FF63, 0x2846C909,
+    0x29236EA4, 0x29FCDF02, 0x2AD3092E, 0x2BA5DC73, 0x2C754862, 0x2D413CCD, 0x2E09A9CD, 0x2ECE7FC2,
+    0x2F8FAF50, 0x304D2969, 0x3106DF46, 0x31BCC26A, 0x326EC4A8, 0x331CD81D, 0x33C6EF37, 0x346CFCB2,
+    0x350EF39B, 0x35ACC751, 0x36466B86, 0x36DBD43D, 0x376CF5D1, 0x37F9C4F0, 0x3882369F, 0x3906403A,
+    0x3985D777, 0x3A00F260, 0x3A77875E, 0x3AE98D30, 0x3B56FAF3, 0x3BBFC81E, 0x3C23EC85, 0x3C836058,
+    0x3CDE1C27, 0x3D3418DD, 0x3D854FC7, 0x3DD1BA8F, 0x3E19533F, 0x3E5C1443, 0x3E99F865, 0x3ED2FAD2,
+    0x3F071719, 0x3F364928, 0x3F608D52, 0x3F85E04B, 0x3FA63F2A, 0x3FC1A768, 0x3FD816E3, 0x3FE98BDA,
+    0x3FF604F1, 0x3FFD8130, 0x40000000
+};
+
+/**
+  * @brief 整数角度的单位向量(数学坐标，+X为0°，逆时针)，Q30定点数
+  * @param Angle 角度，范围：0~359
+  * @param Ux Uy 输出：cos(Angle)、sin(Angle)
+  * @note 轴向角度为精确的0与±(1<<30)，45°的倍数两分量绝对值严格相等
+  */
+static void OLED_UnitVectorQ30(int16_t Angle, int32_t *Ux, int32_t *Uy)
+{
+    int16_t r = (int16_t)(Angle % 90);
+    int32_t sn = OLED_SinQ30[r], cs = OLED_SinQ30[90 - r];
+
+    switch (Angle / 90)
+    {
+        case 0:  *Ux =  cs; *Uy =  sn; break;
+        case 1:  *Ux = -sn; *Uy =  cs; break;
+        case 2:  *Ux = -cs; *Uy = -sn; break;
+        default: *Ux =  sn; *Uy = -cs; break;
+    }
+}
+
+/**
+  * @brief 判断指定点是否在指定多边形内部
+  * @param nvert 多边形的顶点数
+  * @param vertx verty 包含多边形顶点的x和y坐标的数组
+  * @param testx testy 测试点的X和y坐标
+  * @return 指定点是否在指定多边形内部，1：在内部，0：不在内部
+  */
+uint8_t OLED_pnpoly(uint8_t nvert, int16_t *vertx, int16_t *verty, int16_t testx, int16_t testy)
+{
+	int16_t i, j, c = 0;
+	
+	/*此算法由W. Randolph Franklin提出*/
+	/*参考链接：https://wrfranklin.org/Research/Short_Notes/pnpoly.html*/
+	for (i = 0, j = nvert - 1; i < nvert; j = i++)
+	{
+		if (((verty[i] > testy) != (verty[j] > testy)) &&
+			(testx < (vertx[j] - vertx[i]) * (testy - verty[i]) / (verty[j] - verty[i]) + vertx[i]))
+		{
+			c = !c;
+		}
+	}
+	return c;
+}
+
+/**
+  * @brief 判断指定点是否在指定角度内部
+  * @param X Y 指定点的坐标
+  * @param StartAngle EndAngle 起始角度和终止角度，范围：-180~180
   *           水平向右为0度，水平向左为180度或-180度，下方为正数，上方为负数，顺时针旋转
   * @return 指定点是否在指定角度内部，1：在内部，0：不在内部
   */
@@ -375,27 +1279,1130 @@ uint8_t OLED_IsInAngle(int16_t X, int16_t Y, int16_t StartAngle, int16_t EndAngl
 /*----------------------工具函数----------------------*/
 
 
-/*----------------------功能函数----------------------*/
+/*----------------------按32位字读写显存(仅供内部函数使用)----------------------*/
+
+/**
+  * @brief 从字节数组中读出4个字节拼成的32位字(小端)
+  * @note 显存是 uint8_t 数组，用memcpy读写整字而不是强制转换成 uint32_t 指针，
+  *       避免违反严格别名规则；-O1以上编译为一条 LDR/STR
+  */
+static inline uint32_t OLED_LoadWord(const uint8_t *P)
+{
+    uint32_t w;
+    memcpy(&w, P, sizeof(w));
+    return w;
+}
+
+/**
+  * @brief 把32位字写入字节数组的4个字节(小端)
+  */
+static inline void OLED_StoreWord(uint8_t *P, uint32_t W)
+{
+    memcpy(P, &W, sizeof(W));
+}
+
+/*----------------------裁剪区(仅供内部函数使用)----------------------*/
+
+/**
+  * @brief 判断一个包围盒是否完全落在当前裁剪区之外
+  * @param X0 Y0 包围盒左上角坐标(含)
+  * @param X1 Y1 包围盒右下角坐标(含)
+  * @return 1：完全在裁剪区外(无需绘制)，0：可能有交集
+  * @note 用于各图元入口处的一次性拒绝，坐标按32位传入，调用方不必担心int16溢出
+  */
+static inline uint8_t OLED_ClipRejectBox(int32_t X0, int32_t Y0, int32_t X1, int32_t Y1)
+{
+    return (uint8_t)(X1 < oled_clip.X0 || X0 > oled_clip.X1 ||
+                     Y1 < oled_clip.Y0 || Y0 > oled_clip.Y1);
+}
+
+/**
+  * @brief 计算某一页中落在裁剪区纵向范围内的位
+  * @param Page 页号，可以在屏幕外
+  * @return 页字节掩码(bit0为该页顶行)，为0时该页完全在裁剪区外
+  */
+static inline uint8_t OLED_ClipPageMask(int16_t Page)
+{
+    int16_t top = (int16_t)(oled_clip.Y0 - Page * 8);
+    int16_t bot = (int16_t)(oled_clip.Y1 - Page * 8);
+    uint8_t mask = 0xFF;
+
+    if (top > 7 || bot < 0 || top > bot) return 0x00;
+    if (top > 0) mask = (uint8_t)(mask << top);
+    if (bot < 7) mask &= (uint8_t)(0xFF >> (7 - bot));
+    return mask;
+}
+
+/*----------------------裁剪区----------------------*/
+
+
+/*----------------------脏区记录(仅供内部函数使用)----------------------*/
+
+/**
+  * @brief 记录一块已裁剪到屏幕内的区域为脏
+  * @param PageStart PageEnd 起止页(含)，范围：0~11
+  * @param X0 X1 起止列(含)，范围：0~95
+  */
+static inline void OLED_MarkDirty(uint8_t PageStart, uint8_t PageEnd, uint8_t X0, uint8_t X1)
+{
+    uint8_t page;
+    oled_draw_stamp++;
+    for (page = PageStart; page <= PageEnd; page++)
+    {
+        if (X0 < oled_dirty_x0[page]) oled_dirty_x0[page] = X0;
+        if (X1 > oled_dirty_x1[page]) oled_dirty_x1[page] = X1;
+    }
+}
+
+/**
+  * @brief 记录一块任意区域为脏(自动裁剪到当前裁剪区内)
+  * @param X Y 区域左上角坐标
+  * @param Width Height 区域宽高
+  */
+static void OLED_MarkDirtyArea(int16_t X, int16_t Y, int16_t Width, int16_t Height)
+{
+    int32_t x0 = X, y0 = Y, x1 = (int32_t)X + Width - 1, y1 = (int32_t)Y + Height - 1;
+
+    if (x0 < oled_clip.X0) x0 = oled_clip.X0;
+    if (y0 < oled_clip.Y0) y0 = oled_clip.Y0;
+    if (x1 > oled_clip.X1) x1 = oled_clip.X1;
+    if (y1 > oled_clip.Y1) y1 = oled_clip.Y1;
+    if (x0 > x1 || y0 > y1) return;
+
+    OLED_MarkDirty((uint8_t)(y0 >> 3), (uint8_t)(y1 >> 3), (uint8_t)x0, (uint8_t)x1);
+}
+
+/**
+  * @brief 清除全部脏记录
+  */
+static inline void OLED_ClearDirty(void)
+{
+    uint8_t page;
+    for (page = 0; page < OLED_PAGES; page++)
+    {
+        oled_dirty_x0[page] = 0xFF;
+        oled_dirty_x1[page] = 0;
+    }
+}
+
+/*----------------------脏区记录----------------------*/
+
+
+/*----------------------填充内核(仅供内部绘图函数使用)----------------------*/
+
+/**
+  * @brief 将绘图模式与operation解析为显存写入操作
+  * @param operation 与OLED_DrawPoint的operation含义一致
+  * @return 对应的显存写入操作
+  */
+static inline OLED_RasterOp OLED_ResolveRop(uint8_t operation)
+{
+    if (!operation) return OLED_ROP_CLEAR;
+    return (oled_draw_mode == OLED_DRAWMODE_XOR) ? OLED_ROP_XOR : OLED_ROP_SET;
+}
+
+/**
+  * @brief 曲线类图元(圆/椭圆/圆弧/圆角矩形)的显存写入操作
+  * @note 这些图元在XOR模式下忽略operation，总是翻转；NORMAL模式下同 OLED_ResolveRop
+  */
+static inline OLED_RasterOp OLED_ResolveCurveRop(uint8_t operation)
+{
+    return (oled_draw_mode == OLED_DRAWMODE_XOR) ? OLED_ROP_XOR : OLED_ResolveRop(operation);
+}
+
+/**
+  * @brief 单像素写入内核
+  * @param X Y 像素坐标，裁剪区外不绘制
+  * @param Rop 显存写入操作
+  * @note Rop为常量(见 OLED_ROP_DISPATCH)时switch在编译期消去，只剩裁剪判断与一次读改写；
+  *       不强制内联，由编译器按优化等级决定内联还是生成按常量专门化的副本，避免逐点调用处代码膨胀
+  */
+static inline void OLED_PutPixel(int16_t X, int16_t Y, OLED_RasterOp Rop)
+{
+    uint8_t page, mask;
+
+    if (X < oled_clip.X0 || X > oled_clip.X1 || Y < oled_clip.Y0 || Y > oled_clip.Y1) return;
+    page = (uint8_t)(Y >> 3);
+    mask = (uint8_t)(1 << (Y & 0x07));
+    OLED_MarkDirty(page, page, (uint8_t)X, (uint8_t)X);
+
+    switch (Rop)
+    {
+        case OLED_ROP_SET:   OLED_TARGET_ROW(page)[X] |= mask;             break;
+        case OLED_ROP_CLEAR: OLED_TARGET_ROW(page)[X] &= (uint8_t)~mask;   break;
+        case OLED_ROP_XOR:   OLED_TARGET_ROW(page)[X] ^= mask;             break;
+    }
+}
+
+/**
+  * @brief 矩形区域填充内核(含两端点)
+  * @param X0 Y0 区域左上角坐标
+  * @param X1 Y1 区域右下角坐标
+  * @param Rop 显存写入操作
+  * @note 只在入口处对当前裁剪区做一次裁剪，随后按页计算顶/底页掩码，
+  *       对每列只读写一次显存字节(最多8个像素一次完成)，
+  *       水平线(X0~X1, Y)与垂直线(X, Y0~Y1)都是它的特例.
+  *       X0>X1 或 Y0>Y1 时不绘制.
+  */
+static void OLED_FillBox(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, OLED_RasterOp Rop)
+{
+    uint8_t page, pageStart, pageEnd;
+    uint8_t maskTop, maskBottom, mask;
+    uint8_t count, n;
+    uint8_t *p;
+
+    /*裁剪到当前裁剪区(裁剪区总在屏幕内)*/
+    if (X0 < oled_clip.X0) X0 = oled_clip.X0;
+    if (Y0 < oled_clip.Y0) Y0 = oled_clip.Y0;
+    if (X1 > oled_clip.X1) X1 = oled_clip.X1;
+    if (Y1 > oled_clip.Y1) Y1 = oled_clip.Y1;
+    if (X0 > X1 || Y0 > Y1) return;
+
+    pageStart  = (uint8_t)(Y0 >> 3);
+    pageEnd    = (uint8_t)(Y1 >> 3);
+    maskTop    = (uint8_t)(0xFF << (Y0 & 0x07));
+    maskBottom = (uint8_t)(0xFF >> (7 - (Y1 & 0x07)));
+    count      = (uint8_t)(X1 - X0 + 1);
+    OLED_MarkDirty(pageStart, pageEnd, (uint8_t)X0, (uint8_t)X1);
+
+    for (page = pageStart; page <= pageEnd; page++)
+    {
+        mask = 0xFF;
+        if (page == pageStart) mask &= maskTop;
+        if (page == pageEnd)   mask &= maskBottom;
+
+        p = &OLED_TARGET_ROW(page)[X0];
+        n = count;
+        if (mask == 0xFF && Rop != OLED_ROP_XOR)
+        {
+            /*整页字节：直接整段写入*/
+            memset(p, (Rop == OLED_ROP_SET) ? 0xFF : 0x00, n);
+            continue;
+        }
+        switch (Rop)
+        {
+            case OLED_ROP_SET:
+                while (n--) *p++ |= mask;
+                break;
+            case OLED_ROP_CLEAR:
+                mask = (uint8_t)~mask;
+                while (n--) *p++ &= mask;
+                break;
+            case OLED_ROP_XOR:
+                while (n--) *p++ ^= mask;
+                break;
+        }
+    }
+}
+
+/**
+  * @brief 以左上角+宽高描述的区域调用填充内核
+  * @note 宽高为0时不绘制；右下角先在32位下计算，避免int16溢出
+  */
+static void OLED_FillRect(int16_t X, int16_t Y, uint16_t Width, uint16_t Height, OLED_RasterOp Rop)
+{
+    int32_t x1 = (int32_t)X + Width - 1;
+    int32_t y1 = (int32_t)Y + Height - 1;
+
+    if (Width == 0 || Height == 0) return;
+    if (x1 > OLED_WIDTH)  x1 = OLED_WIDTH;      // 超出屏幕的部分由内核裁掉
+    if (y1 > OLED_HEIGHT) y1 = OLED_HEIGHT;
+    OLED_FillBox(X, Y, (int16_t)x1, (int16_t)y1, Rop);
+}
+
+/*----------------------填充内核----------------------*/
+
+
+/*----------------------字形内核(仅供内部文字函数使用)----------------------*/
+
+/**
+  * @brief 计算字形顶端所在的页与页内偏移
+  * @param Y 字形左上角纵坐标
+  * @param Height 字形高度(8或16)
+  * @param Page 输出：字形第0行所在页(可能为负)
+  * @param Shift 输出：字形第0行在页内的位偏移，范围：0~7
+  * @return 字形是否与裁剪区在纵向上有交集，1：有，0：无(无需绘制)
+  */
+static inline uint8_t OLED_GlyphPlace(int16_t Y, uint8_t Height, int16_t *Page, uint8_t *Shift)
+{
+    if (Y <= oled_clip.Y0 - (int16_t)Height || Y > oled_clip.Y1) return 0;
+    /*Y > -16，加16后为正数，避免负数除法取整方向的问题*/
+    *Page  = (int16_t)(((Y + 16) >> 3) - 2);
+    *Shift = (uint8_t)(Y & 0x07);
+    return 1;
+}
+
+/**
+  * @brief 字形的逐列合并循环(由 OLED_BlitGlyph 按Rop展开)
+  * @param iStart iEnd 要绘制的字模列 [iStart, iEnd)
+  * @param Mask 所跨各页的裁剪掩码，与左移Shift后的列位对齐
+  * @note 其余参数同 OLED_BlitGlyph
+  */
+static OLED_FORCE_INLINE void OLED_GlyphColumns(int16_t X, int16_t Page, uint8_t Shift,
+                                                const uint8_t *Glyph, uint8_t Width, uint8_t Height,
+                                                int16_t iStart, int16_t iEnd, uint32_t Mask, OLED_RasterOp Rop)
+{
+    int16_t i, k;
+    uint8_t nBytes = (uint8_t)((Height + Shift + 7) >> 3);
+    uint32_t bits;
+
+    for (i = iStart; i < iEnd; i++)
+    {
+        bits = Glyph[i];
+        if (Height > 8) bits |= (uint32_t)Glyph[i + Width] << 8;
+        bits = (bits << Shift) & Mask;
+        if (!bits) continue;
+
+        for (k = 0; k < nBytes; k++, bits >>= 8)
+        {
+            uint8_t *p;
+            if (!(bits & 0xFF)) continue;     // 掩码为0的页可能在目标缓冲之外，不能访问
+            p = &OLED_TARGET_ROW(Page + k)[X + i];
+            switch (Rop)
+            {
+                case OLED_ROP_SET:   *p |= (uint8_t)bits;   break;
+                case OLED_ROP_CLEAR: *p &= (uint8_t)~bits;  break;
+                case OLED_ROP_XOR:   *p ^= (uint8_t)bits;   break;
+            }
+        }
+    }
+}
+
+/**
+  * @brief 按列字节把字形合并进显存
+  * @param X 字形左上角横坐标
+  * @param Page Shift 由OLED_GlyphPlace算出的页与页内偏移
+  * @param Glyph 字模
+  * @param Width 字形宽度(字模列数)，同时也是上下两半字模之间的跨度
+  * @param Height 字形高度，范围：1~16
+  * @param Rop OLED_ROP_SET(或)/OLED_ROP_XOR(异或)/OLED_ROP_CLEAR(擦除)，字模中为0的位不改变显存
+  * @note 每列字模先拼成最多16位，再左移Shift后拆到所跨的2~3个页，
+  *       每个页字节只读写一次；横向只遍历与裁剪区相交的列，
+  *       纵向在循环外算好每页的裁剪掩码，裁剪区外的页掩码为0.
+  */
+static void OLED_BlitGlyph(int16_t X, int16_t Page, uint8_t Shift,
+                           const uint8_t *Glyph, uint8_t Width, uint8_t Height, OLED_RasterOp Rop)
+{
+    int16_t iStart, iEnd, k;
+    uint8_t nBytes = (uint8_t)((Height + Shift + 7) >> 3);
+    uint32_t mask = 0;
+
+    iStart = (X < oled_clip.X0) ? (int16_t)(oled_clip.X0 - X) : 0;
+    iEnd   = (X + Width > oled_clip.X1 + 1) ? (int16_t)(oled_clip.X1 + 1 - X) : (int16_t)Width;
+    if (iStart >= iEnd) return;
+
+    /*所跨各页的裁剪掩码拼成与bits对齐的一个字*/
+    for (k = 0; k < nBytes; k++) mask |= (uint32_t)OLED_ClipPageMask((int16_t)(Page + k)) << (8 * k);
+    mask &= ((1UL << Height) - 1) << Shift;   // 字模最后一页超出Height的位不画(如12像素高字形第1页的高4位)
+    if (!mask) return;
+    OLED_MarkDirtyArea((int16_t)(X + iStart), (int16_t)(Page * 8 + Shift), (int16_t)(iEnd - iStart), Height);
+
+    OLED_ROP_DISPATCH(Rop, OLED_GlyphColumns, X, Page, Shift, Glyph, Width, Height, iStart, iEnd, mask);
+}
+
+/**
+  * @brief 在字体描述中查找字符的字模
+  * @param Width 输出：字形宽度(字模的列数，也是上下两半字模之间的跨度)
+  * @param Advance 输出：步进宽度(到下一个字符的距离)
+  * @return 字模首地址
+  * @note 等宽字体按序号直接算出偏移，比例字体查偏移/步进表，字库子集先查Map，都是O(1)
+  */
+static inline const uint8_t *OLED_FontGlyph(const OLED_Font *Font, char Char, uint8_t *Width, uint8_t *Advance)
+{
+    uint8_t index = (uint8_t)((uint8_t)Char - Font->First);
+
+    if (index >= Font->Count) index = 0;
+    if (Font->Map != NULL) index = Font->Map[index];
+    if (Font->Advance == NULL)
+    {
+        *Width = *Advance = Font->Width;
+        return Font->Glyphs + (uint16_t)index * Font->Width * (Font->Height >> 3);
+    }
+    *Advance = Font->Advance[index];
+    *Width = (uint8_t)(*Advance - Font->Spacing);
+    return Font->Glyphs + Font->Offset[index];
+}
+
+/**
+  * @brief 获取字符在字库中的字模
+  * @param Char 字符
+  * @param FontSize 字体大小，OLED_8X16 或 OLED_6X8
+  * @return 字模首地址，字体不支持时返回NULL
+  * @note 8x16字模前8字节为上半页，后8字节为下半页；经字体描述查找，字库子集同样适用
+  */
+static inline const uint8_t *OLED_GetGlyph(char Char, uint8_t FontSize)
+{
+    uint8_t width, advance;
+
+    switch (FontSize)
+    {
+    case OLED_8X16: return OLED_FontGlyph(&OLED_Font8x16, Char, &width, &advance);
+    case OLED_6X8:  return OLED_FontGlyph(&OLED_Font6x8, Char, &width, &advance);
+    default:        return NULL;
+    }
+}
+
+/**
+  * @brief 解码一个UTF-8字符
+  * @param String 输入：指向字符首字节；输出：指向下一个字符
+  * @return Unicode码点，不合法的序列(含被'\0'截断的、超长编码、代理项)返回0xFFFD，只跳过首字节
+  */
+static inline uint32_t OLED_Utf8Next(const char **String)
+{
+    const uint8_t *s = (const uint8_t *)*String;
+    uint32_t code;
+    uint8_t n, i;
+
+    if (s[0] < 0x80)      { *String += 1; return s[0]; }
+    else if (s[0] < 0xC2) { *String += 1; return 0xFFFD; }   // 续字节或超长的2字节序列
+    else if (s[0] < 0xE0) { code = s[0] & 0x1F; n = 1; }
+    else if (s[0] < 0xF0) { code = s[0] & 0x0F; n = 2; }
+    else if (s[0] < 0xF5) { code = s[0] & 0x07; n = 3; }
+    else                  { *String += 1; return 0xFFFD; }
+
+    for (i = 1; i <= n; i++)
+    {
+        if ((s[i] & 0xC0) != 0x80) { *String += 1; return 0xFFFD; }
+        code = (code << 6) | (s[i] & 0x3F);
+    }
+    /*拒绝超长编码、代理项(U+D800~U+DFFF)与超出Unicode范围的码点*/
+    if ((n == 2 && (code < 0x800 || (code >= 0xD800 && code <= 0xDFFF))) ||
+        (n == 3 && (code < 0x10000 || code > 0x10FFFF)))
+    {
+        *String += 1;
+        return 0xFFFD;
+    }
+    *String += n + 1;
+    return code;
+}
+
+/**
+  * @brief 在非ASCII字形表中二分查找码点
+  * @param Wide 字形表，可为NULL
+  * @param Code Unicode码点
+  * @return 字模首地址，表中没有该字时返回NULL
+  * @note 码点表升序排列，n个字最多比较 log2(n)+1 次
+  */
+static const uint8_t *OLED_WideGlyph(const OLED_WideFont *Wide, uint32_t Code)
+{
+    uint16_t lo = 0, hi, mid;
+
+    if (Wide == NULL || Code > 0xFFFF) return NULL;
+    hi = Wide->Count;
+    while (lo < hi)
+    {
+        mid = (uint16_t)((lo + hi) >> 1);
+        if (Wide->Code[mid] < Code)      lo = (uint16_t)(mid + 1);
+        else if (Wide->Code[mid] > Code) hi = mid;
+        else return Wide->Glyphs + (uint32_t)mid * Wide->Width * ((Wide->Height + 7) >> 3);
+    }
+    return NULL;
+}
+
+/**
+  * @brief 非ASCII字形相对字体顶端的纵向偏移：与ASCII字形垂直居中对齐
+  * @note 6x8字体配12x12中文时为-2，即中文上下各超出ASCII行2像素
+  */
+static inline int16_t OLED_WideOffset(const OLED_Font *Font)
+{
+    return (int16_t)(((int16_t)Font->Height - (int16_t)Font->Wide->Height) / 2);
+}
+
+/*----------------------字形内核----------------------*/
+
+
+/*----------------------格式化输出(仅供内部文字函数使用)----------------------*/
+
+#define OLED_FMT_LEFT       0x01    // '-'：左对齐
+#define OLED_FMT_ZERO       0x02    // '0'：用0补足宽度
+#define OLED_FMT_PLUS       0x04    // '+'：正数也显示符号
+#define OLED_FMT_SPACE      0x08    // ' '：正数前留一个空格
+#define OLED_FMT_FRA_MAX    9       // %f/%k 的最大小数位数
+
+/**
+  * @brief 按宽度与对齐方式输出一个字段：[空格][符号][0][正文][空格]
+  * @param Sign 符号字符，0表示没有
+  * @param Body 正文(已格式化好的数字或字符串)，Len 为其长度
+  * @param Zeros 正文前的0的个数(整数的精度)
+  * @param Width 最小字段宽度
+  * @return 0：Put要求停止
+  */
+static uint8_t OLED_FormatField(OLED_FormatSink *Sink, char Sign, const char *Body, uint16_t Len,
+                                uint16_t Zeros, int16_t Width, uint8_t Flags)
+{
+    int16_t pad = (int16_t)(Width - (int16_t)(Len + Zeros + (Sign ? 1 : 0)));
+
+    if (!(Flags & OLED_FMT_LEFT))
+    {
+        if (Flags & OLED_FMT_ZERO) { Zeros = (uint16_t)(Zeros + (pad > 0 ? pad : 0)); }
+        else { for (; pad > 0; pad--) if (!Sink->Put(Sink, ' ')) return 0; }
+        pad = 0;
+    }
+    if (Sign && !Sink->Put(Sink, Sign)) return 0;
+    for (; Zeros > 0; Zeros--) if (!Sink->Put(Sink, '0')) return 0;
+    for (; Len > 0; Len--) if (!Sink->Put(Sink, *Body++)) return 0;
+    for (; pad > 0; pad--) if (!Sink->Put(Sink, ' ')) return 0;
+    return 1;
+}
+
+/**
+  * @brief 把无符号数按进制写成字符，从End往前写
+  * @return 第一个字符的位置
+  */
+static char *OLED_FormatUInt(char *End, unsigned long long Value, uint8_t Base, uint8_t Upper)
+{
+    const char *digits = Upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    /*32位以内走32位除法，避免在Cortex-M3上调用64位除法库函数*/
+    while (Value > 0xFFFFFFFFULL) { *--End = digits[Value % Base]; Value /= Base; }
+    {
+        uint32_t v = (uint32_t)Value;
+        do { *--End = digits[v % Base]; v /= Base; } while (v);
+    }
+    return End;
+}
+
+/**
+  * @brief 精简版printf引擎：格式化结果逐字符交给Sink，不用中间字符串，不调用libc的vsprintf
+  * @param format 格式字符串，支持 %[-0+ ][宽度][.精度][hh|h|l|ll]d/i/u/x/X/c/s/f/F/k 与 %%，宽度/精度可以是*；
+  *        hh/h 与printf一样把整数参数截断为(signed/unsigned) char/short，如 ("%hhu", 300) 显示 "44"
+  * @note %f：double，默认6位小数、最多9位，四舍五入(恰好在中间时进位，与libc的"银行家舍入"可能差最后一位)，
+  *       整数部分范围同 OLED_ShowFloatNum(±4294967295)，超出显示"ovf"；nan/inf 显示为"nan"/"inf".
+  *       %k：定点数扩展，参数为整数，精度为小数位数，如 ("%.2k", 1234) 显示 "12.34"，全程不用浮点.
+  *       不认识的转换说明原样输出.
+  * @note 每个转换说明只用栈上24字节的数字暂存区
+  */
+static void OLED_Format(OLED_FormatSink *Sink, const char *format, va_list arg)
+{
+    char buf[24];
+    char *end = buf + sizeof(buf);
+
+    while (*format)
+    {
+        const char *spec = format;
+        uint8_t flags = 0, lng = 0, shrt = 0;
+        int16_t width = 0, prec = -1;
+        char sign = 0, conv;
+        char *p;
+
+        if (*format != '%')
+        {
+            if (!Sink->Put(Sink, *format++)) return;
+            continue;
+        }
+        format++;
+
+        /*标志、宽度、精度、长度*/
+        for (;; format++)
+        {
+            if      (*format == '-') flags |= OLED_FMT_LEFT;
+            else if (*format == '0') flags |= OLED_FMT_ZERO;
+            else if (*format == '+') flags |= OLED_FMT_PLUS;
+            else if (*format == ' ') flags |= OLED_FMT_SPACE;
+            else break;
+        }
+        if (*format == '*')
+        {
+            width = (int16_t)va_arg(arg, int);
+            if (width < 0) { flags |= OLED_FMT_LEFT; width = (int16_t)-width; }
+            format++;
+        }
+        else while (*format >= '0' && *format <= '9') width = (int16_t)(width * 10 + (*format++ - '0'));
+        if (*format == '.')
+        {
+            format++;
+            prec = 0;
+            if (*format == '*') { prec = (int16_t)va_arg(arg, int); format++; if (prec < 0) prec = -1; }
+            else while (*format >= '0' && *format <= '9') prec = (int16_t)(prec * 10 + (*format++ - '0'));
+        }
+        while (*format == 'h') { shrt++; format++; }
+        while (*format == 'l') { lng++; format++; }
+
+        conv = *format++;
+        switch (conv)
+        {
+            case 'd': case 'i': case 'k':
+            {
+                long long v = (lng >= 2) ? va_arg(arg, long long) : (lng == 1) ? va_arg(arg, long) : va_arg(arg, int);
+                unsigned long long u;
+                /*hh/h：参数按int传入，与printf一样先截断为signed char/short*/
+                if (lng == 0 && shrt >= 2)      v = (signed char)v;
+                else if (lng == 0 && shrt == 1) v = (short)v;
+                u = (v < 0) ? (unsigned long long)0 - (unsigned long long)v : (unsigned long long)v;
+                uint16_t zeros = 0;
+
+                sign = (v < 0) ? '-' : (flags & OLED_FMT_PLUS) ? '+' : (flags & OLED_FMT_SPACE) ? ' ' : 0;
+                p = OLED_FormatUInt(end, u, 10, 0);
+                if (conv == 'k')
+                {
+                    /*定点数：在倒数第prec位前插入小数点，位数不够时补0*/
+                    int16_t fra = (prec < 0) ? 0 : (prec > OLED_FMT_FRA_MAX ? OLED_FMT_FRA_MAX : prec);
+                    if (fra > 0)
+                    {
+                        char *q;
+                        while (end - p < fra + 1) *--p = '0';
+                        for (q = p - 1; q < end - fra - 1; q++) q[0] = q[1];
+                        p--;
+                        end[-fra - 1] = '.';
+                    }
+                    if (flags & OLED_FMT_LEFT) flags &= (uint8_t)~OLED_FMT_ZERO;
+                }
+                else
+                {
+                    if (prec >= 0) { flags &= (uint8_t)~OLED_FMT_ZERO; if (prec == 0 && u == 0) p = end; }
+                    if (prec > end - p) zeros = (uint16_t)(prec - (end - p));
+                }
+                if (!OLED_FormatField(Sink, sign, p, (uint16_t)(end - p), zeros, width, flags)) return;
+                break;
+            }
+            case 'u': case 'x': case 'X':
+            {
+                unsigned long long u = (lng >= 2) ? va_arg(arg, unsigned long long)
+                                     : (lng == 1) ? va_arg(arg, unsigned long) : va_arg(arg, unsigned int);
+                uint16_t zeros = 0;
+
+                if (lng == 0 && shrt >= 2)      u = (unsigned char)u;
+                else if (lng == 0 && shrt == 1) u = (unsigned short)u;
+                p = OLED_FormatUInt(end, u, (conv == 'u') ? 10 : 16, (uint8_t)(conv == 'X'));
+                if (prec >= 0) { flags &= (uint8_t)~OLED_FMT_ZERO; if (prec == 0 && u == 0) p = end; }
+                if (prec > end - p) zeros = (uint16_t)(prec - (end - p));
+                if (!OLED_FormatField(Sink, 0, p, (uint16_t)(end - p), zeros, width, flags)) return;
+                break;
+            }
+            case 'f': case 'F':
+            {
+                double v = va_arg(arg, double);
+                int16_t fra = (prec < 0) ? 6 : (prec > OLED_FMT_FRA_MAX ? OLED_FMT_FRA_MAX : prec);
+
+                if (v < 0) { v = -v; sign = '-'; }
+                else sign = (flags & OLED_FMT_PLUS) ? '+' : (flags & OLED_FMT_SPACE) ? ' ' : 0;
+                if (v != v || v > 4294967295.0)
+                {
+                    /*nan / inf / 超出范围：不补0*/
+                    const char *t = (v != v) ? "nan" : (v - v != v - v) ? "inf" : "ovf";
+                    if (!OLED_FormatField(Sink, sign, t, 3, 0, width, (uint8_t)(flags & ~OLED_FMT_ZERO))) return;
+                    break;
+                }
+                {
+                    uint32_t ip = (uint32_t)v, pow = 1, fp;
+                    int16_t k;
+                    uint8_t carry;
+
+                    for (k = 0; k < fra; k++) pow *= 10;
+                    /*小数部分乘到整数后四舍五入，进位加回整数部分*/
+                    fp = (uint32_t)((v - (double)ip) * (double)pow + 0.5);
+                    carry = (uint8_t)(fp >= pow);
+                    if (carry) fp -= pow;
+                    p = end;
+                    for (k = 0; k < fra; k++) { *--p = (char)('0' + fp % 10); fp /= 10; }
+                    if (fra > 0) *--p = '.';
+                    p = OLED_FormatUInt(p, (unsigned long long)ip + carry, 10, 0);
+                }
+                if (!OLED_FormatField(Sink, sign, p, (uint16_t)(end - p), 0, width, flags)) return;
+                break;
+            }
+            case 'c':
+                buf[0] = (char)va_arg(arg, int);
+                if (!OLED_FormatField(Sink, 0, buf, 1, 0, width, (uint8_t)(flags & ~OLED_FMT_ZERO))) return;
+                break;
+            case 's':
+            {
+                const char *str = va_arg(arg, const char *);
+                uint16_t len = 0;
+
+                if (str == NULL) str = "(null)";
+                while (str[len] && (prec < 0 || len < (uint16_t)prec)) len++;
+                if (!OLED_FormatField(Sink, 0, str, len, 0, width, (uint8_t)(flags & ~OLED_FMT_ZERO))) return;
+                break;
+            }
+            case '%':
+                if (!Sink->Put(Sink, '%')) return;
+                break;
+            default:
+                /*不支持的转换说明：原样输出*/
+                if (conv == '\0') format--;
+                while (spec < format) if (!Sink->Put(Sink, *spec++)) return;
+                break;
+        }
+    }
+}
+
+/**
+  * @brief 直接绘制的Put：把字符画在Sink->X处并右移一个字宽
+  * @note 完全在裁剪区左侧的字符只前进不绘制，越过裁剪区右边后返回0结束格式化
+  */
+static uint8_t OLED_FormatPutGlyph(OLED_FormatSink *Sink, char Char)
+{
+    if (Sink->X > oled_clip.X1) return 0;
+    if (Sink->X > oled_clip.X0 - (int32_t)Sink->FontSize)
+    {
+        OLED_BlitGlyph((int16_t)Sink->X, Sink->Page, Sink->Shift, OLED_GetGlyph(Char, Sink->FontSize),
+                       Sink->FontSize, Sink->Height, Sink->Rop);
+    }
+    Sink->X += Sink->FontSize;
+    return 1;
+}
+
+#define OLED_NUM_WIDTH_MAX  20      // OLED_ShowFixedNum 的最大字段宽度(决定栈上字符串的大小)
+
+/**
+  * @brief 把定点数 Value/10^Scale 写成字符串，供 OLED_ShowFixedNum 与 OLED_ListShowFixedNum 共用
+  * @param String 输出，至少 OLED_NUM_WIDTH_MAX+2 字节
+  * @param Value 定点数的整数表示；Scale 为其中的小数位数，范围：0~9
+  * @param FraLength 显示的小数位数，范围：0~9，少于Scale时四舍五入(恰好一半时远离0)，多于Scale时补0
+  * @param Width 数字部分(不含符号)的最大字符数，范围：0~OLED_NUM_WIDTH_MAX，0表示不限
+  * @return 字符串长度(含符号)，0：Width个字符内放不下
+  * @note 只用32位整数的除10与取余，没有浮点运算；舍入后为0的负数不显示负号
+  */
+static uint8_t OLED_FixedToString(char *String, int32_t Value, uint8_t Scale, uint8_t FraLength, uint8_t Width, uint8_t Flags)
+{
+    static const uint32_t pow10[10] = {1, 10, 100, 1000, 10000, 100000, 1000000,
+                                       10000000, 100000000, 1000000000};
+    char buf[OLED_NUM_WIDTH_MAX + 1];
+    char *end = buf + sizeof(buf), *p;
+    uint32_t mag = (Value < 0) ? 0u - (uint32_t)Value : (uint32_t)Value, m;
+    uint8_t len = 0, k;
+
+    if (Scale > 9) Scale = 9;
+    if (FraLength > 9) FraLength = 9;
+    if (Width > OLED_NUM_WIDTH_MAX) Width = OLED_NUM_WIDTH_MAX;
+
+    for (;;)
+    {
+        m = mag;
+        p = end;
+        if (FraLength < Scale)
+        {
+            /*舍去多余的小数位：比较余数与除数的一半，避免 m+q/2 溢出*/
+            uint32_t q = pow10[Scale - FraLength], r = m % q;
+            m /= q;
+            if (r >= q - r) m++;
+            k = FraLength;
+        }
+        else
+        {
+            for (k = FraLength; k > Scale; k--) *--p = '0';
+        }
+        for (; k > 0; k--) { *--p = (char)('0' + m % 10); m /= 10; }
+        if (FraLength) *--p = '.';
+        do { *--p = (char)('0' + m % 10); m /= 10; } while (m);
+
+        if (Flags & OLED_NUM_ZERO) while (end - p < Width) *--p = '0';
+        if (Width == 0 || end - p <= Width) break;
+        if (!(Flags & OLED_NUM_FIT) || FraLength == 0) return 0;
+        FraLength--;
+    }
+
+    /*显示出来的数字全为0时不带负号*/
+    for (k = 0; k < end - p; k++) if (p[k] > '0') break;
+    if (Value < 0 && k < end - p) String[len++] = '-';
+    else if (Flags & OLED_NUM_PLUS) String[len++] = '+';
+    memcpy(&String[len], p, (size_t)(end - p));
+    len = (uint8_t)(len + (end - p));
+    String[len] = '\0';
+    return len;
+}
+
+/*----------------------格式化输出----------------------*/
+
+
+/*----------------------位图内核(仅供内部图像函数使用)----------------------*/
+
+/**
+  * @brief 把一段已按页对齐的位图列字节混合进显存的一页
+  * @param Dst 显存中该页的起始字节
+  * @param Hi 提供本页低位部分的取模行(左移Hs位)
+  * @param Lo 提供本页高位部分的上一取模行(右移Ls位)
+  * @param Hs Ls 移位量，为8时该半边贡献为0(用于图像的首页/尾页)
+  * @param Count 列数
+  * @param Keep 覆盖模式下本页要保留的位(图像矩形之外以及裁剪区之外)，其它模式忽略
+  * @param Mask 本页落在裁剪区内的位，之外的位不改变
+  * @param Mode OLED_IMAGE_COPY/OR/XOR/ANDNOT，其它值按OR处理
+  * @note 每个显存字节只读写一次，内层循环无分支.
+  */
+static void OLED_BlendSpan(uint8_t *Dst, const uint8_t *Hi, const uint8_t *Lo, uint8_t Hs, uint8_t Ls,
+                           int16_t Count, uint8_t Keep, uint8_t Mask, uint8_t Mode)
+{
+    int16_t i;
+
+    switch (Mode)
+    {
+        case OLED_IMAGE_COPY:
+            for (i = 0; i < Count; i++) Dst[i] = (uint8_t)((Dst[i] & Keep) | (((Hi[i] << Hs) | (Lo[i] >> Ls)) & Mask));
+            break;
+        case OLED_IMAGE_XOR:
+            for (i = 0; i < Count; i++) Dst[i] ^= (uint8_t)(((Hi[i] << Hs) | (Lo[i] >> Ls)) & Mask);
+            break;
+        case OLED_IMAGE_ANDNOT:
+            for (i = 0; i < Count; i++) Dst[i] &= (uint8_t)~(((Hi[i] << Hs) | (Lo[i] >> Ls)) & Mask);
+            break;
+        default:
+            for (i = 0; i < Count; i++) Dst[i] |= (uint8_t)(((Hi[i] << Hs) | (Lo[i] >> Ls)) & Mask);
+            break;
+    }
+}
+
+/**
+  * @brief 把一段带遮罩的精灵列字节混合进显存的一页
+  * @param Dst 显存中该页的起始字节
+  * @param Img Msk 图像平面与遮罩平面中提供本页的取模行(未移位)
+  * @param ImgLo MskLo 上一取模行，用于不对齐时拼出本页高位部分；页对齐时为NULL
+  * @param Hs Ls 移位量：本页 = (取模行 << Hs) | (上一取模行 >> Ls)，为8时该半边贡献为0(精灵的首页/尾页)
+  * @param Count 列数
+  * @param Clip 本页落在精灵矩形与裁剪区内的位，之外的位不改变
+  * @param Mode OLED_SPRITE_MASK/XOR/INVERT
+  * @note 页对齐时每列只取两个字节，不做拼接；每个显存字节只读写一次，内层循环无分支.
+  */
+static void OLED_SpriteSpan(uint8_t *Dst, const uint8_t *Img, const uint8_t *Msk, const uint8_t *ImgLo, const uint8_t *MskLo,
+                            uint8_t Hs, uint8_t Ls, int16_t Count, uint8_t Clip, uint8_t Mode)
+{
+    int16_t i;
+    uint8_t v, m;
+
+    if (ImgLo == NULL)
+    {
+        /*页对齐：直接使用取模字节*/
+        switch (Mode)
+        {
+            case OLED_SPRITE_XOR:
+                for (i = 0; i < Count; i++) Dst[i] ^= (uint8_t)(Img[i] & Msk[i] & Clip);
+                break;
+            case OLED_SPRITE_INVERT:
+                for (i = 0; i < Count; i++) { m = (uint8_t)(Msk[i] & Clip); Dst[i] = (uint8_t)((Dst[i] & ~m) | (~Img[i] & m)); }
+                break;
+            default:
+                for (i = 0; i < Count; i++) { m = (uint8_t)(Msk[i] & Clip); Dst[i] = (uint8_t)((Dst[i] & ~m) | (Img[i] & m)); }
+                break;
+        }
+        return;
+    }
+
+    switch (Mode)
+    {
+        case OLED_SPRITE_XOR:
+            for (i = 0; i < Count; i++)
+            {
+                v = (uint8_t)((Img[i] << Hs) | (ImgLo[i] >> Ls));
+                m = (uint8_t)(((Msk[i] << Hs) | (MskLo[i] >> Ls)) & Clip);
+                Dst[i] ^= (uint8_t)(v & m);
+            }
+            break;
+        case OLED_SPRITE_INVERT:
+            for (i = 0; i < Count; i++)
+            {
+                v = (uint8_t)((Img[i] << Hs) | (ImgLo[i] >> Ls));
+                m = (uint8_t)(((Msk[i] << Hs) | (MskLo[i] >> Ls)) & Clip);
+                Dst[i] = (uint8_t)((Dst[i] & ~m) | (~v & m));
+            }
+            break;
+        default:
+            for (i = 0; i < Count; i++)
+            {
+                v = (uint8_t)((Img[i] << Hs) | (ImgLo[i] >> Ls));
+                m = (uint8_t)(((Msk[i] << Hs) | (MskLo[i] >> Ls)) & Clip);
+                Dst[i] = (uint8_t)((Dst[i] & ~m) | (v & m));
+            }
+            break;
+    }
+}
+
+/**
+  * @brief 从PackBits压缩流中取出下一个字节
+  * @note 头字节 0~127：后跟n+1个原样字节；-1~-127：后跟1个字节重复1-n次；-128：空操作
+  */
+static inline uint8_t OLED_UnpackByte(OLED_Unpacker *u)
+{
+    uint8_t b;
+
+    while (u->Left == 0)
+    {
+        int8_t h = (int8_t)*u->Src++;
+        if (h >= 0)         { u->Left = (uint8_t)(h + 1); u->Repeat = 0; }
+        else if (h != -128) { u->Left = (uint8_t)(1 - h); u->Repeat = 1; }
+    }
+    u->Left--;
+    if (!u->Repeat) return *u->Src++;
+    b = *u->Src;
+    if (u->Left == 0) u->Src++;         // 重复字节在游程结束时才跳过
+    return b;
+}
+
+/**
+  * @brief 在PackBits压缩流中跳过Count个字节(被裁掉的列)
+  * @note 按游程整段跳过，不逐字节解码
+  */
+static void OLED_UnpackSkip(OLED_Unpacker *u, uint16_t Count)
+{
+    while (Count)
+    {
+        uint8_t k;
+        if (u->Left == 0)
+        {
+            (void)OLED_UnpackByte(u);   // 读入新游程的头并消耗一个字节
+            Count--;
+            continue;
+        }
+        k = (Count < u->Left) ? (uint8_t)Count : u->Left;
+        u->Left -= k;
+        Count   -= k;
+        if (!u->Repeat)         u->Src += k;
+        else if (u->Left == 0)  u->Src++;
+    }
+}
+
+/*----------------------位图内核----------------------*/
+
+
+/*----------------------屏幕镜像映射(仅供内部函数使用)----------------------*/
+
+#if !OLED_USE_DISPLAY_LIST
+/**
+  * @brief 求GDDRAM物理页 Page 由显存的哪几行组成
+  * @param Page 物理页，范围：0~OLED_GDDRAM_PAGES-1
+  * @param Map 输出：映射关系
+  * @note 显存第r行显示在GDDRAM第(起始行+r)%128行；不使用硬件滚动时物理页就是显存页
+  */
+static inline void OLED_MapPhysPage(uint8_t Page, OLED_PhysPage *Map)
+{
+#if OLED_USE_HW_SCROLL
+    uint8_t row = (uint8_t)((Page * 8 - oled_scroll_line) & (OLED_GDDRAM_ROWS - 1));   // 物理页第0行对应的显存行
+    uint8_t lo = row >> 3, hi = (uint8_t)((lo + 1) & (OLED_GDDRAM_PAGES - 1));
+
+    Map->Shift   = row & 7;
+    Map->LoPage  = (lo < OLED_PAGES) ? lo : 0xFF;
+    Map->HiPage  = (Map->Shift != 0 && hi < OLED_PAGES) ? hi : 0xFF;
+    Map->Visible = 0;
+    if (Map->LoPage != 0xFF) Map->Visible |= (uint8_t)(0xFF >> Map->Shift);
+    if (Map->HiPage != 0xFF) Map->Visible |= (uint8_t)(0xFF << (8 - Map->Shift));
+#else
+    Map->LoPage  = Page;
+    Map->HiPage  = 0xFF;
+    Map->Shift   = 0;
+    Map->Visible = 0xFF;
+#endif
+}
+
+/**
+  * @brief 物理页第 X 列应有的字节(备用行保持镜像中的值)
+  */
+static inline uint8_t OLED_PhysByte(const OLED_PhysPage *Map, uint8_t Page, uint8_t X)
+{
+#if OLED_USE_HW_SCROLL
+    uint8_t b = 0;
+    if (Map->LoPage != 0xFF) b  = (uint8_t)(OLED_DisplayBuf[Map->LoPage][X] >> Map->Shift);
+    if (Map->HiPage != 0xFF) b |= (uint8_t)(OLED_DisplayBuf[Map->HiPage][X] << (8 - Map->Shift));
+    return (uint8_t)((b & Map->Visible) | (OLED_FrontBuf[Page][X] & (uint8_t)~Map->Visible));
+#else
+    (void)Page;
+    return OLED_DisplayBuf[Map->LoPage][X];
+#endif
+}
+
+/**
+  * @brief 物理页的脏列范围(组成它的显存页脏列范围的并集)
+  * @return 1：有脏列，0：干净
+  */
+static inline uint8_t OLED_PhysDirty(const OLED_PhysPage *Map, int16_t *X0, int16_t *X1)
+{
+    uint8_t x0 = 0xFF, x1 = 0;
+
+    if (Map->LoPage != 0xFF) { x0 = oled_dirty_x0[Map->LoPage]; x1 = oled_dirty_x1[Map->LoPage]; }
+    if (Map->HiPage != 0xFF)
+    {
+        if (oled_dirty_x0[Map->HiPage] < x0) x0 = oled_dirty_x0[Map->HiPage];
+        if (oled_dirty_x1[Map->HiPage] > x1) x1 = oled_dirty_x1[Map->HiPage];
+    }
+    *X0 = x0;
+    *X1 = x1;
+    return (uint8_t)(x0 <= x1);
+}
+
+/**
+  * @brief 把物理页 [X, X+Count-1] 列应有的字节写进屏幕镜像(随后从镜像发送)
+  */
+static inline void OLED_SyncFront(const OLED_PhysPage *Map, uint8_t Page, uint8_t X, uint8_t Count)
+{
+#if OLED_USE_HW_SCROLL
+    for (; Count > 0; Count--, X++) OLED_FrontBuf[Page][X] = OLED_PhysByte(Map, Page, X);
+#else
+    memcpy(&OLED_FrontBuf[Page][X], &OLED_DisplayBuf[Map->LoPage][X], Count);
+#endif
+}
+
+/**
+  * @brief 把整个屏幕镜像同步为显存(映射后)的内容
+  */
+static void OLED_SyncFrontAll(void)
+{
+    OLED_PhysPage map;
+    uint8_t page;
+
+    for (page = 0; page < OLED_GDDRAM_PAGES; page++)
+    {
+        OLED_MapPhysPage(page, &map);
+        if (map.Visible) OLED_SyncFront(&map, page, 0, OLED_WIDTH);
+    }
+}
+
+/**
+  * @brief 显存第 Page 页落在哪些物理页上
+  * @return 物理页位图，第n位为1表示物理页n
+  */
+static inline uint16_t OLED_PhysPagesOf(uint8_t Page)
+{
+#if OLED_USE_HW_SCROLL
+    uint8_t row = (uint8_t)((Page * 8 + oled_scroll_line) & (OLED_GDDRAM_ROWS - 1));
+    uint16_t pages = (uint16_t)(1u << (row >> 3));
+    if (row & 7) pages |= (uint16_t)(1u << (((row >> 3) + 1) & (OLED_GDDRAM_PAGES - 1)));
+    return pages;
+#else
+    return (uint16_t)(1u << Page);
+#endif
+}
+#endif
+
+/*----------------------屏幕镜像映射----------------------*/
+
+
+/*----------------------功能函数----------------------*/
+
+#if !OLED_USE_DISPLAY_LIST
+/**
+  * @brief 将OLED显存数组更新到OLED屏幕,全屏更新：按页写入，每页 OLED_WIDTH 字节
+  * @param 无
+  * @return 无
+  * @note 所有的显示函数，都只是对OLED显存数组进行读写
+  *       随后调用OLED_Update函数或OLED_UpdateArea函数
+  *       才会将显存数组的数据发送到OLED硬件，进行显示
+  *       故调用显示函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_Update(void)
+{
+    OLED_PhysPage map;
+    uint8_t j;
+
+    OLED_WaitFlush();
+    OLED_BeginFlush();
+
+    /*屏幕内容将与显存完全一致，同步镜像并清除脏记录*/
+    OLED_SyncFrontAll();
+    OLED_ClearDirty();
+
+    if (oled_transport->WriteFrame != NULL)
+    {
+        /*水平寻址，一个CS窗口发完整帧*/
+        oled_front_valid = 1;
+        OLED_StartFrameFlush();
+        return;
+    }
+
+    for (j = 0; j < OLED_GDDRAM_PAGES; j++)
+    {
+        /*备用行只在屏幕内容未知时发送(之后镜像与GDDRAM一致，滚动进来时才不用重发)*/
+        OLED_MapPhysPage(j, &map);
+        if (map.Visible || !oled_front_valid) OLED_QueueRun(j, 0, OLED_WIDTH);
+    }
+    oled_front_valid = 1;
+    OLED_StartFlush();
+}
+
+/**
+  * @brief 只把变化的部分更新到OLED屏幕(脏区+差分刷新)
+  * @param 无
+  * @return 无
+  * @note 只检查各页被绘图函数记录为脏的列范围，并与屏幕镜像OLED_FrontBuf逐字节比较，
+  *       把不同的字节组成若干游程，每个游程用 OLED_SetCursor + 一次数据写入发送.
+  *       两个游程之间相同字节的间隔不超过 OLED_FLUSH_MERGE_GAP 时合并为一个游程
+  *       (多发几个相同字节比多发一组3字节光标命令更划算).
+  *       初始化后第一次调用(屏幕内容未知)时退化为 OLED_Update 全屏发送.
+  *       本次发送的字节数可通过 OLED_GetFlushStat 读取.
+  * @note 使用异步后端时函数排好队列后立即返回，可以马上绘制下一帧；
+  *       若上一帧还没发完，会先等待它发完.
+  */
+void OLED_UpdateDirty(void)
+{
+    OLED_PhysPage map;
+    uint8_t page;
+    int16_t x, x1, runStart, runEnd, gap;
+
+    if (!oled_front_valid)
+    {
+        OLED_Update();
+        return;
+    }
+
+    OLED_WaitFlush();
+    OLED_BeginFlush();
+
+    for (page = 0; page < OLED_GDDRAM_PAGES; page++)
+    {
+        OLED_MapPhysPage(page, &map);
+        if (!OLED_PhysDirty(&map, &x, &x1)) continue;
+
+        while (x <= x1)
+        {
+            /*找到下一个与屏幕不同的字节*/
+            while (x <= x1 && OLED_PhysByte(&map, page, (uint8_t)x) == OLED_FrontBuf[page][x]) x++;
+            if (x > x1) break;
+
+            runStart = runEnd = x;
+            if (oled_run_count + 1 + (OLED_GDDRAM_PAGES - 1 - page) >= OLED_FLUSH_MAX_RUNS)
+            {
+                /*队列将满：本页剩余脏区合成一个游程，给后面每页至少留一个位置*/
+                runEnd = x1;
+                x = x1 + 1;
+            }
+            else
+            {
+                /*向后扩展游程，相同字节的间隔超过合并阈值才断开*/
+                gap = 0;
+                for (x++; x <= x1; x++)
+                {
+                    if (OLED_PhysByte(&map, page, (uint8_t)x) != OLED_FrontBuf[page][x]) { runEnd = x; gap = 0; }
+                    else if (++gap > OLED_FLUSH_MERGE_GAP) break;
+                }
+            }
+
+            OLED_SyncFront(&map, page, (uint8_t)runStart, (uint8_t)(runEnd - runStart + 1));
+            OLED_QueueRun(page, (uint8_t)runStart, (uint8_t)(runEnd - runStart + 1));
+        }
+    }
+    OLED_ClearDirty();
+
+    /*变化太多时，游程的光标命令加上来还不如整帧突发传输划算*/
+    if (oled_transport->WriteFrame != NULL &&
+        oled_flush_stat.DataBytes + oled_flush_stat.CmdBytes >= OLED_GDDRAM_PAGES * OLED_WIDTH)
+    {
+        OLED_SyncFrontAll();   // 脏区外的字节本来就相同
+        OLED_StartFrameFlush();
+        return;
+    }
+    OLED_StartFlush();
+}
+#endif
 
 /**
-  * @brief 将OLED显存数组更新到OLED屏幕,全屏更新：按页写入，每页 OLED_WIDTH 字节
-  * @param 无
+  * @brief 读取刷新统计
+  * @param Stat 输出：最近一次刷新发送的数据/命令字节数、游程数，以及累计帧数与累计字节数
   * @return 无
-  * @note 所有的显示函数，都只是对OLED显存数组进行读写
-  *       随后调用OLED_Update函数或OLED_UpdateArea函数
-  *       才会将显存数组的数据发送到OLED硬件，进行显示
-  *       故调用显示函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
-void OLED_Update(void)
+void OLED_GetFlushStat(OLED_FlushStat *Stat)
 {
-    uint8_t j;
-    for (j = 0; j < OLED_PAGES; j++)
-    {
-        OLED_SetCursor(j, 0);
-        OLED_WriteData(OLED_DisplayBuf[j], OLED_WIDTH);
-    }
+    *Stat = oled_flush_stat;
 }
 
+/**
+  * @brief 读取显存写入计数
+  * @return 计数值，每次有绘图函数改写显存时增加(刷新不改变它)
+  * @note 记下某一时刻的值，之后再读一次比较，就能知道这段时间里显存是否被改写过，
+  *       例如界面在两次刷新之间判断显存是否仍是自己上一帧画的内容
+  */
+uint32_t OLED_GetDrawStamp(void)
+{
+    return oled_draw_stamp;
+}
+
+#if !OLED_USE_DISPLAY_LIST
 /**
   * @brief 将OLED显存数组部分更新到OLED屏幕,局部更新（自动向上取整页）
   * @param X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
@@ -412,39 +2419,75 @@ void OLED_Update(void)
   */
 void OLED_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 {
-    int16_t Page, Page1;
+    int32_t x0 = X, y0 = Y, x1 = (int32_t)X + Width - 1, y1 = (int32_t)Y + Height - 1;
     int16_t j;
+    OLED_PhysPage map;
+    uint16_t pages = 0;
+
+    uint8_t Count;
 
-    Page = Y / 8;
-    Page1 = (Y + Height - 1) / 8 + 1;
-    if (Y < 0) { Page -= 1; Page1 -= 1; }
+    /*只发送屏幕内的部分(区域伸出屏幕左/上边时也发送屏幕内剩下的部分)*/
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > OLED_WIDTH - 1)  x1 = OLED_WIDTH - 1;
+    if (y1 > OLED_HEIGHT - 1) y1 = OLED_HEIGHT - 1;
+    if (x0 > x1 || y0 > y1) return;
+    X = (int16_t)x0;
+    Count = (uint8_t)(x1 - x0 + 1);
+
+    for (j = (int16_t)(y0 >> 3); j <= (int16_t)(y1 >> 3); j++)
+    {
+        pages |= OLED_PhysPagesOf((uint8_t)j);
+    }
 
-    for (j = Page; j < Page1; j++)
+    OLED_WaitFlush();
+    OLED_BeginFlush();
+    for (j = 0; j < OLED_GDDRAM_PAGES; j++)
     {
-        if (X >= 0 && X < OLED_WIDTH && j >= 0 && j < OLED_PAGES)
+        if (pages & (1u << j))
         {
-            OLED_SetCursor((uint8_t)j, (uint8_t)X);
-            OLED_WriteData(&OLED_DisplayBuf[j][X], Width);
+            /*先同步屏幕镜像，再从镜像发送*/
+            OLED_MapPhysPage((uint8_t)j, &map);
+            OLED_SyncFront(&map, (uint8_t)j, (uint8_t)X, Count);
+            OLED_QueueRun((uint8_t)j, (uint8_t)X, Count);
         }
     }
+    OLED_StartFlush();
+}
+
+#if OLED_USE_HW_SCROLL
+/**
+  * @brief 硬件纵向滚动：屏幕内容整体上移 Lines 行
+  * @param Lines 上移的行数，正数上移(下方露出新行)，负数下移
+  * @return 无
+  * @note 只改显示起始行(命令随下一次刷新发出)，GDDRAM里已有的内容不用重发.
+  *       调用者照常把新位置的整屏画进显存，OLED_UpdateDirty 按新的起始行把显存与屏幕镜像比较，
+  *       一般只剩新露出的行和不随内容滚动的部分(光标/滚动条)需要发送.
+  *       起始行只有6位，超出0~63时回绕，回绕那一帧映射变化大，差分刷新会多发一些字节
+  */
+void OLED_ScrollLines(int16_t Lines)
+{
+    oled_scroll_line = (uint8_t)((oled_scroll_line + Lines) & (OLED_START_LINES - 1));
+    oled_pending_start_line = (int8_t)oled_scroll_line;
+
+    /*每一行的显示位置都变了，下次刷新整屏参与比较(比较很快，发送的仍只是不同的字节)*/
+    OLED_MarkDirty(0, OLED_PAGES - 1, 0, OLED_WIDTH - 1);
 }
+#endif
+#endif
 
 /**
   * @brief 将OLED显存(缓存)数组全部清零
   * @param 无
   * @return 无
+  * @note 与裁剪区无关，总是作用于整屏；只清裁剪区请用 OLED_ClearArea
   * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
 void OLED_Clear(void)
 {
-    uint8_t page, col;
-    for (page = 0; page < OLED_PAGES; page++)
-    {
-        for (col = 0; col < OLED_WIDTH; col++)
-        {
-            OLED_DisplayBuf[page][col] = 0x00;
-        }
-    }
+    OLED_MarkDirty(0, OLED_PAGES - 1, 0, OLED_WIDTH - 1);
+    /*整块清零，库函数按32位字写*/
+    memset(OLED_TARGET_BUF, 0, OLED_BUF_WORDS * 4);
 }
 /**
   * @brief 将OLED显存(缓存)数组部分清零
@@ -457,35 +2500,25 @@ void OLED_Clear(void)
   */
 void OLED_ClearArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 {
-    int16_t i, j;
-    for (j = Y; j < Y + Height; j++)
-    {
-        for (i = X; i < X + Width; i++)
-        {
-            if (i >= 0 && i < OLED_WIDTH && j >= 0 && j < OLED_HEIGHT)
-            {
-                OLED_DisplayBuf[j / 8][i] &= ~(0x01 << (j % 8));
-            }
-        }
-    }
+    /*裁剪一次，按页掩码整字节清零*/
+    OLED_FillRect(X, Y, Width, Height, OLED_ROP_CLEAR);
 }
 /**
   * @brief 将OLED显存(缓存)数组全部取反
   * @param 无
   * @return 无
+  * @note 与裁剪区无关，总是作用于整屏
   * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
 void OLED_Reverse(void)
 {
-    uint8_t p, c;
-    for (p = 0; p < OLED_PAGES; p++)
-    {
-        for (c = 0; c < OLED_WIDTH; c++)
-        {
-            OLED_DisplayBuf[p][c] ^= 0xFF;
-        }
-    }
-}	
+    uint8_t *p = &OLED_TARGET_BUF[0][0];
+    uint16_t n = OLED_BUF_WORDS;
+
+    OLED_MarkDirty(0, OLED_PAGES - 1, 0, OLED_WIDTH - 1);
+    /*按32位字取反，每次处理4个字节*/
+    while (n--) { OLED_StoreWord(p, ~OLED_LoadWord(p)); p += 4; }
+}
 /**
   * @brief 将OLED显存(缓存)数组部分取反
   * @param X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
@@ -497,19 +2530,237 @@ void OLED_Reverse(void)
   */
 void OLED_ReverseArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 {
-    int16_t i, j;
-    for (j = Y; j < Y + Height; j++)
+    /*裁剪一次，按页掩码整字节取反*/
+    OLED_FillRect(X, Y, Width, Height, OLED_ROP_XOR);
+}
+
+/**
+  * @brief 将OLED显存(缓存)数组的指定区域填充为指定值
+  * @param X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定区域左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Width 指定区域的宽度，范围：0~255
+  * @param Height 指定区域的高度，范围：0~255
+  * @param Value 填充值，0：熄灭，非0：点亮
+  * @return 无
+  * @note 与绘图模式无关；未设置裁剪区且区域覆盖整屏时按32位字填充
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_FillArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t Value)
+{
+    if (oled_clip_depth == 0 && X <= 0 && Y <= 0 && X + Width >= OLED_WIDTH && Y + Height >= OLED_HEIGHT)
+    {
+        OLED_MarkDirty(0, OLED_PAGES - 1, 0, OLED_WIDTH - 1);
+        memset(OLED_TARGET_BUF, Value ? 0xFF : 0x00, OLED_BUF_WORDS * 4);
+        return;
+    }
+    OLED_FillRect(X, Y, Width, Height, Value ? OLED_ROP_SET : OLED_ROP_CLEAR);
+}
+
+/**
+  * @brief 8x8 Bayer有序抖动阈值矩阵，[行][列]
+  * @note 阈值小于Level的像素点亮；Level越大点亮的像素越多，且低Level点亮的像素在高Level下仍点亮，
+  *       16为(偶数行,偶数列)，32为棋盘格，48为除(奇数行,偶数列)外的全部像素
+  */
+static const uint8_t OLED_Bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+/**
+  * @brief 将OLED显存(缓存)数组的指定区域与抖动图案按位运算
+  * @param X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定区域左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Width 指定区域的宽度，范围：0~255
+  * @param Height 指定区域的高度，范围：0~255
+  * @param Level 图案中点亮像素的比例，范围：0~64(OLED_PATTERN_LEVELS)，单位1/64，
+  *              常用 OLED_PATTERN_1_4 / OLED_PATTERN_1_2 / OLED_PATTERN_3_4
+  * @param Op 运算方式，OLED_PATTERN_AND：只保留图案中的像素(变暗、虚化)，
+  *           OLED_PATTERN_OR：点亮图案中的像素(网纹底色)，OLED_PATTERN_XOR：翻转图案中的像素
+  * @return 无
+  * @note 图案按屏幕坐标对齐，相邻区域分几次填充也能无缝拼接；与绘图模式无关，只作用于裁剪区内.
+  *       每列的图案正好是一个页字节，按页掩码一次处理8行，对齐的部分按32位字一次处理4列
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_FillPattern(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t Level, uint8_t Op)
+{
+    uint8_t pat[8];
+    uint32_t patWord[2];
+    int32_t x0 = X, y0 = Y, x1 = (int32_t)X + Width - 1, y1 = (int32_t)Y + Height - 1;
+    uint8_t page, pageStart, pageEnd, mask, r, c;
+
+    /*裁剪到当前裁剪区(裁剪区总在屏幕内)*/
+    if (Width == 0 || Height == 0) return;
+    if (x0 < oled_clip.X0) x0 = oled_clip.X0;
+    if (y0 < oled_clip.Y0) y0 = oled_clip.Y0;
+    if (x1 > oled_clip.X1) x1 = oled_clip.X1;
+    if (y1 > oled_clip.Y1) y1 = oled_clip.Y1;
+    if (x0 > x1 || y0 > y1) return;
+
+    /*第c列的图案字节：第r位对应页内第r行*/
+    for (c = 0; c < 8; c++)
     {
-        for (i = X; i < X + Width; i++)
+        uint8_t b = 0;
+        for (r = 0; r < 8; r++)
         {
-            if (i >= 0 && i < OLED_WIDTH && j >= 0 && j < OLED_HEIGHT)
-            {
-                OLED_DisplayBuf[j / 8][i] ^= (0x01 << (j % 8));
-            }
+            if (OLED_Bayer8[r][c] < Level) b |= (uint8_t)(1 << r);
+        }
+        pat[c] = b;
+    }
+    /*按4列拼成的32位字，x&4 为0和1时各一个*/
+    patWord[0] = OLED_LoadWord(&pat[0]);
+    patWord[1] = OLED_LoadWord(&pat[4]);
+
+    pageStart = (uint8_t)(y0 >> 3);
+    pageEnd   = (uint8_t)(y1 >> 3);
+    OLED_MarkDirty(pageStart, pageEnd, (uint8_t)x0, (uint8_t)x1);
+
+    for (page = pageStart; page <= pageEnd; page++)
+    {
+        uint8_t *row = OLED_TARGET_ROW(page);
+        uint32_t wm;
+        int16_t x = (int16_t)x0;
+
+        mask = 0xFF;
+        if (page == pageStart) mask &= (uint8_t)(0xFF << (y0 & 0x07));
+        if (page == pageEnd)   mask &= (uint8_t)(0xFF >> (7 - (y1 & 0x07)));
+        wm = mask * 0x01010101UL;
+
+        /*AND时区域外的位要保持不变，所以与 ~mask 合并后再与*/
+        switch (Op)
+        {
+            case OLED_PATTERN_AND:
+                for (; x <= x1 && (x & 3) != 0; x++) row[x] &= (uint8_t)(pat[x & 7] | ~mask);
+                for (; x + 3 <= x1; x += 4) OLED_StoreWord(&row[x], OLED_LoadWord(&row[x]) & (patWord[(x >> 2) & 1] | ~wm));
+                for (; x <= x1; x++) row[x] &= (uint8_t)(pat[x & 7] | ~mask);
+                break;
+            case OLED_PATTERN_OR:
+                for (; x <= x1 && (x & 3) != 0; x++) row[x] |= (uint8_t)(pat[x & 7] & mask);
+                for (; x + 3 <= x1; x += 4) OLED_StoreWord(&row[x], OLED_LoadWord(&row[x]) | (patWord[(x >> 2) & 1] & wm));
+                for (; x <= x1; x++) row[x] |= (uint8_t)(pat[x & 7] & mask);
+                break;
+            case OLED_PATTERN_XOR:
+                for (; x <= x1 && (x & 3) != 0; x++) row[x] ^= (uint8_t)(pat[x & 7] & mask);
+                for (; x + 3 <= x1; x += 4) OLED_StoreWord(&row[x], OLED_LoadWord(&row[x]) ^ (patWord[(x >> 2) & 1] & wm));
+                for (; x <= x1; x++) row[x] ^= (uint8_t)(pat[x & 7] & mask);
+                break;
+            default:
+                return;
         }
     }
 }
 
+#if !OLED_USE_DISPLAY_LIST
+/**
+  * @brief OLED_ScrollRegion 的单页内核：dst = (dst & ~M) | ((Lo & ML) >> LoShift | (Hi & MH) << HiShift) & M
+  * @param Lo Hi 提供低位/高位的源页，ML MH 为源页中属于区域的行(0表示不取)
+  * @note 对齐的部分按32位字一次处理4列，移位后用逐字节复制的掩码去掉跨字节的位
+  */
+static void OLED_ScrollRow(uint8_t *Dst, const uint8_t *Lo, const uint8_t *Hi, uint8_t M, uint8_t ML, uint8_t MH,
+                           uint8_t LoShift, uint8_t HiShift, uint8_t X0, uint8_t X1)
+{
+    const uint32_t rep = 0x01010101UL;
+    uint32_t wm = M * rep, wl = ML * rep, wh = MH * rep;
+    uint32_t kl = (uint8_t)(0xFF >> LoShift) * rep, kh = (uint8_t)(0xFF << HiShift) * rep;
+    uint8_t v;
+    int16_t x = X0;
+
+    /*LoShift或HiShift为8时对应的源页掩码一定为0，移位结果也按0处理*/
+    if (LoShift > 7) { wl = 0; ML = 0; LoShift = 0; }
+    if (HiShift > 7) { wh = 0; MH = 0; HiShift = 0; }
+
+    for (; x <= X1 && (x & 3) != 0; x++)
+    {
+        v = (uint8_t)(((Lo[x] & ML) >> LoShift) | ((Hi[x] & MH) << HiShift));
+        Dst[x] = (uint8_t)((Dst[x] & ~M) | (v & M));
+    }
+    for (; x + 3 <= X1; x += 4)
+    {
+        uint32_t w = (((OLED_LoadWord(&Lo[x]) & wl) >> LoShift) & kl)
+                   | (((OLED_LoadWord(&Hi[x]) & wh) << HiShift) & kh);
+        OLED_StoreWord(&Dst[x], (OLED_LoadWord(&Dst[x]) & ~wm) | (w & wm));
+    }
+    for (; x <= X1; x++)
+    {
+        v = (uint8_t)(((Lo[x] & ML) >> LoShift) | ((Hi[x] & MH) << HiShift));
+        Dst[x] = (uint8_t)((Dst[x] & ~M) | (v & M));
+    }
+}
+
+/**
+  * @brief 将显存中指定区域的内容整体上下平移
+  * @param X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定区域左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Width 指定区域的宽度，范围：0~255
+  * @param Height 指定区域的高度，范围：0~255
+  * @param Dy 平移的行数，正数下移，负数上移，可以不是8的倍数
+  * @return 无
+  * @note 移出区域的内容丢弃，空出来的行清零(之后只需在这些行里绘制新露出的内容)；
+  *       区域先裁剪到当前裁剪区，区域外的像素不变.
+  *       按页字节整体移位，跨页的位由相邻页补上，每个字节只读写一次
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_ScrollRegion(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, int16_t Dy)
+{
+    int32_t x0 = X, y0 = Y, x1 = (int32_t)X + Width - 1, y1 = (int32_t)Y + Height - 1;
+    uint8_t mask[OLED_PAGES];
+    int16_t p0, p1, p, pa, pb, step, shift;
+    uint8_t q, r, ma, mb, m;
+    const uint8_t *sa, *sb;
+    uint8_t *dst;
+
+    if (x0 < oled_clip.X0) x0 = oled_clip.X0;
+    if (y0 < oled_clip.Y0) y0 = oled_clip.Y0;
+    if (x1 > oled_clip.X1) x1 = oled_clip.X1;
+    if (y1 > oled_clip.Y1) y1 = oled_clip.Y1;
+    if (x0 > x1 || y0 > y1 || Dy == 0) return;
+
+    shift = (Dy < 0) ? (int16_t)-Dy : Dy;
+    if (shift > y1 - y0)
+    {
+        /*整个区域都移出去了*/
+        OLED_FillRect((int16_t)x0, (int16_t)y0, (uint16_t)(x1 - x0 + 1), (uint16_t)(y1 - y0 + 1), OLED_ROP_CLEAR);
+        return;
+    }
+
+    p0 = (int16_t)(y0 >> 3);
+    p1 = (int16_t)(y1 >> 3);
+    for (p = p0; p <= p1; p++)
+    {
+        m = 0xFF;
+        if (y0 > p * 8) m = (uint8_t)(m << (y0 - p * 8));
+        if (y1 < p * 8 + 7) m &= (uint8_t)(0xFF >> (p * 8 + 7 - y1));
+        mask[p] = m;
+    }
+    OLED_MarkDirty((uint8_t)p0, (uint8_t)p1, (uint8_t)x0, (uint8_t)x1);
+
+    q = (uint8_t)(shift >> 3);
+    r = (uint8_t)(shift & 7);
+    /*上移时新字节来自下方的页，从上往下处理；下移时反过来，保证读到的源页还没被改写*/
+    step = (Dy < 0) ? 1 : -1;
+    for (p = (Dy < 0) ? p0 : p1; p >= p0 && p <= p1; p += step)
+    {
+        dst = OLED_DisplayBuf[p];
+        m   = mask[p];
+
+        /*源页a提供移位后的主要部分，源页b补上跨页移进来的r行；区域外的源行按0处理*/
+        pa = (int16_t)(p + step * q);
+        pb = (int16_t)(pa + step);
+        ma = (pa >= p0 && pa <= p1) ? mask[pa] : 0x00;
+        mb = (r != 0 && pb >= p0 && pb <= p1) ? mask[pb] : 0x00;
+        sa = ma ? OLED_DisplayBuf[pa] : dst;
+        sb = mb ? OLED_DisplayBuf[pb] : dst;
+
+        if (Dy < 0) OLED_ScrollRow(dst, sa, sb, m, ma, mb, r, (uint8_t)(8 - r), (uint8_t)x0, (uint8_t)x1);
+        else        OLED_ScrollRow(dst, sb, sa, m, mb, ma, (uint8_t)(8 - r), r, (uint8_t)x0, (uint8_t)x1);
+    }
+}
+#endif
 
 //设置绘图模式
 /**
@@ -521,6 +2772,63 @@ void OLED_SetDrawMode(OLED_DrawMode mode) {
     oled_draw_mode = mode;
 }
 
+/**
+  * @brief 压入一个裁剪矩形，之后的绘图只作用于它与当前裁剪区的交集
+  * @param X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定区域左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Width 指定区域的宽度，范围：0~255
+  * @param Height 指定区域的高度，范围：0~255
+  * @return 1：成功，0：栈已满(深度 OLED_CLIP_DEPTH)，裁剪区不变，此时不要调用 OLED_PopClip
+  * @note 交集为空时后续绘图全部被拒绝；必须与 OLED_PopClip 成对使用
+  * @note OLED_Clear/OLED_Reverse 不受裁剪区影响
+  */
+uint8_t OLED_PushClip(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
+{
+    int32_t x0 = X, y0 = Y, x1 = (int32_t)X + Width - 1, y1 = (int32_t)Y + Height - 1;
+
+    if (oled_clip_depth >= OLED_CLIP_DEPTH) return 0;
+    oled_clip_stack[oled_clip_depth++] = oled_clip;
+
+    if (x0 < oled_clip.X0) x0 = oled_clip.X0;
+    if (y0 < oled_clip.Y0) y0 = oled_clip.Y0;
+    if (x1 > oled_clip.X1) x1 = oled_clip.X1;
+    if (y1 > oled_clip.Y1) y1 = oled_clip.Y1;
+    if (x0 > x1 || y0 > y1)
+    {
+        /*空区域统一记为 X0>X1、Y0>Y1，坐标仍在int16范围内*/
+        x0 = 0; y0 = 0; x1 = -1; y1 = -1;
+    }
+    oled_clip.X0 = (int16_t)x0;
+    oled_clip.Y0 = (int16_t)y0;
+    oled_clip.X1 = (int16_t)x1;
+    oled_clip.Y1 = (int16_t)y1;
+    return 1;
+}
+
+/**
+  * @brief 弹出最近一次压入的裁剪矩形，恢复外层裁剪区
+  * @return 无
+  * @note 栈空时不做任何事
+  */
+void OLED_PopClip(void)
+{
+    if (oled_clip_depth == 0) return;
+    oled_clip = oled_clip_stack[--oled_clip_depth];
+}
+
+/**
+  * @brief 清空裁剪区栈，恢复为整屏
+  * @return 无
+  */
+void OLED_ResetClip(void)
+{
+    oled_clip_depth = 0;
+    oled_clip.X0 = 0;
+    oled_clip.Y0 = 0;
+    oled_clip.X1 = OLED_WIDTH - 1;
+    oled_clip.Y1 = OLED_HEIGHT - 1;
+}
+
 /**
   * @brief OLED在指定位置画一个点
   * @param X 指定点的横坐标，范围：-32768~32767，屏幕区域：0~95
@@ -532,30 +2840,8 @@ void OLED_SetDrawMode(OLED_DrawMode mode) {
   * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
 void OLED_DrawPoint(int16_t x, int16_t y, uint8_t operation) {
-    if (x < 0 || x >= OLED_WIDTH || y < 0 || y >= OLED_HEIGHT)
-        return;
-    
-    uint8_t page = y / 8;
-    uint8_t bit  = y % 8;
-    uint8_t mask = 1 << bit;
-
-    switch (oled_draw_mode) {
-        case OLED_DRAWMODE_NORMAL:
-            if (operation) {
-                OLED_DisplayBuf[page][x] |= mask;   // 画白点
-            } else {
-                OLED_DisplayBuf[page][x] &= ~mask;  // 清黑点
-            }
-            break;
-
-        case OLED_DRAWMODE_XOR:
-            if (operation) {
-                OLED_DisplayBuf[page][x] ^= mask;   // 翻转像素
-            } else {
-                OLED_DisplayBuf[page][x] &= ~mask;  // 强制清零
-            }
-            break;
-    }
+    /*NORMAL: 1=置位 0=清零；XOR: 1=翻转 0=清零(见 OLED_ResolveRop)*/
+    OLED_PutPixel(x, y, OLED_ResolveRop(operation));
 }
 
 /**
@@ -570,66 +2856,24 @@ void OLED_DrawPoint(int16_t x, int16_t y, uint8_t operation) {
   * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   * @note 此函数只作用了字符取模时被点亮的像素，而不是整个6x8或8x16区域的所有像素。具体来说：
   *       函数从字体数组（如OLED_F6x8或OLED_F8x16）中读取字符的位图数据。
-  *       位图数据中的每一位（bit）对应一个像素：如果位为1，则调用OLED_DrawPoint绘制像素（使用opration=1）；如果位为0，则不做任何操作，因此背景像素保持不变。
+  *       位图数据中的每一位（bit）对应一个像素：如果位为1，则效果等同于OLED_DrawPoint(..., 1)；如果位为0，则不做任何操作，因此背景像素保持不变。
+  *       实现上按列字节移位后整字节合并进所跨的页（见OLED_BlitGlyph），不再逐点调用OLED_DrawPoint。
   *       这意味着只有字符形状所需的像素会被绘制，区域中的其他像素不会被修改，从而保持屏幕原有的背景色。
   *       意味着在NORMAL模式下，字符形状所需的像素会被点亮，而在XOR模式下，字符形状所需的像素会被异或操作。
   */
 void OLED_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize)
 {
-    uint8_t i, j;
-    
-    switch (FontSize)
-    {
-    case OLED_8X16:
-        for (i = 0; i < 8; i++) // 遍历8列
-        {
-            // 获取字符上半部分和下半部分的字模数据
-            uint8_t temp_top = OLED_F8x16[Char - ' '][i];
-            uint8_t temp_bottom = OLED_F8x16[Char - ' '][i + 8];
-            
-            // 绘制上半部分（8个像素）
-            for (j = 0; j < 8; j++)
-            {
-                if (temp_top & 0x01) // 检查最低位是否为1
-                {
-                    OLED_DrawPoint(X + i, Y + j, 1); // 绘制像素
-                }
-                temp_top >>= 1; // 右移一位，检查下一个像素
-            }
-            
-            // 绘制下半部分（8个像素）
-            for (j = 0; j < 8; j++)
-            {
-                if (temp_bottom & 0x01) // 检查最低位是否为1
-                {
-                    OLED_DrawPoint(X + i, Y + j + 8, 1); // 绘制像素
-                }
-                temp_bottom >>= 1; // 右移一位，检查下一个像素
-            }
-        }
-        break;
-        
-    case OLED_6X8:
-        for (i = 0; i < 6; i++) // 遍历6列
-        {
-            // 获取字符的字模数据
-            uint8_t temp = OLED_F6x8[Char - ' '][i];
-            
-            // 绘制8个像素
-            for (j = 0; j < 8; j++)
-            {
-                if (temp & 0x01) // 检查最低位是否为1
-                {
-                    OLED_DrawPoint(X + i, Y + j, 1); // 绘制像素
-                }
-                temp >>= 1; // 右移一位，检查下一个像素
-            }
-        }
-        break;
-        
-    default:
-        break;
-    }
+    const uint8_t *glyph = OLED_GetGlyph(Char, FontSize);
+    uint8_t height = (FontSize == OLED_8X16) ? 16 : 8;
+    int16_t page;
+    uint8_t shift;
+
+    if (glyph == NULL) return;
+    if (X <= oled_clip.X0 - (int16_t)FontSize || X > oled_clip.X1) return;
+    if (!OLED_GlyphPlace(Y, height, &page, &shift)) return;
+
+    /*字模中为1的位等价于 OLED_DrawPoint(..., 1)：NORMAL下点亮，XOR下翻转*/
+    OLED_BlitGlyph(X, page, shift, glyph, FontSize, height, OLED_ResolveRop(1));
 }
 /**
   * @brief OLED显示字符串（纯 ASCII）
@@ -646,14 +2890,124 @@ void OLED_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize)
 void OLED_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize)
 {
     uint16_t i = 0;
-    uint16_t XOffset = 0;
-    while (String[i] != '\0')
+    int32_t  x = X;
+    uint8_t height = (FontSize == OLED_8X16) ? 16 : 8;
+    int16_t page;
+    uint8_t shift;
+    OLED_RasterOp rop;
+
+    /*整串只做一次纵向裁剪与页/偏移计算*/
+    if (FontSize != OLED_8X16 && FontSize != OLED_6X8) return;
+    if (!OLED_GlyphPlace(Y, height, &page, &shift)) return;
+    rop = OLED_ResolveRop(1);
+
+    /*横向：跳过完全位于裁剪区左侧的字符，遇到裁剪区右侧即结束*/
+    while (String[i] != '\0' && x <= oled_clip.X1)
     {
-        OLED_ShowChar(X + XOffset, Y, String[i], FontSize);
-        XOffset += FontSize;
+        if (x > oled_clip.X0 - (int32_t)FontSize)
+        {
+            OLED_BlitGlyph((int16_t)x, page, shift, OLED_GetGlyph(String[i], FontSize), FontSize, height, rop);
+        }
+        x += FontSize;
         i++;
     }
 }
+/**
+  * @brief OLED按字体描述显示字符串(支持比例字体)
+  * @param X 指定字符串左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定字符串左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param String 指定要显示的字符串，UTF-8编码：ASCII可见字符，及字体Wide字形表中有的字(如中文)
+  * @param Font 指定字体
+  *           范围：&OLED_Font6x8		等宽，宽6像素，高8像素(与 OLED_ShowString 的 OLED_6X8 相同)
+  *                 &OLED_Font8x16	等宽，宽8像素，高16像素
+  *                 &OLED_FontP8		比例字体，高8像素
+  *                 &OLED_FontP16	比例字体，高16像素
+  * @return 无
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数;
+  *       在NORMAL模式下，字符形状所需的像素会被点亮，而在XOR模式下，字符形状所需的像素会被异或操作。
+  * @note 字符串占用的宽度用 OLED_MeasureText 计算
+  * @note 多字节字符按码点在 Font->Wide 中二分查找，与ASCII字形垂直居中对齐(见OLED_WideOffset)，
+  *       字形表中没有的字显示为'?'
+  */
+void OLED_ShowText(int16_t X, int16_t Y, const char *String, const OLED_Font *Font)
+{
+    int32_t x = X;
+    int16_t page, widePage = 0;
+    uint8_t shift, wideShift = 0, width, advance;
+    uint8_t inRows, wideInRows = 0;
+    const uint8_t *glyph;
+    OLED_RasterOp rop;
+
+    /*整串只做一次纵向裁剪与页/偏移计算，中文字形另算一组*/
+    inRows = OLED_GlyphPlace(Y, Font->Height, &page, &shift);
+    if (Font->Wide != NULL)
+    {
+        wideInRows = OLED_GlyphPlace((int16_t)(Y + OLED_WideOffset(Font)), Font->Wide->Height, &widePage, &wideShift);
+    }
+    if (!inRows && !wideInRows) return;
+    rop = OLED_ResolveRop(1);
+
+    /*横向：跳过完全位于裁剪区左侧的字符，遇到裁剪区右侧即结束*/
+    while (*String != '\0' && x <= oled_clip.X1)
+    {
+        if ((uint8_t)*String < 0x80)
+        {
+            glyph = OLED_FontGlyph(Font, *String++, &width, &advance);
+        }
+        else
+        {
+            glyph = OLED_WideGlyph(Font->Wide, OLED_Utf8Next(&String));
+            if (glyph != NULL)
+            {
+                width = advance = Font->Wide->Width;
+                if (wideInRows && x + width > oled_clip.X0)
+                {
+                    OLED_BlitGlyph((int16_t)x, widePage, wideShift, glyph, width, Font->Wide->Height, rop);
+                }
+                x += advance;
+                continue;
+            }
+            glyph = OLED_FontGlyph(Font, '?', &width, &advance);
+        }
+        if (inRows && x + width > oled_clip.X0)
+        {
+            OLED_BlitGlyph((int16_t)x, page, shift, glyph, width, Font->Height, rop);
+        }
+        x += advance;
+    }
+}
+
+/**
+  * @brief 计算字符串按字体显示时的宽度
+  * @param String 字符串
+  * @param Font 字体，同 OLED_ShowText
+  * @return 各字符步进宽度之和(像素)，即紧接其后的下一个字符的横坐标偏移
+  * @note 比例字体与中文要逐字符查表，界面上不变的文字(如菜单标题)应在初始化时算好保存
+  */
+uint16_t OLED_MeasureText(const char *String, const OLED_Font *Font)
+{
+    uint16_t width = 0;
+    uint8_t glyphWidth, advance;
+
+    while (*String != '\0')
+    {
+        if ((uint8_t)*String < 0x80)
+        {
+            OLED_FontGlyph(Font, *String++, &glyphWidth, &advance);
+        }
+        else if (OLED_WideGlyph(Font->Wide, OLED_Utf8Next(&String)) != NULL)
+        {
+            advance = Font->Wide->Width;
+        }
+        else
+        {
+            OLED_FontGlyph(Font, '?', &glyphWidth, &advance);
+        }
+        width = (uint16_t)(width + advance);
+    }
+    return width;
+}
+
 /**
   * @brief OLED显示数字（十进制，正整数）
   * @param X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
@@ -816,6 +3170,38 @@ void OLED_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, u
 	OLED_ShowNum(X + (IntLength + 2) * FontSize, Y, FraNum, FraLength, FontSize);
 }
 
+/**
+  * @brief OLED显示定点数(整数运算，不经过浮点)
+  * @param X 指定数字左上角的横坐标(右对齐时为数字右端的横坐标)，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Value 定点数的整数表示，显示的值为 Value/10^Scale，如 Value=1234、Scale=2 表示12.34
+  * @param Scale Value中的小数位数，范围：0~9
+  * @param FraLength 指定显示的小数位数，范围：0~9，少于Scale时四舍五入，多于Scale时补0
+  * @param Width 数字部分(不含符号)的最大字符数，范围：0~20，0表示不限
+  * @param Flags 显示方式，可按位或
+  *           范围：OLED_NUM_RIGHT	右对齐，X为右端，数字位数变化时右边缘不动
+  *                 OLED_NUM_ZERO	整数部分前补0到Width个字符(定宽显示)
+  *                 OLED_NUM_FIT		放不下时减少小数位
+  *                 OLED_NUM_PLUS	正数显示+号
+  * @param FontSize 指定字体大小
+  *           范围：OLED_8X16		宽8像素，高16像素
+  *                 OLED_6X8		宽6像素，高8像素
+  * @return 显示的字符数(含符号)，0：Width个字符内放不下，什么也没显示(调用者可以改显示"..."等)
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数;
+  *       在NORMAL模式下，字符形状所需的像素会被点亮，而在XOR模式下，字符形状所需的像素会被异或操作。
+  * @note 与 OLED_ShowFloatNum 不同：没有double、round与 OLED_Pow，位数按实际长度显示，不固定显示符号
+  */
+uint8_t OLED_ShowFixedNum(int16_t X, int16_t Y, int32_t Value, uint8_t Scale, uint8_t FraLength, uint8_t Width, uint8_t Flags, uint8_t FontSize)
+{
+    char String[OLED_NUM_WIDTH_MAX + 2];
+    uint8_t len = OLED_FixedToString(String, Value, Scale, FraLength, Width, Flags);
+
+    if (len == 0) return 0;
+    if (Flags & OLED_NUM_RIGHT) X = (int16_t)(X - len * FontSize);
+    OLED_ShowString(X, Y, String, FontSize);
+    return len;
+}
+
 /**
   * @brief OLED使用printf函数打印格式化字符串
   * @param X 指定格式化字符串左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
@@ -824,34 +3210,126 @@ void OLED_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, u
   *           范围：OLED_8X16		宽8像素，高16像素
   *                 OLED_6X8		宽6像素，高8像素
   * @param format 指定要显示的格式化字符串，范围：ASCII码可见字符组成的字符串
+  *        支持 %d %i %u %x %X %c %s %f %% 以及定点数扩展 %k，标志 - 0 + 空格，宽度与精度(可以是*)，长度 hh h l ll
   * @param ... 格式化字符串参数列表
   * @return 无
   * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数;
   *       在NORMAL模式下，字符形状所需的像素会被点亮，而在XOR模式下，字符形状所需的像素会被异或操作。
+  * @note 不调用vsprintf，也没有256字节的字符串缓冲：格式化出的字符直接逐个绘制(见 OLED_Format)，
+  *       越过裁剪区右边后不再格式化；%f 的舍入与取值范围见 OLED_Format
   */
 void OLED_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...)
 {
-	char String[256];						//定义字符数组
-	va_list arg;							//定义可变参数列表数据类型的变量arg
-	va_start(arg, format);					//从format开始，接收参数列表到arg变量
-	vsprintf(String, format, arg);			//使用vsprintf打印格式化字符串和参数列表到字符数组中
-	va_end(arg);							//结束变量arg
-	OLED_ShowString(X, Y, String, FontSize);//OLED显示字符数组（字符串）
+    OLED_FormatSink sink;
+    va_list arg;
+
+    if (FontSize != OLED_8X16 && FontSize != OLED_6X8) return;
+    sink.Height = (FontSize == OLED_8X16) ? 16 : 8;
+    if (!OLED_GlyphPlace(Y, sink.Height, &sink.Page, &sink.Shift)) return;
+    sink.Put = OLED_FormatPutGlyph;
+    sink.X = X;
+    sink.FontSize = FontSize;
+    sink.Rop = OLED_ResolveRop(1);
+
+    va_start(arg, format);
+    OLED_Format(&sink, format, arg);
+    va_end(arg);
+}
+
+/**
+  * @brief OLED获取指定位置点的值
+  * @param X 指定点的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定点的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @return 指定位置点是否处于点亮状态，1：点亮，0：熄灭
+  */
+uint8_t OLED_GetPoint(int16_t X, int16_t Y)
+{
+    int16_t page = (int16_t)(Y >> 3);
+
+    /*显示列表模式下只能读到当前条带内的点，条带外读为0*/
+    if (X >= 0 && X < OLED_WIDTH && Y >= 0 && Y < OLED_HEIGHT &&
+        page >= OLED_TARGET_PAGE0 && page < OLED_TARGET_PAGE0 + OLED_TARGET_PAGES)
+    {
+        if (OLED_TARGET_ROW(page)[X] & (0x01 << (Y & 0x07))) return 1;
+    }
+    return 0;
+}
+
+/*----------辅助函数[输出斜线的一段游程：主方向 [a, b]，次方向坐标 minor，先按 [first, last] 裁掉不包含的端点]----------------*/
+static OLED_FORCE_INLINE void OLED_LineRun(int16_t a, int16_t b, int16_t minor,
+                                           int16_t first, int16_t last,
+                                           int16_t sign, uint8_t xyflag, OLED_RasterOp rop)
+{
+    int16_t px, py;
+    uint8_t *p, mask;
+
+    if (a < first) a = first;
+    if (b > last)  b = last;
+    if (a > b) return;
+
+    if (a == b)
+    {
+        /*单像素游程(接近45°的斜线几乎全是)：直接读改写一个字节，脏区已在画线入口按包围盒记录*/
+        px = xyflag ? minor : a;
+        py = (int16_t)(sign * (xyflag ? a : minor));
+        if (px < oled_clip.X0 || px > oled_clip.X1 || py < oled_clip.Y0 || py > oled_clip.Y1) return;
+        p = &OLED_TARGET_ROW(py >> 3)[px];
+        mask = (uint8_t)(1 << (py & 0x07));
+        switch (rop)
+        {
+            case OLED_ROP_SET:   *p |= mask;             break;
+            case OLED_ROP_CLEAR: *p &= (uint8_t)~mask;   break;
+            case OLED_ROP_XOR:   *p ^= mask;             break;
+        }
+        return;
+    }
+
+    if (!xyflag)
+    {
+        /*水平游程(斜率小于1的斜线，多为2~3个像素)：同一页、同一个位掩码，逐列读改写，不调用 OLED_FillBox*/
+        py = (int16_t)(sign * minor);
+        if (py < oled_clip.Y0 || py > oled_clip.Y1) return;
+        if (a < oled_clip.X0) a = oled_clip.X0;
+        if (b > oled_clip.X1) b = oled_clip.X1;
+        if (a > b) return;
+        p = &OLED_TARGET_ROW(py >> 3)[a];
+        mask = (uint8_t)(1 << (py & 0x07));
+        px = (int16_t)(b - a + 1);
+        switch (rop)
+        {
+            case OLED_ROP_SET:   while (px--) *p++ |= mask;             break;
+            case OLED_ROP_CLEAR: while (px--) *p++ &= (uint8_t)~mask;   break;
+            case OLED_ROP_XOR:   while (px--) *p++ ^= mask;             break;
+        }
+    }
+    else if (sign > 0) OLED_FillBox(minor, a, minor, b, rop);                 // 垂直游程(向下)
+    else               OLED_FillBox(minor, -b, minor, -a, rop);               // 垂直游程(向上)
 }
 
-/**
-  * @brief OLED获取指定位置点的值
-  * @param X 指定点的横坐标，范围：-32768~32767，屏幕区域：0~95
-  * @param Y 指定点的纵坐标，范围：-32768~32767，屏幕区域：0~95
-  * @return 指定位置点是否处于点亮状态，1：点亮，0：熄灭
-  */
-uint8_t OLED_GetPoint(int16_t X, int16_t Y)
+/*----------辅助函数[Bresenham主循环：主方向从 x 走到 stop，次方向每步进一次输出一段游程]----------------*/
+static OLED_FORCE_INLINE void OLED_LineWalk(int16_t x, int16_t y, int16_t d, int16_t incrE, int16_t incrNE,
+                                            int16_t stop, int16_t first, int16_t last,
+                                            int16_t sign, uint8_t xyflag, OLED_RasterOp rop)
 {
-    if (X >= 0 && X < OLED_WIDTH && Y >= 0 && Y < OLED_HEIGHT)
+    int16_t runStart = x;
+
+    while (x < stop)
     {
-        if (OLED_DisplayBuf[Y / 8][X] & (0x01 << (Y % 8))) return 1;
+        x++;
+        if (d < 0)
+        {
+            d += incrE;
+        }
+        else
+        {
+            /*次方向步进，上一段游程结束*/
+            OLED_LineRun(runStart, x - 1, y, first, last, sign, xyflag, rop);
+            y++;
+            runStart = x;
+            d += incrNE;
+        }
     }
-    return 0;
+    OLED_LineRun(runStart, x, y, first, last, sign, xyflag, rop);
 }
 
 /**
@@ -866,7 +3344,13 @@ uint8_t OLED_GetPoint(int16_t X, int16_t Y)
   */
 void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint8_t IncludeEndpoints, uint8_t operation)
 {
-    // 特殊处理：水平线
+    OLED_RasterOp rop = OLED_ResolveRop(operation);
+
+    /*包围盒与裁剪区无交集时直接返回*/
+    if (OLED_ClipRejectBox((X0 < X1) ? X0 : X1, (Y0 < Y1) ? Y0 : Y1,
+                           (X0 < X1) ? X1 : X0, (Y0 < Y1) ? Y1 : Y0)) return;
+
+    // 特殊处理：水平线（单页行，固定位掩码逐列写入）
     if (Y0 == Y1)
     {
         int16_t start = X0, end = X1;
@@ -874,14 +3358,11 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint8_t Inclu
         
         if (!IncludeEndpoints) { start++; end--; }
         
-        for (int16_t x = start; x <= end; x++)
-        {
-            OLED_DrawPoint(x, Y0, operation);
-        }
+        OLED_FillBox(start, Y0, end, Y0, rop);
         return;
     }
     
-    // 特殊处理：垂直线
+    // 特殊处理：垂直线（每页一个字节，一次写8个像素）
     if (X0 == X1)
     {
         int16_t start = Y0, end = Y1;
@@ -889,17 +3370,25 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint8_t Inclu
         
         if (!IncludeEndpoints) { start++; end--; }
         
-        for (int16_t y = start; y <= end; y++)
-        {
-            OLED_DrawPoint(X0, y, operation);
-        }
+        OLED_FillBox(X0, start, X0, end, rop);
         return;
     }
     
-    // 通用情况：斜线（使用Bresenham算法）
-    int16_t x, y, dx, dy, d, incrE, incrNE, temp;
+    // 通用情况：斜线（使用Bresenham算法，按“游程”整段输出）
+    int16_t dx, dy, d, incrE, incrNE, temp;
     int16_t x0 = X0, y0 = Y0, x1 = X1, y1 = Y1;
-    uint8_t yflag = 0, xyflag = 0;
+    int16_t sign = 1, first, last, stop;
+    int16_t bx0, by0, bx1, by1;
+    uint8_t xyflag = 0;
+    
+    /*单像素游程不逐点记录脏区，按裁剪后的包围盒一次记下*/
+    bx0 = (X0 < X1) ? X0 : X1;  bx1 = (X0 < X1) ? X1 : X0;
+    by0 = (Y0 < Y1) ? Y0 : Y1;  by1 = (Y0 < Y1) ? Y1 : Y0;
+    if (bx0 < oled_clip.X0) bx0 = oled_clip.X0;
+    if (by0 < oled_clip.Y0) by0 = oled_clip.Y0;
+    if (bx1 > oled_clip.X1) bx1 = oled_clip.X1;
+    if (by1 > oled_clip.Y1) by1 = oled_clip.Y1;
+    OLED_MarkDirty((uint8_t)(by0 >> 3), (uint8_t)(by1 >> 3), (uint8_t)bx0, (uint8_t)bx1);
     
     if (x0 > x1)
     {
@@ -911,7 +3400,7 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint8_t Inclu
     {
         y0 = -y0;
         y1 = -y1;
-        yflag = 1;
+        sign = -1;
     }
     
     if (y1 - y0 > x1 - x0)
@@ -926,40 +3415,21 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint8_t Inclu
     incrE = 2 * dy;
     incrNE = 2 * (dy - dx);
     d = 2 * dy - dx;
-    x = x0;
-    y = y0;
     
-    // 绘制起始点（如果包含端点）
-    if (IncludeEndpoints)
-    {
-        if (yflag && xyflag){OLED_DrawPoint(y, -x, operation);}
-        else if (yflag)        {OLED_DrawPoint(x, -y, operation);}
-        else if (xyflag)    {OLED_DrawPoint(y, x, operation);}
-        else                {OLED_DrawPoint(x, y, operation);}
-    }
+    /*不包含端点时，起点与终点都从游程中裁掉*/
+    first = IncludeEndpoints ? x0 : (int16_t)(x0 + 1);
+    last  = IncludeEndpoints ? x1 : (int16_t)(x1 - 1);
     
-    while (x < x1)
-    {
-        x++;
-        if (d < 0)
-        {
-            d += incrE;
-        }
-        else
-        {
-            y++;
-            d += incrNE;
-        }
-        
-        // 跳过最后一个点（如果不包含端点）
-        if (!IncludeEndpoints && x == x1) break;
-        
-        // 绘制点
-        if (yflag && xyflag){OLED_DrawPoint(y, -x, operation);}
-        else if (yflag)        {OLED_DrawPoint(x, -y, operation);}
-        else if (xyflag)    {OLED_DrawPoint(y, x, operation);}
-        else                {OLED_DrawPoint(x, y, operation);}
-    }
+    /*象限映射在循环外确定一次：
+      未交换XY时，屏幕坐标为(x, sign*y)，游程是水平线；
+      交换XY后，屏幕坐标为(y, sign*x)，游程是垂直线*/
+    /*主方向离开裁剪区后不再步进：x 之后对应的屏幕坐标全部在裁剪区外*/
+    if (!xyflag)       stop = oled_clip.X1;
+    else if (sign > 0) stop = oled_clip.Y1;
+    else               stop = (int16_t)-oled_clip.Y0;
+    if (stop > x1) stop = x1;
+
+    OLED_ROP_DISPATCH(rop, OLED_LineWalk, x0, y0, d, incrE, incrNE, stop, first, last, sign, xyflag);
 }
 
 /**
@@ -976,7 +3446,6 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint8_t Inclu
   */
 void OLED_DrawRectangle(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t IsFilled, uint8_t operation)
 {
-    int16_t i, j;
     if (!IsFilled)
     {
         // 绘制上边（包含端点）
@@ -990,13 +3459,142 @@ void OLED_DrawRectangle(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uin
     }
     else
     {
-        for (i = X; i < X + Width; i++)
-        {
-            for (j = Y; j < Y + Height; j++)
-            {
-                OLED_DrawPoint(i, j, operation);
-            }
+        /*整块交给填充内核，按页掩码整字节写入*/
+        OLED_FillBox(X, Y, X + Width - 1, Y + Height - 1, OLED_ResolveRop(operation));
+    }
+}
+
+/*----------辅助函数[活动边初始化到第y行]----------------*/
+static void OLED_PolyEdgeStart(OLED_PolyEdge *e, int16_t y)
+{
+    uint32_t u = (uint32_t)((y > e->BaseY) ? (y - e->BaseY) : (e->BaseY - y));
+    uint32_t n = (uint32_t)e->A * u;
+    e->Q = (int32_t)(n / e->B);
+    e->R = (int32_t)(n % e->B);
+}
+
+/*----------辅助函数[活动边推进一行]----------------*/
+static inline void OLED_PolyEdgeStep(OLED_PolyEdge *e)
+{
+    if (e->Step > 0) {
+        e->Q += e->Aq; e->R += e->Ar;
+        if (e->R >= e->B) { e->Q++; e->R -= e->B; }
+    } else {
+        e->Q -= e->Aq; e->R -= e->Ar;
+        if (e->R < 0) { e->Q--; e->R += e->B; }
+    }
+}
+
+/*----------辅助函数[多边形扫描线填充：活动边表，每行排序交点后成对输出整段]----------------*/
+/*
+ 填充规则与 OLED_pnpoly 逐点判断完全一致(奇偶规则)：
+ 第y行中，对每条满足 (vy[i] > y) != (vy[j] > y) 的边求交点 x，排序后得到 c0 <= c1 <= ...，
+ 点 (t, y) 在内部 <=> 交点中大于t的个数为奇数 <=> t 落在某个 [c(2m), c(2m+1) - 1] 中。
+ 每行各段互不重叠，XOR 模式下每个像素只翻转一次。
+*/
+static void OLED_FillPolygonSpans(const int16_t *vx, const int16_t *vy, uint8_t n, OLED_RasterOp rop)
+{
+    OLED_PolyEdge edges[OLED_POLYGON_MAX_VERTICES];
+    uint8_t order[OLED_POLYGON_MAX_VERTICES];     // 按YTop排序的边序号
+    uint8_t active[OLED_POLYGON_MAX_VERTICES];    // 活动边
+    int16_t xs[OLED_POLYGON_MAX_VERTICES];
+    uint8_t ne = 0, na, nx, next, i, j, k;
+    int16_t y, yStart = 0, yEnd = -1, xMin, xMax;
+
+    if (n == 0 || n > OLED_POLYGON_MAX_VERTICES) return;
+
+    /*顶点的横向范围与裁剪区无交集时直接返回(纵向在下面按行裁剪)*/
+    xMin = xMax = vx[0];
+    for (i = 1; i < n; i++) {
+        if (vx[i] < xMin) xMin = vx[i];
+        if (vx[i] > xMax) xMax = vx[i];
+    }
+    if (xMax < oled_clip.X0 || xMin > oled_clip.X1) return;
+
+    /*建边表：与pnpoly相同的 (i, j = i - 1) 配对，水平边不参与*/
+    for (i = 0, j = (uint8_t)(n - 1); i < n; j = i++) {
+        OLED_PolyEdge *e;
+        int32_t dx = (int32_t)vx[j] - vx[i];
+        int32_t dy = (int32_t)vy[j] - vy[i];
+        if (dy == 0) continue;
+        e = &edges[ne];
+        e->BaseX = vx[i];
+        e->BaseY = vy[i];
+        e->Sign  = (int8_t)((dx < 0) ? -1 : 1);
+        e->Step  = (int8_t)((dy > 0) ? 1 : -1);
+        e->YTop  = (dy > 0) ? vy[i] : vy[j];
+        e->YBot  = (dy > 0) ? vy[j] : vy[i];
+        e->A  = (uint16_t)((dx < 0) ? -dx : dx);
+        e->B  = (uint16_t)((dy < 0) ? -dy : dy);
+        e->Aq = (uint16_t)(e->A / e->B);
+        e->Ar = (uint16_t)(e->A % e->B);
+        if (ne == 0 || e->YTop < yStart) yStart = e->YTop;
+        if (ne == 0 || e->YBot - 1 > yEnd) yEnd = (int16_t)(e->YBot - 1);
+        /*按YTop插入排序*/
+        for (k = ne; k > 0 && edges[order[k - 1]].YTop > e->YTop; k--) order[k] = order[k - 1];
+        order[k] = ne;
+        ne++;
+    }
+    if (ne == 0) return;
+
+    /*只扫描裁剪区内的行*/
+    if (yStart < oled_clip.Y0) yStart = oled_clip.Y0;
+    if (yEnd > oled_clip.Y1) yEnd = oled_clip.Y1;
+
+    na = 0; next = 0;
+    for (y = yStart; y <= yEnd; y++) {
+        /*进入活动边表：屏幕上方开始的边直接初始化到当前行*/
+        while (next < ne && edges[order[next]].YTop <= y) {
+            OLED_PolyEdge *e = &edges[order[next++]];
+            if (e->YBot <= y) continue;
+            OLED_PolyEdgeStart(e, y);
+            active[na++] = (uint8_t)(e - edges);
+        }
+        /*移出已结束的边，收集交点并插入排序*/
+        nx = 0;
+        for (k = 0; k < na; ) {
+            OLED_PolyEdge *e = &edges[active[k]];
+            int16_t x;
+            if (e->YBot <= y) { active[k] = active[--na]; continue; }
+            x = (int16_t)(e->BaseX + e->Sign * e->Q);
+            for (i = nx; i > 0 && xs[i - 1] > x; i--) xs[i] = xs[i - 1];
+            xs[i] = x;
+            nx++;
+            OLED_PolyEdgeStep(e);
+            k++;
         }
+        for (k = 0; k + 1 < nx; k += 2) {
+            if (xs[k] < xs[k + 1]) OLED_FillBox(xs[k], y, (int16_t)(xs[k + 1] - 1), y, rop);
+        }
+    }
+}
+
+/**
+  * @brief OLED画多边形
+  * @param X Y 顶点坐标数组，按顺序相连并首尾闭合，范围：-32768~32767，屏幕区域：0~95
+  * @param Count 顶点数，范围：1~OLED_POLYGON_MAX_VERTICES，超出时不绘制
+  * @param IsFilled 指定多边形是否填充
+  *           范围：OLED_UNFILLED		不填充
+  *                 OLED_FILLED			填充
+  * @return 无
+  * @note 填充按奇偶规则，凸、凹及自相交多边形都可以，结果与逐点调用 OLED_pnpoly 相同；
+  *       按行输出整段，XOR模式下每个像素只翻转一次.
+  * @note 不填充时每条边不含端点，顶点单独各画一次.
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_DrawPolygon(const int16_t *X, const int16_t *Y, uint8_t Count, uint8_t IsFilled, uint8_t operation)
+{
+    uint8_t i, j;
+
+    if (Count == 0 || Count > OLED_POLYGON_MAX_VERTICES) return;
+
+    if (IsFilled) {
+        OLED_FillPolygonSpans(X, Y, Count, OLED_ResolveRop(operation));
+        return;
+    }
+    for (i = 0, j = (uint8_t)(Count - 1); i < Count; j = i++) {
+        if (Count > 1) OLED_DrawLine(X[j], Y[j], X[i], Y[i], 0, operation);
+        OLED_DrawPoint(X[i], Y[i], operation);
     }
 }
 
@@ -1016,8 +3614,6 @@ void OLED_DrawRectangle(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uin
   */
 void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint8_t IsFilled, uint8_t operation)
 {
-    int16_t minx = X0, miny = Y0, maxx = X0, maxy = Y0;
-    int16_t i, j;
     int16_t vx[] = {X0, X1, X2};
     int16_t vy[] = {Y0, Y1, Y2};
     
@@ -1033,31 +3629,8 @@ void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X
     }
     else                    //指定三角形填充
     {
-        /*找到三个点最小的X、Y坐标*/
-        if (X1 < minx) {minx = X1;}
-        if (X2 < minx) {minx = X2;}
-        if (Y1 < miny) {miny = Y1;}
-        if (Y2 < miny) {miny = Y2;}
-        
-        /*找到三个点最大的X、Y坐标*/
-        if (X1 > maxx) {maxx = X1;}
-        if (X2 > maxx) {maxx = X2;}
-        if (Y1 > maxy) {maxy = Y1;}
-        if (Y2 > maxy) {maxy = Y2;}
-        
-        /*最小最大坐标之间的矩形为可能需要填充的区域*/
-        /*遍历此区域中所有的点*/
-        /*遍历X坐标*/        
-        for (i = minx; i <= maxx; i ++)
-        {
-            /*遍历Y坐标*/    
-            for (j = miny; j <= maxy; j ++)
-            {
-                /*调用OLED_pnpoly，判断指定点是否在指定三角形之中*/
-                /*如果在，则画点，如果不在，则不做处理*/
-                if (OLED_pnpoly(3, vx, vy, i, j)) {OLED_DrawPoint(i, j, operation);}
-            }
-        }
+        /*按扫描线逐行整段填充，结果与逐点调用OLED_pnpoly相同*/
+        OLED_FillPolygonSpans(vx, vy, 3, OLED_ResolveRop(operation));
     }
 }
 
@@ -1073,47 +3646,69 @@ void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X
   * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数;在XOR模式下，无论operation传入0或1，都执行1的逻辑.
   */
 // ---------- 辅助函数：在一次迭代内只画“唯一像素”的八对称点（避免同一次调用里重复画同一点） ----------
-static inline void plot8_unique(int16_t cx, int16_t cy, int16_t x, int16_t y, uint8_t operation)
+static OLED_FORCE_INLINE void plot8_unique(int16_t cx, int16_t cy, int16_t x, int16_t y, OLED_RasterOp rop)
 {
     // 第一组 (±x, ±y)
-    OLED_DrawPoint(cx + x, cy + y, operation);
-    if (x != 0)               OLED_DrawPoint(cx - x, cy + y, operation);
-    if (y != 0)               OLED_DrawPoint(cx + x, cy - y, operation);
-    if (x != 0 && y != 0)     OLED_DrawPoint(cx - x, cy - y, operation);
+    OLED_PutPixel(cx + x, cy + y, rop);
+    if (x != 0)               OLED_PutPixel(cx - x, cy + y, rop);
+    if (y != 0)               OLED_PutPixel(cx + x, cy - y, rop);
+    if (x != 0 && y != 0)     OLED_PutPixel(cx - x, cy - y, rop);
 
     // 第二组 (±y, ±x) —— 仅当 x != y 时需要（避免与第一组重复）
     if (x != y) {
-        OLED_DrawPoint(cx + y, cy + x, operation);
-        if (y != 0)           OLED_DrawPoint(cx - y, cy + x, operation);
-        if (x != 0)           OLED_DrawPoint(cx + y, cy - x, operation);
-        if (x != 0 && y != 0) OLED_DrawPoint(cx - y, cy - x, operation);
+        OLED_PutPixel(cx + y, cy + x, rop);
+        if (y != 0)           OLED_PutPixel(cx - y, cy + x, rop);
+        if (x != 0)           OLED_PutPixel(cx + y, cy - x, rop);
+        if (x != 0 && y != 0) OLED_PutPixel(cx - y, cy - x, rop);
+    }
+}
+
+// ---------- 辅助函数：空心圆的 Bresenham 主循环（按 rop 展开，NORMAL/XOR 共用） ----------
+static OLED_FORCE_INLINE void OLED_CircleOutline(int16_t X, int16_t Y, uint8_t Radius, OLED_RasterOp rop)
+{
+    int16_t x = 0, y = Radius;
+    int16_t d = 1 - Radius;
+
+    while (x <= y) {
+        // plot8_unique 保证在 x==0 或 x==y 等情况下不重复写同一点，XOR 下不会双重翻转；NORMAL 下重复写也幂等
+        plot8_unique(X, Y, x, y, rop);
+
+        if (d < 0) d += 2 * x + 3;
+        else { d += 2 * (x - y) + 5; y--; }
+        x++;
     }
 }
 
 // ---------- 主函数：可靠、对称、XOR 安全的圆 （替换原来版本） ----------
 void OLED_DrawCircle(int16_t X, int16_t Y, uint8_t Radius, uint8_t IsFilled, uint8_t operation)
 {
+    OLED_RasterOp rop;
+
     if (Radius == 0) {
         OLED_DrawPoint(X, Y, operation);
         return;
     }
+    if (OLED_ClipRejectBox((int32_t)X - Radius, (int32_t)Y - Radius, (int32_t)X + Radius, (int32_t)Y + Radius)) return;
+
+    // 绘图模式只在这里解析一次：NORMAL 下为置位/清零，XOR 下总是翻转
+    rop = OLED_ResolveCurveRop(operation);
+
+    // ---------- 空心：Bresenham 八对称，按 rop 展开成专门的逐点循环 ----------
+    if (!IsFilled) {
+        OLED_ROP_DISPATCH(rop, OLED_CircleOutline, X, Y, Radius);
+        return;
+    }
 
-    // ---------- NORMAL 模式：保持高效 Bresenham（空心）与水平线填充（实心） ----------
-    if (oled_draw_mode == OLED_DRAWMODE_NORMAL) {
+    // ---------- NORMAL 实心：用水平扫描线（走填充内核，NORMAL 下重复覆盖幂等） ----------
+    if (rop != OLED_ROP_XOR) {
         int16_t x = 0, y = Radius;
         int16_t d = 1 - Radius;
 
         while (x <= y) {
-            if (!IsFilled) {
-                // 空心：直接画八对称（可能会在不同迭代出现重复像素，但 NORMAL 模式下 |= 幂等）
-                plot8_unique(X, Y, x, y, operation);
-            } else {
-                // 实心：用水平线（更快也保证对称）
-                OLED_DrawLine(X - x, Y + y, X + x, Y + y,1, operation);
-                OLED_DrawLine(X - x, Y - y, X + x, Y - y,1, operation);
-                OLED_DrawLine(X - y, Y + x, X + y, Y + x,1, operation);
-                OLED_DrawLine(X - y, Y - x, X + y, Y - x,1, operation);
-            }
+            OLED_FillBox(X - x, Y + y, X + x, Y + y, rop);
+            OLED_FillBox(X - x, Y - y, X + x, Y - y, rop);
+            OLED_FillBox(X - y, Y + x, X + y, Y + x, rop);
+            OLED_FillBox(X - y, Y - x, X + y, Y - x, rop);
 
             if (d < 0) d += 2 * x + 3;
             else { d += 2 * (x - y) + 5; y--; }
@@ -1122,89 +3717,48 @@ void OLED_DrawCircle(int16_t X, int16_t Y, uint8_t Radius, uint8_t IsFilled, uin
         return;
     }
 
-    // ---------- XOR 模式：关键在于“每个像素只操作一次” ----------
-    // 在 XOR 模式下，operation 参数 should be 1 to mean "toggle".  (如果传 operation==0 将保持行为为 "clear")
-    if (oled_draw_mode == OLED_DRAWMODE_XOR) {
-        uint8_t tog = 1; // 翻转操作
-
-        // -------- 空心圆（Bresenham）: 用 plot8_unique 避免在同一次迭代里重复绘点 --------
-        if (!IsFilled) {
-            int16_t x = 0, y = Radius;
-            int16_t d = 1 - Radius;
-
-            while (x <= y) {
-                // plot8_unique 保证在 x==0 或 x==y 等情况下不重复调用 DrawPoint 导致双重 XOR
-                plot8_unique(X, Y, x, y, tog);
+    // ---------- XOR 实心：关键在于“每个像素只操作一次” ----------
+    // 第一步 - 扫描线给内部每个像素都 XOR 一次，用“四舍五入取 dx”保证上/下对称性
+    for (int16_t dy = - (int16_t)Radius; dy <= (int16_t)Radius; ++dy) {
+        int16_t dx = OLED_CircleDx(Radius, (int16_t)(dy < 0 ? -dy : dy)); // round for symmetry
+        OLED_FillBox(X - dx, Y + dy, X + dx, Y + dy, OLED_ROP_XOR);
+    }
 
-                if (d < 0) d += 2 * x + 3;
-                else { d += 2 * (x - y) + 5; y--; }
-                x++;
-            }
-            return;
-        }
+    // 第二步 - 边界修正：用 Bresenham 产生的边界点来补画“扫描线未包含”的边界像素
+    // 对每个边界点 (bx,by) 计算该行的 dx_round，并仅在 |bx| > dx_round 时再做一次 XOR（即那些扫描线漏掉的边界像素）
+    // 同时在单次迭代里避免重复绘制（用类似 plot8_unique 的分组逻辑）
+    int16_t x = 0, y = Radius;
+    int16_t d = 1 - Radius;
 
-        // -------- 实心圆（扫描线填充）: 第一步 - 扫描线给内部每个像素都 XOR 一次 --------
-        // 用“四舍五入取 dx”保证上/下对称性
-        for (int16_t dy = - (int16_t)Radius; dy <= (int16_t)Radius; ++dy) {
-            int32_t t = (int32_t)Radius * Radius - (int32_t)dy * dy;
-            if (t < 0) continue;
-            int16_t dx = (int16_t)(sqrtf((float)t) + 0.5f); // round for symmetry
-            for (int16_t xx = -dx; xx <= dx; ++xx) {
-                OLED_DrawPoint(X + xx, Y + dy, tog);
+    while (x <= y) {
+        // 第一组 (±x, ±y)：上下两行到圆心的距离相同，半宽也相同
+        {
+            int16_t bx = x;
+            int16_t dx_line = OLED_CircleDx(Radius, y);
+            if (bx > dx_line) {
+                OLED_PutPixel(X + bx, Y + y, OLED_ROP_XOR);
+                if (bx != 0) OLED_PutPixel(X - bx, Y + y, OLED_ROP_XOR);
+                OLED_PutPixel(X + bx, Y - y, OLED_ROP_XOR);
+                if (bx != 0) OLED_PutPixel(X - bx, Y - y, OLED_ROP_XOR);
             }
         }
 
-        // -------- 第二步 - 边界修正：用 Bresenham 产生的边界点来补画“扫描线未包含”的边界像素 --------
-        // 对每个边界点 (bx,by) 计算该行的 dx_round，并仅在 |bx| > dx_round 时再做一次 XOR（即那些扫描线漏掉的边界像素）
-        // 同时在单次迭代里避免重复绘制（用类似 plot8_unique 的分组逻辑）
-        int16_t x = 0, y = Radius;
-        int16_t d = 1 - Radius;
-
-        while (x <= y) {
-            // 第一组 (±x, ±y)
-            {
-                int16_t bx = x, by = y;
-                int32_t tt = (int32_t)Radius * Radius - (int32_t)by * by;
-                if (tt >= 0) {
-                    int16_t dx_line = (int16_t)(sqrtf((float)tt) + 0.5f);
-                    if (abs(bx) > dx_line) OLED_DrawPoint(X + bx, Y + by, tog);
-                    if (abs(-bx) > dx_line && bx != 0) OLED_DrawPoint(X - bx, Y + by, tog);
-
-                    by = -y;
-                    tt = (int32_t)Radius * Radius - (int32_t)by * by;
-                    dx_line = (int16_t)(sqrtf((float)tt) + 0.5f);
-                    if (abs(bx) > dx_line) OLED_DrawPoint(X + bx, Y + by, tog);
-                    if (abs(-bx) > dx_line && bx != 0) OLED_DrawPoint(X - bx, Y + by, tog);
-                }
-            }
-
-            // 第二组 (±y, ±x) —— 仅当 x != y
-            if (x != y) {
-                int16_t bx = y, by = x;
-                int32_t tt = (int32_t)Radius * Radius - (int32_t)by * by;
-                if (tt >= 0) {
-                    int16_t dx_line = (int16_t)(sqrtf((float)tt) + 0.5f);
-                    if (abs(bx) > dx_line) OLED_DrawPoint(X + bx, Y + by, tog);
-                    if (abs(-bx) > dx_line && bx != 0) OLED_DrawPoint(X - bx, Y + by, tog);
-
-                    by = -x;
-                    tt = (int32_t)Radius * Radius - (int32_t)by * by;
-                    dx_line = (int16_t)(sqrtf((float)tt) + 0.5f);
-                    if (abs(bx) > dx_line) OLED_DrawPoint(X + bx, Y + by, tog);
-                    if (abs(-bx) > dx_line && bx != 0) OLED_DrawPoint(X - bx, Y + by, tog);
-                }
+        // 第二组 (±y, ±x) —— 仅当 x != y
+        if (x != y) {
+            int16_t bx = y;
+            int16_t dx_line = OLED_CircleDx(Radius, x);
+            if (bx > dx_line) {
+                OLED_PutPixel(X + bx, Y + x, OLED_ROP_XOR);
+                if (bx != 0) OLED_PutPixel(X - bx, Y + x, OLED_ROP_XOR);
+                OLED_PutPixel(X + bx, Y - x, OLED_ROP_XOR);
+                if (bx != 0) OLED_PutPixel(X - bx, Y - x, OLED_ROP_XOR);
             }
-
-            if (d < 0) d += 2 * x + 3;
-            else { d += 2 * (x - y) + 5; y--; }
-            x++;
         }
 
-        return;
+        if (d < 0) d += 2 * x + 3;
+        else { d += 2 * (x - y) + 5; y--; }
+        x++;
     }
-
-    // 如果有其它模式（防御）
-    return;
 }
 
 /**
@@ -1220,22 +3774,37 @@ void OLED_DrawCircle(int16_t X, int16_t Y, uint8_t Radius, uint8_t IsFilled, uin
   * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数;在XOR模式下，无论operation传入0或1，都执行1的逻辑.
   */
 // ---------- 辅助函数：在一次迭代内只画“唯一像素”的四对称点（避免同一次调用里重复画同一点） ----------
-static inline void plot4_unique(int16_t cx, int16_t cy, int16_t x, int16_t y, uint8_t col)
+static OLED_FORCE_INLINE void plot4_unique(int16_t cx, int16_t cy, int16_t x, int16_t y, OLED_RasterOp rop)
 {
     // (±x, ±y)
-    OLED_DrawPoint(cx + x, cy + y, col);
-    if (x != 0)              OLED_DrawPoint(cx - x, cy + y, col);
-    if (y != 0)              OLED_DrawPoint(cx + x, cy - y, col);
-    if (x != 0 && y != 0)    OLED_DrawPoint(cx - x, cy - y, col);
+    OLED_PutPixel(cx + x, cy + y, rop);
+    if (x != 0)              OLED_PutPixel(cx - x, cy + y, rop);
+    if (y != 0)              OLED_PutPixel(cx + x, cy - y, rop);
+    if (x != 0 && y != 0)    OLED_PutPixel(cx - x, cy - y, rop);
 }
 
 // ---------- 辅助函数：计算给定垂直偏移 |dy| 时，扫描线应覆盖的最大水平半宽 dx（四舍五入） ----------
+// round(A * sqrt(1 - dy^2/B^2))：取满足 (2k-1)^2 * B^2 <= 4 * A^2 * (B^2 - dy^2) 的最大 k（二分，只有整数乘法）
 static inline int16_t ellipse_scanline_dx(int16_t A, int16_t B, int16_t dy_abs)
 {
-    if (B == 0) return 0;
-    float ratio = ((float)dy_abs * (float)dy_abs) / ((float)B * (float)B);
-    if (ratio >= 1.0f) return 0;
-    return (int16_t)( (float)A * sqrtf(1.0f - ratio) + 0.5f );
+    if (B == 0 || dy_abs >= B) return 0;
+    uint64_t rhs = 4ULL * (uint32_t)(A * A) * (uint32_t)(B * B - dy_abs * dy_abs);
+    uint32_t b2 = (uint32_t)(B * B);
+    int16_t lo = 0, hi = A;                 // 答案在 [0, A] 内，k = 0 恒满足
+    while (lo < hi) {
+        int16_t mid = (int16_t)((lo + hi + 1) >> 1);
+        uint32_t t = (uint32_t)(2 * mid - 1);
+        if ((uint64_t)t * t * b2 <= rhs) lo = mid;
+        else hi = (int16_t)(mid - 1);
+    }
+    return lo;
+}
+
+// 中点椭圆第二区域的初始判别值 b2*(x+1/2)^2 + a2*(y-1)^2 - a2*b2，向零取整（先乘4在整数下精确计算）
+static inline int32_t ellipse_region2_d(int32_t a2, int32_t b2, int32_t x, int32_t y)
+{
+    int64_t d4 = (int64_t)b2 * (2 * x + 1) * (2 * x + 1) + 4LL * a2 * (y - 1) * (y - 1) - 4LL * a2 * b2;
+    return (int32_t)(d4 / 4);
 }
 
 // ---------- 辅助函数：边界修正时对一组对称点按行判断是否需要补画 ----------
@@ -1243,7 +3812,7 @@ static inline int16_t ellipse_scanline_dx(int16_t A, int16_t B, int16_t dy_abs)
 // 这个函数会按四对称把需要补的点都画出来（一次迭代里避免重复）。
 static inline void maybe_plot4_boundary(int16_t cx, int16_t cy,
                                         int16_t bx, int16_t by,
-                                        int16_t A, int16_t B, uint8_t col)
+                                        int16_t A, int16_t B, OLED_RasterOp rop)
 {
     int16_t dy_abs = (int16_t) ( (by < 0) ? -by : by );
     int16_t dx_line = ellipse_scanline_dx(A, B, dy_abs);
@@ -1251,28 +3820,71 @@ static inline void maybe_plot4_boundary(int16_t cx, int16_t cy,
     // 只有当 abs(bx) > dx_line 时，这个边界点是被扫描线漏掉的，需要补画
     if ( (bx < 0 ? -bx : bx) > dx_line ) {
         // 四对称（±bx, ±by），但使用条件避免重复
-        OLED_DrawPoint(cx + bx, cy + by, col);
-        if (bx != 0)              OLED_DrawPoint(cx - bx, cy + by, col);
-        if (by != 0)              OLED_DrawPoint(cx + bx, cy - by, col);
-        if (bx != 0 && by != 0)   OLED_DrawPoint(cx - bx, cy - by, col);
+        OLED_PutPixel(cx + bx, cy + by, rop);
+        if (bx != 0)              OLED_PutPixel(cx - bx, cy + by, rop);
+        if (by != 0)              OLED_PutPixel(cx + bx, cy - by, rop);
+        if (bx != 0 && by != 0)   OLED_PutPixel(cx - bx, cy - by, rop);
+    }
+}
+
+// ---------- 辅助函数：空心椭圆的中点算法主循环（按 rop 展开，NORMAL/XOR 共用） ----------
+static OLED_FORCE_INLINE void OLED_EllipseOutline(int16_t X, int16_t Y, uint8_t A, uint8_t B, OLED_RasterOp rop)
+{
+    int32_t a2 = (int32_t)A * A;
+    int32_t b2 = (int32_t)B * B;
+    int32_t x = 0, y = B;
+    int32_t dx = 2 * b2 * x;
+    int32_t dy = 2 * a2 * y;
+    int32_t d1 = b2 - (int32_t)a2 * B + (a2 >> 2); // b^2 - a^2*B + a^2/4  (approx int)
+    // region 1（plot4_unique 一次迭代内保证不重复写同一点）
+    while (dx < dy) {
+        plot4_unique(X, Y, (int16_t)x, (int16_t)y, rop);
+        if (d1 < 0) {
+            x++;
+            dx += 2 * b2;
+            d1 += dx + b2;
+        } else {
+            x++; y--;
+            dx += 2 * b2;
+            dy -= 2 * a2;
+            d1 += dx - dy + b2;
+        }
+    }
+    // region 2
+    int32_t d2 = ellipse_region2_d(a2, b2, x, y);
+    while (y >= 0) {
+        plot4_unique(X, Y, (int16_t)x, (int16_t)y, rop);
+        if (d2 > 0) {
+            y--;
+            dy -= 2 * a2;
+            d2 += a2 - dy;
+        } else {
+            y--; x++;
+            dx += 2 * b2;
+            dy -= 2 * a2;
+            d2 += dx - dy + a2;
+        }
     }
 }
 
 // ---------- 主函数：OLED_DrawEllipse ----------
 // A = 半长轴 (x 方向), B = 半短轴 (y 方向)
 // IsFilled = 0 -> 空心, !=0 -> 实心
-// operation 在 NORMAL 模式里直接写入；在 XOR 模式里我们把每次写入当作 "toggle"（翻转）操作（使用 col=1）
+// operation 在 NORMAL 模式里直接写入；在 XOR 模式里我们把每次写入当作 "toggle"（翻转）操作
 void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFilled, uint8_t operation)
 {
+    OLED_RasterOp rop;
+
     // 处理退化情况
     if (A == 0 && B == 0) {
         OLED_DrawPoint(X, Y, operation);
         return;
     }
+    if (OLED_ClipRejectBox((int32_t)X - A, (int32_t)Y - B, (int32_t)X + A, (int32_t)Y + B)) return;
     if (A == 0) {
         // 竖线
         if (IsFilled) {
-            OLED_DrawLine(X, Y - B, X, Y + B, 1,operation);
+            OLED_FillBox(X, Y - B, X, Y + B, OLED_ResolveRop(operation));
         } else {
             OLED_DrawPoint(X, Y - B, operation);
             OLED_DrawPoint(X, Y + B, operation);
@@ -1282,7 +3894,7 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
     if (B == 0) {
         // 横线
         if (IsFilled) {
-            OLED_DrawLine(X - A, Y, X + A, Y, 1,operation);
+            OLED_FillBox(X - A, Y, X + A, Y, OLED_ResolveRop(operation));
         } else {
             OLED_DrawPoint(X - A, Y, operation);
             OLED_DrawPoint(X + A, Y, operation);
@@ -1290,25 +3902,27 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
         return;
     }
 
-    // ---------------- NORMAL 模式 ----------------
-    if (oled_draw_mode == OLED_DRAWMODE_NORMAL) {
-        // 空心：中点椭圆算法（整数） + plot4_unique
-        // 实心：按行扫描（对称） 用 OLED_DrawLine（更快）
+    // 绘图模式只在这里解析一次：NORMAL 下为置位/清零，XOR 下总是翻转
+    rop = OLED_ResolveCurveRop(operation);
+
+    // ---------------- 空心：中点椭圆算法（整数），按 rop 展开 ----------------
+    if (!IsFilled) {
+        OLED_ROP_DISPATCH(rop, OLED_EllipseOutline, X, Y, A, B);
+        return;
+    }
+
+    // ---------------- NORMAL 实心：中点算法给出的行，上下镜像两行用扫描线填充 ----------------
+    if (rop != OLED_ROP_XOR) {
         int32_t a2 = (int32_t)A * A;
         int32_t b2 = (int32_t)B * B;
         int32_t x = 0, y = B;
         int32_t dx = 2 * b2 * x;
         int32_t dy = 2 * a2 * y;
-        int32_t d1 = b2 - (int32_t)a2 * B + (a2 >> 2); // b^2 - a^2*B + a^2/4  (approx int)
+        int32_t d1 = b2 - (int32_t)a2 * B + (a2 >> 2);
         // region 1
         while (dx < dy) {
-            if (!IsFilled) {
-                plot4_unique(X, Y, (int16_t)x, (int16_t)y, operation);
-            } else {
-                // 对应四个镜像行，用线段填充更高效
-                OLED_DrawLine(X - (int16_t)x, Y + (int16_t)y, X + (int16_t)x, Y + (int16_t)y, 1,operation);
-                OLED_DrawLine(X - (int16_t)x, Y - (int16_t)y, X + (int16_t)x, Y - (int16_t)y, 1,operation);
-            }
+            OLED_FillBox(X - (int16_t)x, Y + (int16_t)y, X + (int16_t)x, Y + (int16_t)y, rop);
+            OLED_FillBox(X - (int16_t)x, Y - (int16_t)y, X + (int16_t)x, Y - (int16_t)y, rop);
 
             if (d1 < 0) {
                 x++;
@@ -1322,16 +3936,10 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
             }
         }
         // region 2
-        float xf = x + 0.5f;
-        float yf = y - 1.0f;
-        int32_t d2 = (int32_t)(b2 * xf * xf + a2 * yf * yf - a2 * b2);
+        int32_t d2 = ellipse_region2_d(a2, b2, x, y);
         while (y >= 0) {
-            if (!IsFilled) {
-                plot4_unique(X, Y, (int16_t)x, (int16_t)y, operation);
-            } else {
-                OLED_DrawLine(X - (int16_t)x, Y + (int16_t)y, X + (int16_t)x, Y + (int16_t)y, 1,operation);
-                OLED_DrawLine(X - (int16_t)x, Y - (int16_t)y, X + (int16_t)x, Y - (int16_t)y,1, operation);
-            }
+            OLED_FillBox(X - (int16_t)x, Y + (int16_t)y, X + (int16_t)x, Y + (int16_t)y, rop);
+            OLED_FillBox(X - (int16_t)x, Y - (int16_t)y, X + (int16_t)x, Y - (int16_t)y, rop);
 
             if (d2 > 0) {
                 y--;
@@ -1347,100 +3955,52 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
         return;
     }
 
-    // ---------------- XOR 模式 ----------------
-    if (oled_draw_mode == OLED_DRAWMODE_XOR) {
-        uint8_t tog = 1; // 在 XOR 下，把每次绘制视为“翻转”（调用 OLED_DrawPoint(...,1)）
-        // 空心（hollow）: 用中点椭圆 + plot4_unique（一次迭代内保证不重复写同一点）
-        if (!IsFilled) {
-            int32_t a2 = (int32_t)A * A;
-            int32_t b2 = (int32_t)B * B;
-            int32_t x = 0, y = B;
-            int32_t dx = 2 * b2 * x;
-            int32_t dy = 2 * a2 * y;
-            int32_t d1 = b2 - (int32_t)a2 * B + (a2 >> 2);
-            while (dx < dy) {
-                plot4_unique(X, Y, (int16_t)x, (int16_t)y, tog);
-                if (d1 < 0) {
-                    x++;
-                    dx += 2 * b2;
-                    d1 += dx + b2;
-                } else {
-                    x++; y--;
-                    dx += 2 * b2;
-                    dy -= 2 * a2;
-                    d1 += dx - dy + b2;
-                }
-            }
-            int32_t d2 = (int32_t)(b2 * (x + 0.5f) * (x + 0.5f) + a2 * (y - 1) * (y - 1) - a2 * b2);
-            while (y >= 0) {
-                plot4_unique(X, Y, (int16_t)x, (int16_t)y, tog);
-                if (d2 > 0) {
-                    y--;
-                    dy -= 2 * a2;
-                    d2 += a2 - dy;
-                } else {
-                    y--; x++;
-                    dx += 2 * b2;
-                    dy -= 2 * a2;
-                    d2 += dx - dy + a2;
-                }
-            }
-            return;
-        }
+    // ---------------- XOR 实心 ----------------
+    // 1) 扫描线填充（每像素只写一次）  2) 边界修正用 mid-point 边界补那些扫描线没覆盖的点
+    // 1) 扫描线填充
+    for (int16_t dy = -(int16_t)B; dy <= (int16_t)B; ++dy) {
+        int16_t dx = ellipse_scanline_dx((int16_t)A, (int16_t)B, (int16_t)(dy < 0 ? -dy : dy));
+        OLED_FillBox(X - dx, Y + dy, X + dx, Y + dy, OLED_ROP_XOR);
+    }
 
-        // 实心（filled）: 1) 扫描线填充（每像素只写一次）  2) 边界修正用 mid-point 边界补那些扫描线没覆盖的点
-        // 1) 扫描线填充
-        for (int16_t dy = -(int16_t)B; dy <= (int16_t)B; ++dy) {
-            int16_t dx = ellipse_scanline_dx((int16_t)A, (int16_t)B, (int16_t)(dy < 0 ? -dy : dy));
-            for (int16_t xx = -dx; xx <= dx; ++xx) {
-                OLED_DrawPoint(X + xx, Y + dy, tog);
+    // 2) 边界修正：遍历 mid-point 椭圆边界点，补画扫描线漏掉的点
+    {
+        int32_t a2 = (int32_t)A * A;
+        int32_t b2 = (int32_t)B * B;
+        int32_t x = 0, y = B;
+        int32_t dx = 2 * b2 * x;
+        int32_t dy = 2 * a2 * y;
+        int32_t d1 = b2 - (int32_t)a2 * B + (a2 >> 2);
+        // region1
+        while (dx < dy) {
+            // maybe_plot4_boundary 只在扫描线未包含时补画对应对称点
+            maybe_plot4_boundary(X, Y, (int16_t)x, (int16_t)y, (int16_t)A, (int16_t)B, OLED_ROP_XOR);
+            if (d1 < 0) {
+                x++;
+                dx += 2 * b2;
+                d1 += dx + b2;
+            } else {
+                x++; y--;
+                dx += 2 * b2;
+                dy -= 2 * a2;
+                d1 += dx - dy + b2;
             }
         }
-
-        // 2) 边界修正：遍历 mid-point 椭圆边界点，补画扫描线漏掉的点
-        {
-            int32_t a2 = (int32_t)A * A;
-            int32_t b2 = (int32_t)B * B;
-            int32_t x = 0, y = B;
-            int32_t dx = 2 * b2 * x;
-            int32_t dy = 2 * a2 * y;
-            int32_t d1 = b2 - (int32_t)a2 * B + (a2 >> 2);
-            // region1
-            while (dx < dy) {
-                // maybe_plot4_boundary 只在扫描线未包含时补画对应对称点
-                maybe_plot4_boundary(X, Y, (int16_t)x, (int16_t)y, (int16_t)A, (int16_t)B, tog);
-                if (d1 < 0) {
-                    x++;
-                    dx += 2 * b2;
-                    d1 += dx + b2;
-                } else {
-                    x++; y--;
-                    dx += 2 * b2;
-                    dy -= 2 * a2;
-                    d1 += dx - dy + b2;
-                }
-            }
-            int32_t d2 = (int32_t)(b2 * (x + 0.5f) * (x + 0.5f) + a2 * (y - 1) * (y - 1) - a2 * b2);
-            while (y >= 0) {
-                maybe_plot4_boundary(X, Y, (int16_t)x, (int16_t)y, (int16_t)A, (int16_t)B, tog);
-                if (d2 > 0) {
-                    y--;
-                    dy -= 2 * a2;
-                    d2 += a2 - dy;
-                } else {
-                    y--; x++;
-                    dx += 2 * b2;
-                    dy -= 2 * a2;
-                    d2 += dx - dy + a2;
-                }
+        int32_t d2 = ellipse_region2_d(a2, b2, x, y);
+        while (y >= 0) {
+            maybe_plot4_boundary(X, Y, (int16_t)x, (int16_t)y, (int16_t)A, (int16_t)B, OLED_ROP_XOR);
+            if (d2 > 0) {
+                y--;
+                dy -= 2 * a2;
+                d2 += a2 - dy;
+            } else {
+                y--; x++;
+                dx += 2 * b2;
+                dy -= 2 * a2;
+                d2 += dx - dy + a2;
             }
         }
-
-        return;
     }
-
-    // 其它不支持的绘制模式（防御）
-    return;
 }
 
 /**
@@ -1472,86 +4032,58 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
   *					这样相邻的 (0,90) + (90,180) 不会重叠。
   *					调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
-#ifndef RAD_PER_DEG
-#define RAD_PER_DEG 0.017453292519943295f   // π/180
-#endif
-
-// 小常量：浮点比较容差
-static const float EPS_ARC = 1e-6f;
-
 // 绝对值
 static inline int16_t iabs16(int16_t a){ return (a < 0) ? (int16_t)-a : a; }
 
 /*----------辅助函数[计算某行的水平半宽(四舍五入，尽量平滑)]----------------*/
 static inline int16_t circle_scan_dx(uint8_t R, int16_t dy_abs){
-    int32_t t = (int32_t)R * (int32_t)R - (int32_t)dy_abs * (int32_t)dy_abs;
-    if (t <= 0) return 0;
-    return (int16_t)(sqrtf((float)t) + 0.5f);
-}
-
-/*----------辅助函数[精确处理轴向角度（0/90/180/270），其它角度用 cos/sin]----------------*/
-static inline void angle_to_unit_exact(int ang_deg, float *ux, float *uy){
-    int a = ang_deg % 360; if (a < 0) a += 360;
-    switch (a){
-        case 0:   *ux = 1.0f;  *uy = 0.0f;  break;
-        case 90:  *ux = 0.0f;  *uy = 1.0f;  break;
-        case 180: *ux = -1.0f; *uy = 0.0f;  break;
-        case 270: *ux = 0.0f;  *uy = -1.0f; break;
-        default: {
-            float r = (float)a * RAD_PER_DEG;
-            *ux = cosf(r);
-            *uy = sinf(r);
-        } break;
-    }
+    return OLED_CircleDx(R, dy_abs);
 }
 
-/*----------辅助函数[精确扇区判定（含起点、排除终点），使用 epsilon 避免浮点误差]----------------*/
+/*----------辅助函数[精确扇区判定（含起点、排除终点），整数叉积/点积]----------------*/
 /*
- 精确扇区判定（含起点、排除终点），使用 epsilon 避免浮点误差：
+ 精确扇区判定（含起点、排除终点）：
  - 输入 dx,dy 为像素相对坐标（整数）；屏幕坐标下 y 向下，
    转换到数学坐标 p = (dx, -dy) 做叉积判定。
- - sx,sy / ex,ey 为起点/终点单位方向向量（数学坐标），且轴向值已精确处理。
+ - sx,sy / ex,ey 为起点/终点单位方向向量（数学坐标，Q30定点），由 OLED_UnitVectorQ30 得到，
+   轴向与45°倍数的方向精确，点恰好在射线上时叉积严格为0，不需要浮点容差。
  - sweep_deg = 扫过角度（0..359），若为0表示整圆（full circle）。
- 判定规则（和之前保持一致）：
- - 若点在起始射线上（cross≈0 且 dot>=0） -> 包含
- - 若点在结束射线上（cross≈0 且 dot>=0） -> 排除
- - 否则根据 sweep<=180 / >180 使用交集/补集判定（并使用 EPS）
+ 判定规则：
+ - 若点在起始射线上（cross==0 且 dot>=0） -> 包含
+ - 若点在结束射线上（cross==0 且 dot>=0） -> 排除
+ - 否则根据 sweep<=180 / >180 使用交集/补集判定
 */
 static inline int in_wedge_precise(int16_t dx, int16_t dy,
-                                   float sx, float sy, float ex, float ey,
+                                   int32_t sx, int32_t sy, int32_t ex, int32_t ey,
                                    int sweep_deg)
 {
     if (sweep_deg == 0) return 1; // full circle
 
     // 数学坐标 p = (dx, -dy)
-    float px = (float)dx;
-    float py = (float)(-dy);
+    int32_t px = dx;
+    int32_t py = -dy;
 
-    // cross 和 dot
-    float cs = sx * py - sy * px;   // s x p
-    float ce = px * ey - py * ex;   // p x e
-    float ds = sx * px + sy * py;   // s · p
-    float de = ex * px + ey * py;   // e · p
+    // cross 和 dot（Q30 × 像素坐标，64位下精确）
+    int64_t cs = (int64_t)sx * py - (int64_t)sy * px;   // s x p
+    int64_t ce = (int64_t)px * ey - (int64_t)py * ex;   // p x e
 
-    int on_start = (fabsf(cs) <= EPS_ARC && ds >= -EPS_ARC);
-    int on_end   = (fabsf(ce) <= EPS_ARC && de >= -EPS_ARC);
+    int on_start = (cs == 0 && (int64_t)sx * px + (int64_t)sy * py >= 0);
+    int on_end   = (ce == 0 && (int64_t)ex * px + (int64_t)ey * py >= 0);
 
+    if (on_start) return 1;
+    if (on_end)   return 0;
     if (sweep_deg <= 180) {
-        if (on_start) return 1;
-        if (on_end)   return 0;
-        return (cs > EPS_ARC && ce > EPS_ARC);
+        return (cs > 0 && ce > 0);
     } else {
-        if (on_start) return 1;
-        if (on_end)   return 0;
-        return !(cs < -EPS_ARC && ce < -EPS_ARC);
+        return !(cs < 0 && ce < 0);
     }
 }
 
 /*----------辅助函数[在一轮 (x,y) 上，把 8 对称点去重后逐个测试角度并绘制（用于空心或补边界）]----------------*/
 static inline void plot_octants_unique_arc(int16_t cx, int16_t cy,
                                            int16_t x, int16_t y,
-                                           float sx, float sy, float ex, float ey,
-                                           int sweep_deg, uint8_t op)
+                                           int32_t sx, int32_t sy, int32_t ex, int32_t ey,
+                                           int sweep_deg, OLED_RasterOp rop)
 {
     int16_t candx[8] = { (int16_t)x, (int16_t)-x, (int16_t)x, (int16_t)-x, (int16_t)y, (int16_t)-y, (int16_t)y, (int16_t)-y };
     int16_t candy[8] = { (int16_t)y, (int16_t)y, (int16_t)-y, (int16_t)-y, (int16_t)x, (int16_t)x, (int16_t)-x, (int16_t)-x };
@@ -1564,26 +4096,61 @@ static inline void plot_octants_unique_arc(int16_t cx, int16_t cy,
         if (dup) continue;
 
         if (in_wedge_precise(candx[i], candy[i], sx, sy, ex, ey, sweep_deg)){
-            OLED_DrawPoint(cx + candx[i], cy + candy[i], op);
+            OLED_PutPixel(cx + candx[i], cy + candy[i], rop);
         }
     }
 }
 
-/* ---------------- 主函数：OLED_DrawArc（替换用） ----------------
-   X,Y: 圆心；Radius: 半径
-   StartAngle, EndAngle: 数学角度（+X=0°, 逆时针）
-   IsFilled: 0=空心（画弧）；非0=实心（扇形）
-   color: NORMAL 下颜色；XOR 下忽略，使用翻转 op=1
-*/
-void OLED_DrawArc(int16_t X, int16_t Y,
-                  uint8_t Radius,
-                  int16_t StartAngle, int16_t EndAngle,
-                  uint8_t IsFilled, uint8_t color)
+/*----------辅助函数[扇形的一行：[-dx, dx] 中落在扇区内的连续像素合并成整段输出]----------------*/
+static void sector_scan_row(int16_t cx, int16_t cy, int16_t dy, int16_t dx,
+                            int32_t sx, int32_t sy, int32_t ex, int32_t ey,
+                            int sweep_deg, OLED_RasterOp rop)
+{
+    int16_t xx, runStart = 0;
+    uint8_t inRun = 0;
+
+    if (sweep_deg == 0) {   // 整圆：整行
+        OLED_FillBox(cx - dx, cy + dy, cx + dx, cy + dy, rop);
+        return;
+    }
+    for (xx = -dx; xx <= dx; ++xx) {
+        if (in_wedge_precise(xx, dy, sx, sy, ex, ey, sweep_deg)) {
+            if (!inRun) { runStart = xx; inRun = 1; }
+        } else if (inRun) {
+            OLED_FillBox(cx + runStart, cy + dy, cx + xx - 1, cy + dy, rop);
+            inRun = 0;
+        }
+    }
+    if (inRun) OLED_FillBox(cx + runStart, cy + dy, cx + dx, cy + dy, rop);
+}
+
+/*----------辅助函数[空心圆弧的 midpoint 主循环（按 rop 展开，NORMAL/XOR 共用）]----------------*/
+static OLED_FORCE_INLINE void OLED_ArcOutline(int16_t X, int16_t Y, uint8_t Radius,
+                                              int32_t sx, int32_t sy, int32_t ex, int32_t ey,
+                                              int sweep, OLED_RasterOp rop)
+{
+    int16_t x = 0, y = Radius;
+    int16_t d = 1 - (int16_t)Radius;
+    while (x <= y) {
+        // 去重 + 精确扇区判定，XOR 下每个像素只翻转一次
+        plot_octants_unique_arc(X, Y, x, y, sx, sy, ex, ey, sweep, rop);
+        if (d < 0) d += 2*x + 3;
+        else { d += 2*(x - y) + 5; y--; }
+        x++;
+    }
+}
+
+/*----------辅助函数[圆弧/扇形本体：rop 已由调用者解析，XOR 模式下 rop 恒为 OLED_ROP_XOR]----------------*/
+static void OLED_ArcRop(int16_t X, int16_t Y,
+                        uint8_t Radius,
+                        int16_t StartAngle, int16_t EndAngle,
+                        uint8_t IsFilled, OLED_RasterOp rop)
 {
     if (Radius == 0) {
-        if (IsFilled) OLED_DrawPoint(X, Y, (oled_draw_mode==OLED_DRAWMODE_XOR)?1:color);
+        if (IsFilled) OLED_PutPixel(X, Y, rop);
         return;
     }
+    if (OLED_ClipRejectBox((int32_t)X - Radius, (int32_t)Y - Radius, (int32_t)X + Radius, (int32_t)Y + Radius)) return;
 
     // 角度归一化到 [0,360)
     int a0 = StartAngle % 360; if (a0 < 0) a0 += 360;
@@ -1592,91 +4159,66 @@ void OLED_DrawArc(int16_t X, int16_t Y,
     // 扫角（逆时针），a1==a0 视为整圆
     int sweep = a1 - a0; if (sweep < 0) sweep += 360;
 
-    // 单位向量（轴向角度精确）
-    float sx, sy, ex, ey;
-    angle_to_unit_exact(a0, &sx, &sy);
-    angle_to_unit_exact(a1, &ex, &ey);
-
-    // XOR 模式
-    if (oled_draw_mode == OLED_DRAWMODE_XOR) {
-        uint8_t op = 1; // toggle
-
-        if (!IsFilled) {
-            // 空心：midpoint circle + 去重 + 精确扇区判定
-            int16_t x = 0, y = Radius;
-            int16_t d = 1 - (int16_t)Radius;
-            while (x <= y) {
-                plot_octants_unique_arc(X, Y, x, y, sx, sy, ex, ey, sweep, op);
-                if (d < 0) d += 2*x + 3;
-                else { d += 2*(x - y) + 5; y--; }
-                x++;
-            }
-            return;
-        }
-
-        // 实心扇形：扫描线填充（每像素只写一次），再做外圈补点（只补扫描线未覆盖的点）
-        for (int16_t dy = -(int16_t)Radius; dy <= (int16_t)Radius; ++dy) {
-            int16_t dx = circle_scan_dx(Radius, iabs16(dy));
-            for (int16_t xx = -dx; xx <= dx; ++xx) {
-                if (in_wedge_precise(xx, dy, sx, sy, ex, ey, sweep)) {
-                    OLED_DrawPoint(X + xx, Y + dy, op);
-                }
-            }
-        }
-
-        // 外圈补点（补扫描线没覆盖的边界点）
-        {
-            int16_t x = 0, y = Radius;
-            int16_t d = 1 - (int16_t)Radius;
-            while (x <= y) {
-                int16_t candx[8] = { (int16_t)x, (int16_t)-x, (int16_t)x, (int16_t)-x, (int16_t)y, (int16_t)-y, (int16_t)y, (int16_t)-y };
-                int16_t candy[8] = { (int16_t)y, (int16_t)y, (int16_t)-y, (int16_t)-y, (int16_t)x, (int16_t)x, (int16_t)-x, (int16_t)-x };
-                for (int i = 0; i < 8; ++i) {
-                    int dup = 0;
-                    for (int k = 0; k < i; ++k) {
-                        if (candx[i]==candx[k] && candy[i]==candy[k]) { dup=1; break; }
-                    }
-                    if (dup) continue;
-
-                    if (!in_wedge_precise(candx[i], candy[i], sx, sy, ex, ey, sweep)) continue;
-
-                    int16_t yabs = iabs16(candy[i]);
-                    int16_t dx_line = circle_scan_dx(Radius, yabs);
-                    if (iabs16(candx[i]) > dx_line) {
-                        OLED_DrawPoint(X + candx[i], Y + candy[i], op);
-                    }
-                }
-                if (d < 0) d += 2*x + 3;
-                else { d += 2*(x - y) + 5; y--; }
-                x++;
-            }
-        }
+    // 单位向量（Q30定点，轴向角度精确）
+    int32_t sx, sy, ex, ey;
+    OLED_UnitVectorQ30((int16_t)a0, &sx, &sy);
+    OLED_UnitVectorQ30((int16_t)a1, &ex, &ey);
 
+    // 空心：midpoint circle + 去重 + 精确扇区判定
+    if (!IsFilled) {
+        OLED_ROP_DISPATCH(rop, OLED_ArcOutline, X, Y, Radius, sx, sy, ex, ey, sweep);
         return;
     }
 
-    // NORMAL 模式
-    if (!IsFilled) {
+    // 实心扇形：扫描线填充（每像素只写一次）
+    for (int16_t dy = -(int16_t)Radius; dy <= (int16_t)Radius; ++dy) {
+        sector_scan_row(X, Y, dy, circle_scan_dx(Radius, iabs16(dy)), sx, sy, ex, ey, sweep, rop);
+    }
+    if (rop != OLED_ROP_XOR) return;
+
+    // XOR：外圈补点（只补扫描线没覆盖的边界点）
+    {
         int16_t x = 0, y = Radius;
         int16_t d = 1 - (int16_t)Radius;
         while (x <= y) {
-            plot_octants_unique_arc(X, Y, x, y, sx, sy, ex, ey, sweep, color);
+            int16_t candx[8] = { (int16_t)x, (int16_t)-x, (int16_t)x, (int16_t)-x, (int16_t)y, (int16_t)-y, (int16_t)y, (int16_t)-y };
+            int16_t candy[8] = { (int16_t)y, (int16_t)y, (int16_t)-y, (int16_t)-y, (int16_t)x, (int16_t)x, (int16_t)-x, (int16_t)-x };
+            for (int i = 0; i < 8; ++i) {
+                int dup = 0;
+                for (int k = 0; k < i; ++k) {
+                    if (candx[i]==candx[k] && candy[i]==candy[k]) { dup=1; break; }
+                }
+                if (dup) continue;
+
+                if (!in_wedge_precise(candx[i], candy[i], sx, sy, ex, ey, sweep)) continue;
+
+                int16_t yabs = iabs16(candy[i]);
+                int16_t dx_line = circle_scan_dx(Radius, yabs);
+                if (iabs16(candx[i]) > dx_line) {
+                    OLED_PutPixel(X + candx[i], Y + candy[i], OLED_ROP_XOR);
+                }
+            }
             if (d < 0) d += 2*x + 3;
             else { d += 2*(x - y) + 5; y--; }
             x++;
         }
-    } else {
-        for (int16_t dy = -(int16_t)Radius; dy <= (int16_t)Radius; ++dy) {
-            int16_t dx = circle_scan_dx(Radius, iabs16(dy));
-            for (int16_t xx = -dx; xx <= dx; ++xx) {
-                if (in_wedge_precise(xx, dy, sx, sy, ex, ey, sweep)) {
-                    OLED_DrawPoint(X + xx, Y + dy, color);
-                }
-            }
-        }
     }
 }
 
+/* ---------------- 主函数：OLED_DrawArc（替换用） ----------------
+   X,Y: 圆心；Radius: 半径
+   StartAngle, EndAngle: 数学角度（+X=0°, 逆时针）
+   IsFilled: 0=空心（画弧）；非0=实心（扇形）
+   color: NORMAL 下颜色；XOR 下忽略，使用翻转
+*/
+void OLED_DrawArc(int16_t X, int16_t Y,
+                  uint8_t Radius,
+                  int16_t StartAngle, int16_t EndAngle,
+                  uint8_t IsFilled, uint8_t color)
+{
+    OLED_ArcRop(X, Y, Radius, StartAngle, EndAngle, IsFilled, OLED_ResolveCurveRop(color));
+}
+
 /**
   * @brief 绘制圆角矩形
   * @param x, y: 矩形左上角坐标
@@ -1694,25 +4236,23 @@ void OLED_DrawArc(int16_t X, int16_t Y,
   *       确保所有坐标在屏幕范围内
   */
 /*----------辅助函数[画水平线（含端点），会自动处理 x0>x1 的情况]----------------*/
-static inline void _hline(int16_t x0, int16_t x1, int16_t y, uint8_t op)
+static inline void _hline(int16_t x0, int16_t x1, int16_t y, OLED_RasterOp rop)
 {
     if (x1 < x0) { int16_t t = x0; x0 = x1; x1 = t; }
-    for (int16_t x = x0; x <= x1; ++x) OLED_DrawPoint(x, y, op);
+    OLED_FillBox(x0, y, x1, y, rop);
 }
 
 /*----------辅助函数[画垂直线（含端点），会自动处理 y0>y1 的情况]----------------*/
-static inline void _vline(int16_t x, int16_t y0, int16_t y1, uint8_t op)
+static inline void _vline(int16_t x, int16_t y0, int16_t y1, OLED_RasterOp rop)
 {
     if (y1 < y0) { int16_t t = y0; y0 = y1; y1 = t; }
-    for (int16_t y = y0; y <= y1; ++y) OLED_DrawPoint(x, y, op);
+    OLED_FillBox(x, y0, x, y1, rop);
 }
 
 /*----------辅助函数[计算某一行相对圆心的垂直偏移（绝对值）对应的水平半宽（四舍五入）]----------------*/
 static inline int16_t _dx_round(uint8_t r, int16_t dy_abs)
 {
-    int32_t t = (int32_t)r * (int32_t)r - (int32_t)dy_abs * (int32_t)dy_abs;
-    if (t <= 0) return 0;
-    return (int16_t)(sqrtf((float)t) + 0.5f);
+    return OLED_CircleDx(r, dy_abs);   // 半径1~8查圆角轮廓表
 }
 
 /*-----------------主函数-------------------------*/
@@ -1733,6 +4273,10 @@ void OLED_DrawRoundRect(int16_t x, int16_t y,
                         uint8_t isFilled, uint8_t operation)
 {
     if (width == 0 || height == 0) return;
+    if (OLED_ClipRejectBox(x, y, (int32_t)x + width - 1, (int32_t)y + height - 1)) return;
+
+    // 绘图模式只在这里解析一次：NORMAL 下为置位/清零，XOR 下总是翻转
+    OLED_RasterOp rop = OLED_ResolveCurveRop(operation);
 
     // 半径夹紧
     uint16_t minwh = (width < height) ? width : height;
@@ -1741,23 +4285,18 @@ void OLED_DrawRoundRect(int16_t x, int16_t y,
     // r=0 → 普通矩形
     if (radius == 0) {
         if (isFilled) {
-            for (int16_t yy = y; yy < (int16_t)(y + height); ++yy) {
-                _hline(x, x + (int16_t)width - 1, yy,
-                       (oled_draw_mode == OLED_DRAWMODE_XOR) ? 1 : operation);
-            }
+            OLED_FillBox(x, y, x + (int16_t)width - 1, y + (int16_t)height - 1, rop);
         } else {
-            uint8_t op = (oled_draw_mode == OLED_DRAWMODE_XOR) ? 1 : operation;
-            _hline(x, x + (int16_t)width - 1, y, op);
-            _hline(x, x + (int16_t)width - 1, y + (int16_t)height - 1, op);
-            _vline(x, y, y + (int16_t)height - 1, op);
-            _vline(x + (int16_t)width - 1, y, y + (int16_t)height - 1, op);
+            _hline(x, x + (int16_t)width - 1, y, rop);
+            _hline(x, x + (int16_t)width - 1, y + (int16_t)height - 1, rop);
+            _vline(x, y, y + (int16_t)height - 1, rop);
+            _vline(x + (int16_t)width - 1, y, y + (int16_t)height - 1, rop);
         }
         return;
     }
 
     // ------------ 实心：扫描线一遍搞定（XOR下每像素只写一次） ------------
     if (isFilled) {
-        uint8_t op = (oled_draw_mode == OLED_DRAWMODE_XOR) ? 1 : operation;
         int16_t xL = (int16_t)x;
         int16_t xR = (int16_t)x + (int16_t)width - 1;
         int16_t y0 = (int16_t)y;
@@ -1793,7 +4332,7 @@ void OLED_DrawRoundRect(int16_t x, int16_t y,
 
             if (xmin < xL) xmin = xL;
             if (xmax > xR) xmax = xR;
-            if (xmin <= xmax) _hline(xmin, xmax, yy, op);
+            if (xmin <= xmax) _hline(xmin, xmax, yy, rop);
         }
         return;
     }
@@ -1809,17 +4348,15 @@ void OLED_DrawRoundRect(int16_t x, int16_t y,
     int16_t cx_br = x + (int16_t)width - radius - 1;  // bottom-right
     int16_t cy_br = y + (int16_t)height - radius - 1;
 
-    uint8_t arc_col = (oled_draw_mode == OLED_DRAWMODE_XOR) ? 1 : operation;
-
     // 四个圆角：角度按数学定义（+X=0°，逆时针增长）；起始边含、结束边不含
     // 左上：  90..180
-    OLED_DrawArc(cx_tl, cy_tl, radius, 90, 180, 0, arc_col);
+    OLED_ArcRop(cx_tl, cy_tl, radius, 90, 180, 0, rop);
     // 右上：   0..90
-    OLED_DrawArc(cx_tr, cy_tr, radius, 0, 90, 0, arc_col);
+    OLED_ArcRop(cx_tr, cy_tr, radius, 0, 90, 0, rop);
     // 左下： 180..270
-    OLED_DrawArc(cx_bl, cy_bl, radius, 180, 270, 0, arc_col);
+    OLED_ArcRop(cx_bl, cy_bl, radius, 180, 270, 0, rop);
     // 右下： 270..360
-    OLED_DrawArc(cx_br, cy_br, radius, 270, 360, 0, arc_col);
+    OLED_ArcRop(cx_br, cy_br, radius, 270, 360, 0, rop);
 
     // 直边：为避免 XOR 与圆角像素重叠翻转，端点做“谁含谁不含”的对齐：
     // 规则（与 Arc 一致：含起始/不含结束）：
@@ -1831,33 +4368,32 @@ void OLED_DrawRoundRect(int16_t x, int16_t y,
     //   → 左边画 [y+r .. y+h-r-2]
     // - 右边：顶端(0°)由右上弧“包含”，底端(0°)由右下弧“不包含”
     //   → 右边画 [y+r+1 .. y+h-r-1]
-    uint8_t edge_col = (oled_draw_mode == OLED_DRAWMODE_XOR) ? 1 : operation;
 
     // 顶边 y = y
     {
         int16_t xs = x + (int16_t)radius + 1;
         int16_t xe = x + (int16_t)width - (int16_t)radius - 1;
-        if (xs <= xe) _hline(xs, xe, y, edge_col);
+        if (xs <= xe) _hline(xs, xe, y, rop);
     }
     // 底边 y = y+height-1
     {
         int16_t xs = x + (int16_t)radius;
         int16_t xe = x + (int16_t)width - (int16_t)radius - 2;
         int16_t yy = y + (int16_t)height - 1;
-        if (xs <= xe) _hline(xs, xe, yy, edge_col);
+        if (xs <= xe) _hline(xs, xe, yy, rop);
     }
     // 左边 x = x
     {
         int16_t ys = y + (int16_t)radius;
         int16_t ye = y + (int16_t)height - (int16_t)radius - 2;
-        if (ys <= ye) _vline(x, ys, ye, edge_col);
+        if (ys <= ye) _vline(x, ys, ye, rop);
     }
     // 右边 x = x+width-1
     {
         int16_t ys = y + (int16_t)radius + 1;
         int16_t ye = y + (int16_t)height - (int16_t)radius - 1;
         int16_t xx = x + (int16_t)width - 1;
-        if (ys <= ye) _vline(xx, ys, ye, edge_col);
+        if (ys <= ye) _vline(xx, ys, ye, rop);
     }
 }
 
@@ -1869,47 +4405,844 @@ void OLED_DrawRoundRect(int16_t x, int16_t y,
   * @param Width 指定图像的宽度，范围：0~96
   * @param Height 指定图像的高度，范围：0~96
   * @param Image 指定要显示的图像
-  * @param IsMix 若传入0，则图像取模中未被点亮的的像素也会强制熄灭，不管该点像素之前是否点亮；若传入1，则图像取模中未被点亮的的像素不会对其操作，保留该点像素之前的状态。
+  * @param IsMix 混合方式：
+  *        OLED_IMAGE_COPY(0)：图像取模中未被点亮的的像素也会强制熄灭，不管该点像素之前是否点亮；
+  *        OLED_IMAGE_OR(1)：图像取模中未被点亮的的像素不会对其操作，保留该点像素之前的状态；
+  *        OLED_IMAGE_XOR(2)：图像中点亮的像素将显存对应像素取反；
+  *        OLED_IMAGE_ANDNOT(3)：图像中点亮的像素将显存对应像素熄灭(擦除)。
   * @return 无
   * @brief 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数。oled_draw_mode与operation的值对其无效，该函数只遵循IsMix参数选择的模式的效果。
   *        算法介绍：https://www.bilibili.com/video/BV1EN41177Pc/?spm_id_from=333.1391.0.0&p=5&vd_source=3270faada43d444eec68d30700fef9b9  第19分钟开始
   * @note：Width与Height必须与图像参数一致（注意！是与图像的实际像素参数一致，而不是与给图像取模的像素一致，比如图像参数为宽10*高10，
   *       但是由于取模时高度必须为8的整数，所以取模的像素为宽10*高16，但是这里要传入的Width是10，Height是10），否则无法正常显示图像
+  * @note：对当前裁剪区的裁剪在循环外只算一次；按目标页遍历，每页由相邻两行取模拼成，每个显存字节只读写一次；
+  *       Y为8的整数倍且为覆盖模式时整页直接memcpy
   **/
 void OLED_ShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image,unsigned char IsMix)
 {
-    uint8_t i = 0, j = 0;
-    int16_t Page, Shift;
-		
-		if(!IsMix){
-			/* 清空对应区域的显存位（产生覆盖效果）*/
-			OLED_ClearArea(X, Y, Width, Height);
-		}
-		
-    for (j = 0; j < (Height - 1) / 8 + 1; j++)
+    int32_t y = Y;
+    int16_t page, p, pEnd;
+    int16_t iStart, iEnd, n;
+    uint8_t shift, rows, j, clip;
+    uint8_t keep = 0x00;
+
+    rows = (uint8_t)((Height - 1) / 8 + 1);     // 取模页数(Height为0时仍按1页处理，与原实现一致)
+    /* 取模按整页存放，最后一页的多余位也会被写进显存，脏区按整页高度记录 */
+    OLED_MarkDirtyArea(X, Y, Width, (int16_t)(rows * 8));
+
+    /*横向裁剪一次*/
+    iStart = (X < oled_clip.X0) ? (int16_t)(oled_clip.X0 - X) : 0;
+    iEnd   = (X + Width > oled_clip.X1 + 1) ? (int16_t)(oled_clip.X1 + 1 - X) : Width;
+    if (iStart >= iEnd) return;
+    n = (int16_t)(iEnd - iStart);
+
+    /*加32768后为正数，向下取整得到起始页与页内偏移*/
+    page  = (int16_t)(((y + 32768) >> 3) - 4096);
+    shift = (uint8_t)((y + 32768) & 0x07);
+
+    /*纵向裁剪一次：图像覆盖 page ~ page+rows 页(shift为0时不跨入最后一页)*/
+    p    = (page < (oled_clip.Y0 >> 3)) ? (int16_t)(oled_clip.Y0 >> 3) : page;
+    pEnd = (int16_t)(page + rows - (shift ? 0 : 1));
+    if (pEnd > (oled_clip.Y1 >> 3)) pEnd = (int16_t)(oled_clip.Y1 >> 3);
+
+    for (; p <= pEnd; p++)
+    {
+        const uint8_t *hi, *lo;
+        uint8_t hs = shift, ls = (uint8_t)(8 - shift);
+        uint8_t *dst;
+
+        clip = OLED_ClipPageMask(p);
+        if (!clip) continue;
+        dst = &OLED_TARGET_ROW(p)[X + iStart];
+
+        j = (uint8_t)(p - page);
+        /*本页由取模第j页左移shift与第j-1页右移(8-shift)拼成，缺的一半移8位后为0*/
+        hi = (j < rows)         ? Image + (uint16_t)j * Width + iStart       : NULL;
+        lo = (j > 0 && shift)   ? Image + (uint16_t)(j - 1) * Width + iStart : NULL;
+        if (hi == NULL) { hi = lo; hs = 8; }
+        if (lo == NULL) { lo = hi; ls = 8; }
+
+        if (IsMix == OLED_IMAGE_COPY)
+        {
+            /*覆盖模式：清掉本页落在图像矩形[Y, Y+Height-1]内的位*/
+            int32_t top = y - (int32_t)p * 8;
+            int32_t bot = top + Height - 1;
+            keep = 0xFF;
+            if (Height && top <= 7 && bot >= 0)
+            {
+                uint8_t m = (uint8_t)(0xFF << (top < 0 ? 0 : top));
+                if (bot < 7) m &= (uint8_t)(0xFF >> (7 - bot));
+                keep = (uint8_t)~m;
+            }
+            keep |= (uint8_t)~clip;
+            if (keep == 0x00 && ls == 8 && hs == 0)
+            {
+                /*页对齐且整页覆盖：直接拷贝*/
+                memcpy(dst, hi, n);
+                continue;
+            }
+        }
+        OLED_BlendSpan(dst, hi, lo, hs, ls, n, keep, clip, IsMix);
+    }
+}
+
+/**
+  * @brief OLED显示PackBits压缩图像(由 Tools/oled_packbits.py 从原始取模数组生成)
+  * @param X 指定图像左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定图像左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Width 指定图像的宽度，范围：0~96
+  * @param Height 指定图像的高度，范围：0~96
+  * @param Packed 指定要显示的压缩图像
+  * @param IsMix 混合方式，同 OLED_ShowImage
+  * @return 无
+  * @note 显示效果与 OLED_ShowImage 显示原始数组一致，只是取模最后一页中 Height 以下的多余位不会写进显存
+  *       (OLED_ShowImage 与原实现一样会把它们也混合进去，多余位为0的取模两者完全相同)；
+  *       边解码边写入显存，不需要中间缓冲区. 纵向完全在裁剪区外的页与横向被裁掉的列按游程整段跳过，
+  *       最后一个可见页之后不再解码.
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  **/
+void OLED_ShowImagePacked(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Packed, unsigned char IsMix)
+{
+    int32_t y = Y;
+    int16_t page, p, iStart, iEnd, i;
+    uint8_t shift, rows, j, last;
+    OLED_Unpacker u;
+
+    rows = (uint8_t)((Height - 1) / 8 + 1);
+    last = (uint8_t)(0xFF >> (rows * 8 - Height));      // 取模最后一页中 Height 以内的行
+    OLED_MarkDirtyArea(X, Y, Width, (int16_t)(rows * 8));
+
+    iStart = (X < oled_clip.X0) ? (int16_t)(oled_clip.X0 - X) : 0;
+    iEnd   = (X + Width > oled_clip.X1 + 1) ? (int16_t)(oled_clip.X1 + 1 - X) : Width;
+    if (iStart >= iEnd) return;
+
+    page  = (int16_t)(((y + 32768) >> 3) - 4096);
+    shift = (uint8_t)((y + 32768) & 0x07);
+
+    if (IsMix == OLED_IMAGE_COPY)
     {
-        for (i = 0; i < Width; i++)
+        /*先清空图像矩形，之后按叠加处理，与 OLED_ShowImage 的覆盖效果一致*/
+        OLED_FillRect(X, Y, Width, Height, OLED_ROP_CLEAR);
+        IsMix = OLED_IMAGE_OR;
+    }
+
+    u.Src = Packed;
+    u.Left = 0;
+    u.Repeat = 0;
+    for (j = 0; j < rows; j++)
+    {
+        uint8_t *d0 = NULL, *d1 = NULL;
+        uint8_t m0, m1, rowMask = (j == rows - 1) ? last : 0xFF;
+
+        /*取模第j页落在显存第page+j页(左移shift)与第page+j+1页(右移8-shift)，各自只写裁剪区内的位*/
+        p = (int16_t)(page + j);
+        if (p > (oled_clip.Y1 >> 3)) break;         // 之后的页都在裁剪区下方
+        m0 = OLED_ClipPageMask(p);
+        m1 = shift ? OLED_ClipPageMask((int16_t)(p + 1)) : 0x00;
+        if (m0) d0 = &OLED_TARGET_ROW(p)[X + iStart];
+        if (m1) d1 = &OLED_TARGET_ROW(p + 1)[X + iStart];
+        if (d0 == NULL && d1 == NULL)
+        {
+            OLED_UnpackSkip(&u, Width);
+            continue;
+        }
+
+        OLED_UnpackSkip(&u, (uint16_t)iStart);
+        for (i = 0; i < iEnd - iStart; i++)
         {
-            if (X + i >= 0 && X + i < OLED_WIDTH)//数组越界处理
+            uint8_t b = (uint8_t)(OLED_UnpackByte(&u) & rowMask);
+            uint8_t v0 = (uint8_t)(b << shift) & m0;
+            uint8_t v1 = (uint8_t)(b >> (8 - shift)) & m1;
+
+            switch (IsMix)
             {
-                Page = Y / 8;
-                Shift = Y % 8;
-                if (Y < 0) { Page -= 1; Shift += 8; }
+                case OLED_IMAGE_XOR:
+                    if (d0) d0[i] ^= v0;
+                    if (d1) d1[i] ^= v1;
+                    break;
+                case OLED_IMAGE_ANDNOT:
+                    if (d0) d0[i] &= (uint8_t)~v0;
+                    if (d1) d1[i] &= (uint8_t)~v1;
+                    break;
+                default:
+                    if (d0) d0[i] |= v0;
+                    if (d1) d1[i] |= v1;
+                    break;
+            }
+        }
+        OLED_UnpackSkip(&u, (uint16_t)(Width - iEnd));
+    }
+}
+
+/**
+  * @brief OLED按指定尺寸缩放显示图像(最近邻)
+  * @param X 指定图像左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定图像左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Width 原图的宽度，范围：1~255
+  * @param Height 原图的高度，范围：1~255
+  * @param Image 原图取模数组，取模方式与 OLED_ShowImage 相同
+  * @param DstWidth 显示的宽度，范围：0~255
+  * @param DstHeight 显示的高度，范围：0~255
+  * @param IsMix 混合方式，同 OLED_ShowImage
+  * @return 无
+  * @note 显示的第i列取原图第 (i * step + step / 2) >> 16 列，step = (Width << 16) / DstWidth(行同理)：
+  *       即按像素中心采样，步长在入口处各除一次，
+  *       之后逐列/逐行只做加法；每个显存字节由本页8行各自对应的原图行拼成，只读写一次.
+  *       放大、缩小都可以，同一张取模就能做缩放动画，不用在Flash里存多份尺寸.
+  *       只写显示矩形[Y, Y+DstHeight-1]内的位(不像 OLED_ShowImage 会写入取模最后一页的多余位)
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  **/
+void OLED_ShowImageScaled(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image,
+                          uint8_t DstWidth, uint8_t DstHeight, unsigned char IsMix)
+{
+    int32_t x0 = X, y0 = Y, x1 = (int32_t)X + DstWidth - 1, y1 = (int32_t)Y + DstHeight - 1;
+    uint32_t stepX, stepY, accX0;
+    const uint8_t *srcRow[8];
+    uint8_t srcBit[8];
+    int16_t page, pageEnd, i;
+
+    if (Width == 0 || Height == 0 || DstWidth == 0 || DstHeight == 0) return;
+
+    /*裁剪一次*/
+    if (x0 < oled_clip.X0) x0 = oled_clip.X0;
+    if (y0 < oled_clip.Y0) y0 = oled_clip.Y0;
+    if (x1 > oled_clip.X1) x1 = oled_clip.X1;
+    if (y1 > oled_clip.Y1) y1 = oled_clip.Y1;
+    if (x0 > x1 || y0 > y1) return;
+    OLED_MarkDirty((uint8_t)(y0 >> 3), (uint8_t)(y1 >> 3), (uint8_t)x0, (uint8_t)x1);
+
+    /*16.16定点步长，采样点取像素中心；裁掉的左侧列直接跳过*/
+    stepX = ((uint32_t)Width << 16) / DstWidth;
+    stepY = ((uint32_t)Height << 16) / DstHeight;
+    accX0 = (uint32_t)(x0 - X) * stepX + (stepX >> 1);
+
+    pageEnd = (int16_t)(y1 >> 3);
+    for (page = (int16_t)(y0 >> 3); page <= pageEnd; page++)
+    {
+        int16_t yTop = (int16_t)(page * 8), yFrom, yTo, k;
+        uint32_t accY, accX = accX0;
+        uint16_t lastSx = 0xFFFF;
+        uint8_t mask = 0, v = 0, b;
+        uint8_t *dst = &OLED_TARGET_ROW(page)[x0];
+
+        /*本页第k行对应原图的第几行：预先算出所在取模页与位*/
+        yFrom = (yTop < y0) ? (int16_t)y0 : yTop;
+        yTo   = (yTop + 7 > y1) ? (int16_t)y1 : (int16_t)(yTop + 7);
+        accY  = (uint32_t)(yFrom - Y) * stepY + (stepY >> 1);
+        for (k = (int16_t)(yFrom - yTop); k <= yTo - yTop; k++, accY += stepY)
+        {
+            uint16_t sy = (uint16_t)(accY >> 16);
+            srcRow[k] = Image + (uint16_t)(sy >> 3) * Width;
+            srcBit[k] = (uint8_t)(sy & 0x07);
+            mask |= (uint8_t)(1 << k);
+        }
+
+        for (i = 0; i <= x1 - x0; i++, accX += stepX)
+        {
+            uint16_t sx = (uint16_t)(accX >> 16);
 
-                if (Page + j >= 0 && Page + j < OLED_PAGES)//数组越界处理
+            /*放大时相邻几列取同一原图列，拼好的字节直接复用*/
+            if (sx != lastSx)
+            {
+                lastSx = sx;
+                v = 0;
+                for (k = (int16_t)(yFrom - yTop); k <= yTo - yTop; k++)
                 {
-                    OLED_DisplayBuf[Page + j][X + i] |= ((uint8_t)Image[j * Width + i]) << (Shift);
+                    b = (uint8_t)((srcRow[k][sx] >> srcBit[k]) & 0x01);
+                    v |= (uint8_t)(b << k);
                 }
+            }
+            switch (IsMix)
+            {
+                case OLED_IMAGE_COPY:   dst[i] = (uint8_t)((dst[i] & ~mask) | v); break;
+                case OLED_IMAGE_XOR:    dst[i] ^= v;                              break;
+                case OLED_IMAGE_ANDNOT: dst[i] &= (uint8_t)~v;                    break;
+                default:                dst[i] |= v;                              break;
+            }
+        }
+    }
+}
+
+/**
+  * @brief OLED显示带遮罩的精灵(有透明像素的图像)
+  * @param X 指定精灵左上角的横坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Y 指定精灵左上角的纵坐标，范围：-32768~32767，屏幕区域：0~95
+  * @param Width 指定精灵的宽度，范围：0~96
+  * @param Height 指定精灵的高度，范围：0~96
+  * @param Sprite 精灵数据：先是图像平面，紧接着是同样大小的遮罩平面，两个平面的取模方式都与 OLED_ShowImage 相同
+  * @param Mode 混合方式：
+  *        OLED_SPRITE_MASK(0)：遮罩内的像素换成图像，遮罩外的像素保持不变(透明)；
+  *        OLED_SPRITE_XOR(1)：遮罩内图像点亮的像素取反；
+  *        OLED_SPRITE_INVERT(2)：遮罩内的像素换成反色图像(选中/高亮效果)。
+  * @return 无
+  * @note 遮罩比图像大一圈时，精灵叠在任何背景上都带一圈暗色描边.
+  *       精灵矩形[Y, Y+Height-1]之外的位不改变(取模最后一页的多余位不会写进显存)，与绘图模式无关.
+  * @note 裁剪在循环外只算一次；按目标页遍历，每个显存字节只读写一次，Y为8的整数倍时不做跨页拼接
+  * @note 调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  **/
+void OLED_ShowSprite(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Sprite, unsigned char Mode)
+{
+    int32_t y = Y;
+    int16_t page, p, pEnd, iStart, iEnd;
+    uint8_t shift, rows, j, clip;
+    const uint8_t *mask;
+
+    if (Width == 0 || Height == 0) return;
+    rows = (uint8_t)((Height - 1) / 8 + 1);
+    mask = Sprite + (uint16_t)rows * Width;
+
+    /*横向、纵向各裁剪一次*/
+    iStart = (X < oled_clip.X0) ? (int16_t)(oled_clip.X0 - X) : 0;
+    iEnd   = (X + Width > oled_clip.X1 + 1) ? (int16_t)(oled_clip.X1 + 1 - X) : Width;
+    if (iStart >= iEnd) return;
+    if (y + Height - 1 < oled_clip.Y0 || y > oled_clip.Y1) return;
+    OLED_MarkDirtyArea(X, Y, Width, Height);
+
+    page  = (int16_t)(((y + 32768) >> 3) - 4096);
+    shift = (uint8_t)((y + 32768) & 0x07);
+    p    = (page < (oled_clip.Y0 >> 3)) ? (int16_t)(oled_clip.Y0 >> 3) : page;
+    pEnd = (int16_t)((y + Height - 1 + 32768) >> 3) - 4096;
+    if (pEnd > (oled_clip.Y1 >> 3)) pEnd = (int16_t)(oled_clip.Y1 >> 3);
+
+    for (; p <= pEnd; p++)
+    {
+        int32_t top = y - (int32_t)p * 8;
+        int32_t bot = top + Height - 1;
+        const uint8_t *img, *msk, *imgLo, *mskLo;
+        uint8_t hs = shift, ls = (uint8_t)(8 - shift);
+        uint8_t *dst = &OLED_TARGET_ROW(p)[X + iStart];
+
+        /*本页中属于精灵矩形且在裁剪区内的位*/
+        clip = (uint8_t)(0xFF << (top < 0 ? 0 : top));
+        if (bot < 7) clip &= (uint8_t)(0xFF >> (7 - bot));
+        clip &= OLED_ClipPageMask(p);
+        if (!clip) continue;
+
+        /*本页由取模第j页左移shift与第j-1页右移(8-shift)拼成，缺的一半移8位后为0*/
+        j = (uint8_t)(p - page);
+        img   = (j < rows) ? Sprite + (uint16_t)j * Width + iStart : NULL;
+        imgLo = (j > 0 && shift) ? Sprite + (uint16_t)(j - 1) * Width + iStart : NULL;
+        if (img == NULL) { img = imgLo; hs = 8; }
+        else if (imgLo == NULL && shift) { imgLo = img; ls = 8; }
+        msk   = mask + (img - Sprite);
+        mskLo = imgLo ? mask + (imgLo - Sprite) : NULL;
+        OLED_SpriteSpan(dst, img, msk, imgLo, mskLo, hs, ls, (int16_t)(iEnd - iStart), clip, Mode);
+    }
+}
+
+/*------------------------功能函数------------------------*/
+
+
+#if OLED_USE_DISPLAY_LIST
+/*----------------------显示列表(条带渲染)----------------------*/
+
+/**
+  * @brief 在显示列表末尾追加一条命令
+  * @param Cmd 命令码
+  * @param Arg 参数(按字节拷贝)，Size为0时可以为NULL
+  * @param Size 参数字节数
+  * @return 1：成功，0：列表已满，命令被丢弃
+  */
+static uint8_t OLED_ListPut(uint8_t Cmd, const void *Arg, uint16_t Size)
+{
+    if (oled_list_len + 1 + Size > OLED_LIST_SIZE)
+    {
+        oled_list_dropped++;
+        return 0;
+    }
+    oled_list_last = oled_list_len;
+    oled_list_buf[oled_list_len] = Cmd;
+    if (Size) memcpy(&oled_list_buf[oled_list_len + 1], Arg, Size);
+    oled_list_len = (uint16_t)(oled_list_len + 1 + Size);
+    oled_list_cmds++;
+    return 1;
+}
+
+/**
+  * @brief 判断纵向范围 [Y, Y+Height-1] 是否完全在当前裁剪区(重放时即当前条带)之外
+  * @note 重放时每条命令先做这一次判断，与条带不相交的命令不进入绘图函数
+  */
+static inline uint8_t OLED_ListRowsReject(int16_t Y, int32_t Height)
+{
+    return (uint8_t)((int32_t)Y + Height - 1 < oled_clip.Y0 || Y > oled_clip.Y1);
+}
+
+/**
+  * @brief 重放一条点阵命令，只遍历落在当前条带内的行
+  */
+static void OLED_ListDrawDots(const OLED_ListDots *Dots)
+{
+    OLED_RasterOp rop = OLED_ResolveRop(Dots->Operation);
+    int16_t y = Dots->Y;
+    uint8_t r, c, n;
+
+    for (r = 0; r < Dots->Rows; r++, y += 2)
+    {
+        if (y < oled_clip.Y0) continue;
+        if (y > oled_clip.Y1) break;
+        n = (r == Dots->Rows - 1) ? Dots->Last : Dots->Columns;
+        for (c = 0; c < n; c++) OLED_PutPixel((int16_t)(Dots->X + 2 * c), y, rop);
+    }
+}
 
-                if (Page + j + 1 >= 0 && Page + j + 1 < OLED_PAGES)//数组越界处理
+/**
+  * @brief 把整张显示列表重放到当前条带
+  * @note 调用前已把裁剪区设为条带、绘图模式设为列表开头的模式
+  */
+static void OLED_ListReplay(void)
+{
+    uint8_t *p = oled_list_buf;
+    uint8_t *end = oled_list_buf + oled_list_len;
+    OLED_ListDots dots;
+    OLED_ListShape shape;
+    OLED_ListText text;
+    OLED_ListFontText fontText;
+    OLED_ListFloat num;
+    OLED_ListImage image;
+    OLED_ListScaled scaled;
+
+    while (p < end)
+    {
+        switch (*p++)
+        {
+            case OLED_CMD_MODE:
+                oled_draw_mode = (OLED_DrawMode)*p++;
+                break;
+            case OLED_CMD_DOTS:
+                memcpy(&dots, p, sizeof(dots));
+                p += sizeof(dots);
+                OLED_ListDrawDots(&dots);
+                break;
+            case OLED_CMD_RECT:
+                memcpy(&shape, p, sizeof(shape));
+                p += sizeof(shape);
+                /*高度为0的空心矩形：下边画在 Y-1 行，与上边合占 Y-1、Y 两行*/
+                if (shape.Height == 0 && !shape.IsFilled) { if (OLED_ListRowsReject((int16_t)(shape.Y - 1), 2)) break; }
+                else if (OLED_ListRowsReject(shape.Y, shape.Height)) break;
+                OLED_DrawRectangle(shape.X, shape.Y, (uint8_t)shape.Width, (uint8_t)shape.Height, shape.IsFilled, shape.Operation);
+                break;
+            case OLED_CMD_RRECT:
+                memcpy(&shape, p, sizeof(shape));
+                p += sizeof(shape);
+                if (OLED_ListRowsReject(shape.Y, shape.Height)) break;
+                OLED_DrawRoundRect(shape.X, shape.Y, shape.Width, shape.Height, shape.Radius, shape.IsFilled, shape.Operation);
+                break;
+            case OLED_CMD_STRING:
+                memcpy(&text, p, sizeof(text));
+                p += sizeof(text);
+                if (!OLED_ListRowsReject(text.Y, (text.FontSize == OLED_8X16) ? 16 : 8))
+                {
+                    OLED_ShowString(text.X, text.Y, (char *)p, text.FontSize);
+                }
+                p += strlen((const char *)p) + 1;
+                break;
+            case OLED_CMD_TEXT:
+                memcpy(&fontText, p, sizeof(fontText));
+                p += sizeof(fontText);
+                if (!OLED_ListRowsReject(fontText.Y, fontText.Font->Height) ||
+                    (fontText.Font->Wide != NULL &&
+                     !OLED_ListRowsReject((int16_t)(fontText.Y + OLED_WideOffset(fontText.Font)), fontText.Font->Wide->Height)))
                 {
-                    OLED_DisplayBuf[Page + j + 1][X + i] |= ((uint8_t)Image[j * Width + i]) >> (8 - Shift);
+                    OLED_ShowText(fontText.X, fontText.Y, (const char *)p, fontText.Font);
                 }
+                p += strlen((const char *)p) + 1;
+                break;
+            case OLED_CMD_FLOAT:
+                memcpy(&num, p, sizeof(num));
+                p += sizeof(num);
+                if (OLED_ListRowsReject(num.Y, (num.FontSize == OLED_8X16) ? 16 : 8)) break;
+                OLED_ShowFloatNum(num.X, num.Y, num.Number, num.IntLength, num.FraLength, num.FontSize);
+                break;
+            case OLED_CMD_IMAGE:
+                memcpy(&image, p, sizeof(image));
+                p += sizeof(image);
+                /*取模最后一页的多余位也会写进显存，纵向按整页高度判断*/
+                if (OLED_ListRowsReject(image.Y, ((image.Height - 1) / 8 + 1) * 8)) break;
+                if (image.IsPacked) OLED_ShowImagePacked(image.X, image.Y, image.Width, image.Height, image.Image, image.IsMix);
+                else                OLED_ShowImage(image.X, image.Y, image.Width, image.Height, image.Image, image.IsMix);
+                break;
+            case OLED_CMD_SPRITE:
+                memcpy(&image, p, sizeof(image));
+                p += sizeof(image);
+                if (OLED_ListRowsReject(image.Y, image.Height)) break;
+                OLED_ShowSprite(image.X, image.Y, image.Width, image.Height, image.Image, image.IsMix);
+                break;
+            case OLED_CMD_SCALED:
+                memcpy(&scaled, p, sizeof(scaled));
+                p += sizeof(scaled);
+                if (OLED_ListRowsReject(scaled.Y, scaled.DstHeight)) break;
+                OLED_ShowImageScaled(scaled.X, scaled.Y, scaled.Width, scaled.Height, scaled.Image,
+                                     scaled.DstWidth, scaled.DstHeight, scaled.IsMix);
+                break;
+            case OLED_CMD_PUSH_CLIP:
+                memcpy(&shape, p, sizeof(shape));
+                p += sizeof(shape);
+                OLED_PushClip(shape.X, shape.Y, (uint8_t)shape.Width, (uint8_t)shape.Height);
+                break;
+            case OLED_CMD_POP_CLIP:
+                OLED_PopClip();
+                break;
+            case OLED_CMD_PATTERN:
+                memcpy(&shape, p, sizeof(shape));
+                p += sizeof(shape);
+                if (OLED_ListRowsReject(shape.Y, shape.Height)) break;
+                OLED_FillPattern(shape.X, shape.Y, (uint8_t)shape.Width, (uint8_t)shape.Height, shape.Radius, shape.Operation);
+                break;
+            default:
+                return;     // 不会发生：列表只由本节的函数写入
+        }
+    }
+}
+
+/**
+  * @brief 清空显示列表，开始记录新的一帧
+  * @return 无
+  * @note 相当于整屏显存模式下的 OLED_Clear；当前绘图模式作为列表开头的模式
+  */
+void OLED_ListBegin(void)
+{
+    oled_list_len = 0;
+    oled_list_cmds = 0;
+    oled_list_dropped = 0;
+    oled_list_clip_depth = 0;
+    oled_list_mode0 = oled_draw_mode;
+}
+
+/**
+  * @brief 按条带光栅化显示列表并发送到屏幕(阻塞，返回时整屏已发送完)
+  * @return 无
+  * @note 每个条带：清空条带缓冲 -> 以条带为最外层裁剪区重放整张列表 -> 发送条带的各页.
+  *       列表在发送后保留，之后记录的命令叠加在原有内容上(与整屏显存不清屏继续绘制的效果相同)，
+  *       直到下一次 OLED_ListBegin.
+  * @note 每个条带各算一次刷新(OLED_GetFlushStat 的统计与 OLED_SetFlushCallback 的回调均按条带)
+  */
+void OLED_ListRender(void)
+{
+    int16_t page0;
+    uint8_t pages, k;
+
+    for (page0 = 0; page0 < OLED_PAGES; page0 += OLED_STRIP_PAGES)
+    {
+        pages = (page0 + OLED_STRIP_PAGES > OLED_PAGES) ? (uint8_t)(OLED_PAGES - page0) : (uint8_t)OLED_STRIP_PAGES;
+
+        /*上一个条带发送完才能改写条带缓冲*/
+        OLED_WaitFlush();
+        oled_strip_page0 = page0;
+        OLED_Clear();
+
+        /*条带作为栈底的裁剪区，重放中的一切写入都落在条带缓冲内*/
+        oled_clip_depth = 0;
+        oled_clip.X0 = 0;
+        oled_clip.Y0 = (int16_t)(page0 * 8);
+        oled_clip.X1 = OLED_WIDTH - 1;
+        oled_clip.Y1 = (int16_t)((page0 + pages) * 8 - 1);
+        oled_draw_mode = oled_list_mode0;
+        OLED_ListReplay();
+
+        OLED_BeginFlush();
+        for (k = 0; k < pages; k++) OLED_QueueRun((uint8_t)(page0 + k), 0, OLED_WIDTH);
+        OLED_StartFlush();
+    }
+    OLED_WaitFlush();
+
+    /*重放结束时绘图模式已回到记录末尾的模式，可以继续记录*/
+    OLED_ResetClip();
+    OLED_ClearDirty();
+}
+
+/**
+  * @brief 读取显示列表统计
+  * @param Stat 输出：已用字节数、命令数、被丢弃的命令数
+  * @return 无
+  */
+void OLED_GetListStat(OLED_ListStat *Stat)
+{
+    Stat->Bytes    = oled_list_len;
+    Stat->Commands = oled_list_cmds;
+    Stat->Dropped  = oled_list_dropped;
+}
+
+/**
+  * @brief 记录：设置绘图模式(同时立即生效，之后记录的命令按新模式解析)
+  * @param mode 绘图模式: OLED_DRAWMODE_NORMAL 或 OLED_DRAWMODE_XOR
+  * @return 无
+  */
+void OLED_ListSetDrawMode(OLED_DrawMode mode)
+{
+    uint8_t m = (uint8_t)mode;
+
+    OLED_ListPut(OLED_CMD_MODE, &m, 1);
+    oled_draw_mode = mode;
+}
+
+/**
+  * @brief 记录：压入一个裁剪矩形，参数同 OLED_PushClip
+  * @return 1：成功，0：栈已满或列表已满，此时不要调用 OLED_ListPopClip
+  */
+uint8_t OLED_ListPushClip(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
+{
+    OLED_ListShape shape = {X, Y, Width, Height, 0, 0, 0};
+
+    if (oled_list_clip_depth >= OLED_CLIP_DEPTH) return 0;
+    if (!OLED_ListPut(OLED_CMD_PUSH_CLIP, &shape, sizeof(shape))) return 0;
+    oled_list_clip_depth++;
+    return 1;
+}
+
+/**
+  * @brief 记录：弹出最近一次压入的裁剪矩形
+  * @return 无
+  * @note 弹出只需1字节，放不下时之后的命令也都放不下，不会留在内层裁剪区里
+  */
+void OLED_ListPopClip(void)
+{
+    if (oled_list_clip_depth == 0) return;
+    OLED_ListPut(OLED_CMD_POP_CLIP, NULL, 0);
+    oled_list_clip_depth--;
+}
+
+/**
+  * @brief 记录：画一个点，参数同 OLED_DrawPoint
+  * @return 无
+  * @note 与上一条点阵命令横纵步长为2地接续时直接并入该命令，
+  *       逐点画出的整屏棋盘格只占一条命令(约9字节)
+  */
+void OLED_ListDrawPoint(int16_t X, int16_t Y, uint8_t operation)
+{
+    OLED_ListDots dots;
+    int16_t row;
+
+    if (oled_list_len && oled_list_buf[oled_list_last] == OLED_CMD_DOTS)
+    {
+        memcpy(&dots, &oled_list_buf[oled_list_last + 1], sizeof(dots));
+        row = (int16_t)(dots.Y + 2 * (dots.Rows - 1));
+        if (dots.Operation == operation)
+        {
+            if (Y == row && X == dots.X + 2 * dots.Last && dots.Last < ((dots.Rows == 1) ? 255 : dots.Columns))
+            {
+                /*接在当前行后面；还在第一行时行宽随之增长*/
+                dots.Last++;
+                if (dots.Rows == 1) dots.Columns = dots.Last;
+                memcpy(&oled_list_buf[oled_list_last + 1], &dots, sizeof(dots));
+                return;
+            }
+            if (Y == row + 2 && X == dots.X && dots.Last == dots.Columns && dots.Rows < 255)
+            {
+                /*上一行已满，开始新的一行*/
+                dots.Rows++;
+                dots.Last = 1;
+                memcpy(&oled_list_buf[oled_list_last + 1], &dots, sizeof(dots));
+                return;
             }
         }
     }
+
+    dots.X = X;
+    dots.Y = Y;
+    dots.Columns = dots.Rows = dots.Last = 1;
+    dots.Operation = operation;
+    OLED_ListPut(OLED_CMD_DOTS, &dots, sizeof(dots));
 }
 
-/*------------------------功能函数------------------------*/
+/**
+  * @brief 记录：画矩形，参数同 OLED_DrawRectangle
+  * @return 无
+  */
+void OLED_ListDrawRectangle(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t IsFilled, uint8_t operation)
+{
+    OLED_ListShape shape = {X, Y, Width, Height, 0, IsFilled, operation};
+    OLED_ListPut(OLED_CMD_RECT, &shape, sizeof(shape));
+}
+
+/**
+  * @brief 记录：画圆角矩形，参数同 OLED_DrawRoundRect
+  * @return 无
+  */
+void OLED_ListDrawRoundRect(int16_t X, int16_t Y, uint16_t Width, uint16_t Height, uint8_t Radius, uint8_t IsFilled, uint8_t operation)
+{
+    OLED_ListShape shape = {X, Y, Width, Height, Radius, IsFilled, operation};
+    OLED_ListPut(OLED_CMD_RRECT, &shape, sizeof(shape));
+}
+
+/**
+  * @brief 记录：抖动图案填充，参数同 OLED_FillPattern
+  * @return 无
+  * @note 整屏虚化只占一条命令，重放时在每个条带内按页字节运算
+  */
+void OLED_ListFillPattern(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t Level, uint8_t Op)
+{
+    OLED_ListShape shape = {X, Y, Width, Height, Level, 0, Op};
+    OLED_ListPut(OLED_CMD_PATTERN, &shape, sizeof(shape));
+}
+
+/**
+  * @brief 记录：显示字符串，参数同 OLED_ShowString
+  * @return 无
+  * @note 字符串被拷贝进列表，调用后可以立即修改或释放
+  */
+void OLED_ListShowString(int16_t X, int16_t Y, const char *String, uint8_t FontSize)
+{
+    OLED_ListText text = {X, Y, FontSize};
+    uint16_t len = (uint16_t)(strlen(String) + 1);
+
+    if (oled_list_len + 1 + sizeof(text) + len > OLED_LIST_SIZE)
+    {
+        oled_list_dropped++;
+        return;
+    }
+    OLED_ListPut(OLED_CMD_STRING, &text, sizeof(text));
+    memcpy(&oled_list_buf[oled_list_len], String, len);
+    oled_list_len = (uint16_t)(oled_list_len + len);
+}
+
+/**
+  * @brief 记录：按字体描述显示字符串，参数同 OLED_ShowText
+  * @return 无
+  * @note 字符串被拷贝进列表，字体描述只记录指针(须为常量)
+  */
+void OLED_ListShowText(int16_t X, int16_t Y, const char *String, const OLED_Font *Font)
+{
+    OLED_ListFontText text;
+    uint16_t len = (uint16_t)(strlen(String) + 1);
+
+    if (oled_list_len + 1 + sizeof(text) + len > OLED_LIST_SIZE)
+    {
+        oled_list_dropped++;
+        return;
+    }
+    text.X = X;
+    text.Y = Y;
+    text.Font = Font;
+    OLED_ListPut(OLED_CMD_TEXT, &text, sizeof(text));
+    memcpy(&oled_list_buf[oled_list_len], String, len);
+    oled_list_len = (uint16_t)(oled_list_len + len);
+}
+
+/**
+  * @brief 记录：显示浮点数，参数同 OLED_ShowFloatNum
+  * @return 无
+  */
+void OLED_ListShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize)
+{
+    OLED_ListFloat num;
+
+    num.Number = Number;
+    num.X = X;
+    num.Y = Y;
+    num.IntLength = IntLength;
+    num.FraLength = FraLength;
+    num.FontSize = FontSize;
+    OLED_ListPut(OLED_CMD_FLOAT, &num, sizeof(num));
+}
+
+/**
+  * @brief 记录：显示定点数，参数与返回值同 OLED_ShowFixedNum
+  * @note 记录时即完成格式化与对齐，列表中只保存结果字符串
+  */
+uint8_t OLED_ListShowFixedNum(int16_t X, int16_t Y, int32_t Value, uint8_t Scale, uint8_t FraLength, uint8_t Width, uint8_t Flags, uint8_t FontSize)
+{
+    char String[OLED_NUM_WIDTH_MAX + 2];
+    uint8_t len = OLED_FixedToString(String, Value, Scale, FraLength, Width, Flags);
+
+    if (len == 0) return 0;
+    if (Flags & OLED_NUM_RIGHT) X = (int16_t)(X - len * FontSize);
+    OLED_ListShowString(X, Y, String, FontSize);
+    return len;
+}
+
+/**
+  * @brief 记录格式化结果的Put：字符直接追加到列表末尾
+  * @note 为结尾的'\0'留出1字节，放不下时置Sink->X为1(溢出标记)并返回0
+  */
+static uint8_t OLED_FormatPutList(OLED_FormatSink *Sink, char Char)
+{
+    if (oled_list_len + 2 > OLED_LIST_SIZE) { Sink->X = 1; return 0; }
+    oled_list_buf[oled_list_len++] = (uint8_t)Char;
+    return 1;
+}
+
+/**
+  * @brief 记录：格式化字符串，参数同 OLED_Printf
+  * @return 无
+  * @note 记录时即完成格式化，字符由 OLED_Format 直接写进列表，不经过中间字符串；
+  *       列表放不下时整条命令撤销，计入丢弃数
+  */
+void OLED_ListPrintf(int16_t X, int16_t Y, uint8_t FontSize, const char *format, ...)
+{
+    OLED_ListText text = {X, Y, FontSize};
+    OLED_FormatSink sink;
+    uint16_t len0 = oled_list_len, last0 = oled_list_last;
+    va_list arg;
+
+    if (oled_list_len + 1 + sizeof(text) + 1 > OLED_LIST_SIZE)
+    {
+        oled_list_dropped++;
+        return;
+    }
+    OLED_ListPut(OLED_CMD_STRING, &text, sizeof(text));
+    sink.Put = OLED_FormatPutList;
+    sink.X = 0;
+
+    va_start(arg, format);
+    OLED_Format(&sink, format, arg);
+    va_end(arg);
+    oled_list_buf[oled_list_len++] = '\0';     // Put始终留有这1字节
+
+    if (sink.X)
+    {
+        /*没写完：撤销这条命令*/
+        oled_list_len = len0;
+        oled_list_last = last0;
+        oled_list_cmds--;
+        oled_list_dropped++;
+    }
+}
+
+/**
+  * @brief 记录：显示图像，参数同 OLED_ShowImage
+  * @return 无
+  * @note 只记录 Image 的地址，取模数组在重放(OLED_ListRender)时必须仍然有效
+  */
+void OLED_ListShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image, unsigned char IsMix)
+{
+    OLED_ListImage image = {Image, X, Y, Width, Height, IsMix, 0};
+    OLED_ListPut(OLED_CMD_IMAGE, &image, sizeof(image));
+}
+
+/**
+  * @brief 记录：显示PackBits压缩图像，参数同 OLED_ShowImagePacked
+  * @return 无
+  */
+void OLED_ListShowImagePacked(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Packed, unsigned char IsMix)
+{
+    OLED_ListImage image = {Packed, X, Y, Width, Height, IsMix, 1};
+    OLED_ListPut(OLED_CMD_IMAGE, &image, sizeof(image));
+}
+
+/**
+  * @brief 记录：显示带遮罩的精灵，参数同 OLED_ShowSprite
+  * @return 无
+  * @note 只记录精灵数据的地址，精灵数据须在 OLED_ListRender 返回前保持有效
+  */
+void OLED_ListShowSprite(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Sprite, unsigned char Mode)
+{
+    OLED_ListImage image = {Sprite, X, Y, Width, Height, Mode, 0};
+    OLED_ListPut(OLED_CMD_SPRITE, &image, sizeof(image));
+}
+
+/**
+  * @brief 记录：缩放显示图像，参数同 OLED_ShowImageScaled
+  * @return 无
+  * @note 只记录取模数组的地址，取模数组须在 OLED_ListRender 返回前保持有效
+  */
+void OLED_ListShowImageScaled(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image,
+                              uint8_t DstWidth, uint8_t DstHeight, unsigned char IsMix)
+{
+    OLED_ListScaled scaled = {Image, X, Y, Width, Height, DstWidth, DstHeight, IsMix};
+    OLED_ListPut(OLED_CMD_SCALED, &scaled, sizeof(scaled));
+}
+
+/*----------------------显示列表(条带渲染)----------------------*/
+#endif
 
 /************************ COPYRIGHT(C) 2026 WANG FANGZHUO **************************/
@@ -23,6 +23,7 @@ extern "C" {
 #include <stdarg.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
 
 /* Exported macros -----------------------------------------------------------*/
 
@@ -35,11 +36,89 @@ extern "C" {
 #define OLED_UNFILLED			(0)
 #define OLED_FILLED				(1)
 
+/*OLED_ShowImage的IsMix参数取值*/
+#define OLED_IMAGE_COPY         (0)     // 覆盖：图像矩形内未点亮的像素熄灭
+#define OLED_IMAGE_OR           (1)     // 叠加：只点亮图像中点亮的像素
+#define OLED_IMAGE_XOR          (2)     // 异或：图像中点亮的像素取反
+#define OLED_IMAGE_ANDNOT       (3)     // 擦除：图像中点亮的像素熄灭
+
+/*OLED_ShowSprite的Mode参数取值(精灵 = 图像平面 + 遮罩平面)*/
+#define OLED_SPRITE_MASK        (0)     // 遮罩内的像素换成图像：dst = (dst & ~mask) | (img & mask)
+#define OLED_SPRITE_XOR         (1)     // 遮罩内图像点亮的像素取反：dst ^= img & mask
+#define OLED_SPRITE_INVERT      (2)     // 遮罩内的像素换成反色图像：dst = (dst & ~mask) | (~img & mask)
+
+/*OLED_FillPattern的Level参数常用取值(8x8 Bayer有序抖动，点亮 Level/64 的像素)*/
+#define OLED_PATTERN_LEVELS     (64)
+#define OLED_PATTERN_1_4        (16)    // 偶数行的偶数列
+#define OLED_PATTERN_1_2        (32)    // 棋盘格
+#define OLED_PATTERN_3_4        (48)
+
+/*OLED_FillPattern的Op参数取值*/
+#define OLED_PATTERN_AND        (0)     // 只保留图案中的像素：整屏变暗、弹窗背景虚化
+#define OLED_PATTERN_OR         (1)     // 点亮图案中的像素：网纹底色、禁用项
+#define OLED_PATTERN_XOR        (2)     // 翻转图案中的像素
+
+/*OLED_ShowFixedNum的Flags参数，可按位或*/
+#define OLED_NUM_RIGHT          (0x01)  // 右对齐：X为数字右端(最后一个字符右边)的横坐标
+#define OLED_NUM_ZERO           (0x02)  // 整数部分前补0，使数字部分正好Width个字符
+#define OLED_NUM_FIT            (0x04)  // 超出Width个字符时逐位减少小数位，直到放得下
+#define OLED_NUM_PLUS           (0x08)  // 正数也显示+号
+
+/* OLED_DrawPolygon 支持的最大顶点数(决定填充时栈上边表的大小) */
+#define OLED_POLYGON_MAX_VERTICES   (16)
+
+/* 裁剪区栈深度(OLED_PushClip 最多嵌套的层数) */
+#define OLED_CLIP_DEPTH             (4)
+
 /* 屏幕尺寸参数 */
 #define OLED_WIDTH      (96)
 #define OLED_HEIGHT     (96)
 #define OLED_PAGES      (OLED_HEIGHT / 8)  // 12页
 
+/* 差分刷新游程合并阈值(字节)
+ * 每开始一个新游程要多发 0xB0/0x1x/0x0x 三个命令字节(各自一次CS)，再加一次数据帧的CS/DC切换，
+ * 约等于4个数据字节的总线时间，所以相同字节的间隔不超过此值时直接当作数据一起发送 */
+#define OLED_FLUSH_MERGE_GAP    (4)
+
+/* 下面的 OLED_USE_xxx 功能开关可以直接改本文件，也可以在编译选项里预定义(Keil：C/C++ -> Define；gcc：-D) */
+
+/* 传输后端选择
+ * 0：软件SPI(默认接线 D0=PB12 D1=PB13 RES=PB14 DC=PB15 CS=PA8)
+ * 1：硬件SPI2 + DMA1通道5异步发送，需改接线 D0(SCK)=PB13 D1(MOSI)=PB15 DC=PB12 RES=PB14 CS=PA8，
+ *    并在 DMA1_Channel5_IRQHandler 中调用 OLED_DMA_IRQHandler */
+#ifndef OLED_USE_HW_SPI_DMA
+#define OLED_USE_HW_SPI_DMA     (0)
+#endif
+
+/* 一帧刷新最多排队的游程数(不小于 OLED_PAGES)，排满时每页剩余脏区合并为一个游程 */
+#define OLED_FLUSH_MAX_RUNS     (48)
+
+/* 显示列表(条带渲染)模式
+ * 0：绘图函数直接写整屏显存 OLED_DisplayBuf，差分刷新靠屏幕镜像(两块共2304字节)
+ * 1：ArkUI的绘图宏只把绘图命令记录进显示列表，OLED_ListRender 按条带(每次 OLED_STRIP_PAGES 页)
+ *    清空条带缓冲 -> 重放整张列表 -> 发送这几页，不需要整屏显存与屏幕镜像；
+ *    代价是每帧把列表重放 OLED_PAGES/OLED_STRIP_PAGES 次，且每帧整屏发送 */
+#ifndef OLED_USE_DISPLAY_LIST
+#define OLED_USE_DISPLAY_LIST   (0)
+#endif
+
+/* 条带高度(页)，范围：1~OLED_PAGES，条带缓冲占 OLED_STRIP_PAGES*96 字节 */
+#ifndef OLED_STRIP_PAGES
+#define OLED_STRIP_PAGES        (2)
+#endif
+
+/* 显示列表缓冲大小(字节)，放不下的命令会被丢弃并计入 OLED_ListStat 的 Dropped */
+#define OLED_LIST_SIZE          (768)
+
+/* 硬件纵向滚动(显示起始行寄存器 0x40|line)
+ * 0：不使用，屏幕镜像只覆盖显示的12页
+ * 1：OLED_ScrollLines 只改显示起始行，GDDRAM中已有的内容随之整体移动；屏幕镜像扩大为整个GDDRAM
+ *    (16页，多用384字节，含显示窗口外的32行备用行)，刷新时按 逻辑行->物理行 的映射与镜像比较，
+ *    滚动后一般只有新露出的行和不随内容滚动的部分(光标/滚动条)需要发送；不能与显示列表模式同时使用 */
+#ifndef OLED_USE_HW_SCROLL
+#define OLED_USE_HW_SCROLL      (0)
+#endif
+
 /* Exported types ------------------------------------------------------------*/
 /*
 NORMAL模式
@@ -56,45 +135,121 @@ typedef enum {
     OLED_DRAWMODE_XOR       
 } OLED_DrawMode;
 
+/* 刷新统计(OLED_Update / OLED_UpdateDirty) */
+typedef struct {
+    uint16_t DataBytes;     // 最近一次刷新发送的数据字节数
+    uint16_t CmdBytes;      // 最近一次刷新发送的光标命令字节数
+    uint8_t  Runs;          // 最近一次刷新发送的游程数
+    uint32_t Frames;        // 累计刷新次数
+    uint32_t TotalBytes;    // 累计发送字节数(数据 + 命令)
+} OLED_FlushStat;
+
+/* OLED传输后端接口(软件SPI / 硬件SPI+DMA / 主机上的模拟后端)
+ * 刷新状态机只通过这四项访问硬件，OLED_SetTransport 可以换成任何实现 */
+typedef struct {
+    void    (*Init)(void);                                      // 初始化引脚与外设
+    void    (*WriteCommand)(uint8_t Command);                   // 阻塞发送一个命令字节
+    void    (*WriteData)(const uint8_t *Data, uint16_t Count);  // 发送一段数据，IsAsync为1时只启动传输
+    uint8_t IsAsync;                                            // 1：数据发送完成(CS已释放)后由后端调用 OLED_TransportComplete
+    /* 可选(NULL表示不支持)：在一个CS窗口内发送 命令头 + 数据 + 命令尾，用于整帧突发传输 */
+    void    (*WriteFrame)(const uint8_t *Head, uint8_t HeadCount,
+                          const uint8_t *Data, uint16_t Count,
+                          const uint8_t *Tail, uint8_t TailCount);
+} OLED_Transport;
+
+#if OLED_USE_DISPLAY_LIST
+/* 显示列表统计(OLED_GetListStat) */
+typedef struct {
+    uint16_t Bytes;         // 列表已用字节数
+    uint16_t Commands;      // 列表中的命令数(连续的点合并后算一条)
+    uint16_t Dropped;       // 列表满后被丢弃的命令数，OLED_ListBegin 时清零
+} OLED_ListStat;
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+
+#if OLED_USE_HW_SPI_DMA
+extern const OLED_Transport OLED_HWSPITransport;
+#else
+extern const OLED_Transport OLED_SoftSPITransport;
+#endif
+
 /* Exported function declarations --------------------------------------------*/
 
 //  初始化函数   /* 底层 OLED_WriteCommand  OLED_Clear */
 void OLED_Init(void);
 //  命令函数
 void OLED_InvertDisplay(uint8_t invert);
+void OLED_SetContrast(uint8_t contrast);
+uint8_t OLED_GetContrast(void);
+void OLED_FlushCommands(void);
 
 //  光标更新函数    /* 底层 OLED_WriteCommand */
 //void OLED_SetCursor(uint8_t Page, uint8_t X) 
 
 //  更新函数   /* 底层 OLED_SetCursor  OLED_WriteData  OLED_DisplayBuf */
+#if !OLED_USE_DISPLAY_LIST
 void OLED_Update(void);
 void OLED_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+void OLED_UpdateDirty(void);
+#endif
+#if OLED_USE_HW_SCROLL
+void OLED_ScrollLines(int16_t Lines);
+#endif
+void OLED_GetFlushStat(OLED_FlushStat *Stat);
+uint32_t OLED_GetDrawStamp(void);
+
+//  传输后端与异步刷新函数
+void OLED_SetTransport(const OLED_Transport *Transport);
+void OLED_TransportComplete(void);
+uint8_t OLED_IsFlushBusy(void);
+void OLED_WaitFlush(void);
+/* 异步后端(OLED_USE_HW_SPI_DMA)下，发送完成回调在 DMA1_Channel5 中断里执行，
+ * 下一段的 OLED_SetCursor 命令也在中断里发出；回调中不要调用 OLED_WaitFlush、OLED_Update 系列或 OLED_FlushCommands */
+void OLED_SetFlushCallback(void (*Callback)(void));
+#if OLED_USE_HW_SPI_DMA
+void OLED_DMA_IRQHandler(void);
+#endif
 
 //  显存控制函数  /* 底层 OLED_DisplayBuf */
 void OLED_Clear(void);
 void OLED_ClearArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
 void OLED_Reverse(void);
 void OLED_ReverseArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+void OLED_FillArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t Value);
+void OLED_FillPattern(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t Level, uint8_t Op);
+#if !OLED_USE_DISPLAY_LIST
+void OLED_ScrollRegion(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, int16_t Dy);
+#endif
 
 //设置显示模式函数
 void OLED_SetDrawMode(OLED_DrawMode mode);
 
-//  显示函数   /* 底层 OLED_ShowChar ---> OLED_DrawPoint ---> OLED_DisplayBuf */
+//  裁剪区函数   /* 所有绘图函数只改动裁剪区内的像素(OLED_Clear/OLED_Reverse 除外) */
+uint8_t OLED_PushClip(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+void OLED_PopClip(void);
+void OLED_ResetClip(void);
+
+//  显示函数   /* 底层 OLED_ShowChar ---> OLED_BlitGlyph ---> OLED_DisplayBuf */
 void OLED_DrawPoint(int16_t x, int16_t y, uint8_t operation);
 void OLED_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize);
 void OLED_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize);
+void OLED_ShowText(int16_t X, int16_t Y, const char *String, const OLED_Font *Font);/* OLED_FontGlyph/OLED_WideGlyph ---> OLED_BlitGlyph，支持比例字体与UTF-8中文 */
+uint16_t OLED_MeasureText(const char *String, const OLED_Font *Font);
 void OLED_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void OLED_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, uint8_t FontSize);
 void OLED_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void OLED_ShowBinNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void OLED_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize);
-void OLED_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...);
+uint8_t OLED_ShowFixedNum(int16_t X, int16_t Y, int32_t Value, uint8_t Scale, uint8_t FraLength, uint8_t Width, uint8_t Flags, uint8_t FontSize);/* 整数运算，不用浮点 */
+void OLED_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...);/* OLED_Format ---> OLED_BlitGlyph，不经过vsprintf */
 //------------------------------------------------------------------------------------------------------------------------
 //  绘图函数   /* 底层 OLED_DrawPoint ---> OLED_DisplayBuf */
 uint8_t OLED_GetPoint(int16_t X, int16_t Y);
 void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint8_t IncludeEndpoints, uint8_t operation);
 void OLED_DrawRectangle(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t IsFilled,uint8_t operation);
 void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint8_t IsFilled,uint8_t operation);
+void OLED_DrawPolygon(const int16_t *X, const int16_t *Y, uint8_t Count, uint8_t IsFilled, uint8_t operation);
 /*
 对于画圆相关的函数，我的 4 条硬性要求
 NORMAL 和 XOR 模式有不同表现（NORMAL 高效，XOR 不会缺边、不重复翻转）。
@@ -107,6 +262,32 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
 void OLED_DrawArc(int16_t X, int16_t Y, uint8_t Radius, int16_t StartAngle, int16_t EndAngle, uint8_t IsFilled,unsigned char operation);
 void OLED_DrawRoundRect(int16_t x, int16_t y, uint16_t width, uint16_t height, uint8_t radius, uint8_t isFilled,uint8_t operation);
 void OLED_ShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image,unsigned char IsMix);/*  OLED_DisplayBuf */
+void OLED_ShowImagePacked(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Packed, unsigned char IsMix);/* OLED_UnpackByte ---> OLED_DisplayBuf */
+void OLED_ShowImageScaled(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image, uint8_t DstWidth, uint8_t DstHeight, unsigned char IsMix);/*  OLED_DisplayBuf */
+void OLED_ShowSprite(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Sprite, unsigned char Mode);/* OLED_SpriteSpan ---> OLED_DisplayBuf */
+
+#if OLED_USE_DISPLAY_LIST
+//  显示列表函数   /* 记录 ---> OLED_ListRender ---> 逐条带重放上面的绘图函数 ---> 条带缓冲 ---> 屏幕 */
+void OLED_ListBegin(void);
+void OLED_ListRender(void);
+void OLED_GetListStat(OLED_ListStat *Stat);
+void OLED_ListSetDrawMode(OLED_DrawMode mode);
+uint8_t OLED_ListPushClip(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+void OLED_ListPopClip(void);
+void OLED_ListDrawPoint(int16_t X, int16_t Y, uint8_t operation);
+void OLED_ListDrawRectangle(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t IsFilled, uint8_t operation);
+void OLED_ListDrawRoundRect(int16_t X, int16_t Y, uint16_t Width, uint16_t Height, uint8_t Radius, uint8_t IsFilled, uint8_t operation);
+void OLED_ListFillPattern(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t Level, uint8_t Op);
+void OLED_ListShowString(int16_t X, int16_t Y, const char *String, uint8_t FontSize);
+void OLED_ListShowText(int16_t X, int16_t Y, const char *String, const OLED_Font *Font);
+void OLED_ListShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize);
+uint8_t OLED_ListShowFixedNum(int16_t X, int16_t Y, int32_t Value, uint8_t Scale, uint8_t FraLength, uint8_t Width, uint8_t Flags, uint8_t FontSize);
+void OLED_ListPrintf(int16_t X, int16_t Y, uint8_t FontSize, const char *format, ...);
+void OLED_ListShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image, unsigned char IsMix);
+void OLED_ListShowImagePacked(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Packed, unsigned char IsMix);
+void OLED_ListShowSprite(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Sprite, unsigned char Mode);
+void OLED_ListShowImageScaled(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image, uint8_t DstWidth, uint8_t DstHeight, unsigned char IsMix);
+#endif
 
 
 #ifdef __cplusplus
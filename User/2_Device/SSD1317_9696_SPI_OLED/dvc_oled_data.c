@@ -42,6 +42,8 @@
 
 /* Private variables ---------------------------------------------------------*/
 
+#if !OLED_USE_FONT_SUBSET   /* 字库子集见 dvc_oled_font_subset.c */
+
 /** 
  * @brief 8x16 像素 ASCII 字模数据.宽8像素，高16像素
  *
@@ -249,81 +251,216 @@ extern const unsigned char OLED_F6x8[][6] =
 };
 
 /** 
- * @brief UI初始化图像.宽96 高96
+ * @brief 8像素高比例字体(由 Tools/oled_propfont.py 从 OLED_F6x8 生成)，字模 422 字节 + 偏移/步进表 285 字节
  */
-extern const unsigned char Fonzo[]={
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xE0,0xE0,
-0xF0,0xF0,0xF8,0xF8,0xF8,0xF8,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFE,0xFC,0xFC,
-0xFC,0xFC,0xFC,0xFC,0xF8,0xF8,0xF8,0xF8,0xF0,0xF0,0xF0,0xF0,0xE0,0xE0,0xE0,0xC0,
-0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x80,0xC0,0xE0,0xF0,0xF8,0xFC,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFE,0xFC,0xF8,0xF0,0xE0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xF0,0xF8,
-0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xBF,0xDF,0xCF,0x4F,
-0x67,0x63,0x63,0x63,0x61,0x61,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x61,0x41,0xC1,0xC3,0xC3,0xC7,0xC7,0xCF,
-0x9F,0x9F,0xBF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF8,0xE0,0x80,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x1F,0x07,0x03,0x01,0x80,0xC1,0x61,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x60,0xC0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x80,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x01,0x01,0x30,0x21,0xC7,0x8F,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
-0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0x7F,0x0F,0x03,0x00,0x00,0x00,0x00,0xFC,0xDF,0x41,0x60,0x60,0x60,0x20,0x30,
-0x30,0x30,0x70,0x70,0x70,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x11,0x33,0xFE,0xF0,
-0x00,0x00,0x00,0xFC,0x67,0x61,0x60,0x20,0x20,0x30,0x30,0x30,0x30,0x70,0x70,0x70,
-0x10,0x10,0x10,0x10,0x10,0x30,0x30,0x31,0x37,0xFF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x07,0x1F,0xFF,0xFF,0xFF,
-0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0E,0x38,0x60,0xC0,0x80,0x80,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0x60,0x30,0x1C,0x07,0x01,
-0x00,0x80,0x00,0x07,0x1E,0x30,0x60,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x80,0x80,0xC0,0x60,0x30,0x1E,0x07,0x00,0x0F,0xFF,0xFF,0xFF,0x3F,
-0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xFE,0x87,0x01,0x01,0x1F,
-0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,
-0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x08,0x18,0x10,
-0x30,0x21,0x23,0x3E,0x1C,0x00,0x00,0x00,0x01,0x01,0x03,0x03,0x02,0x02,0x02,0x02,
-0x02,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x1F,0x07,0x0F,0xBC,
-0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x06,0x06,0x0C,
-0x0C,0x0F,0x1E,0x38,0xE0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0x40,0x40,0x60,0x60,
-0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x40,0x40,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0x3C,0x3F,0x31,0x18,0x18,0x0C,0x07,
-0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x06,0x0C,0x18,0x30,0x70,0x60,0xC0,0xC0,0x80,
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,
-0xC0,0x60,0x30,0x30,0x18,0x0E,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-0x03,0x03,0x03,0x02,0x06,0x06,0x04,0x0C,0x0C,0x0C,0x08,0x08,0x08,0x18,0x18,0x18,
-0x18,0x08,0x08,0x08,0x08,0x0C,0x0C,0x0C,0x04,0x06,0x06,0x06,0x07,0x01,0x01,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+extern const unsigned char OLED_FP8_Glyph[] = {
+0x00,0x00,0x2F,0x07,0x00,0x07,0x14,0x7F,0x14,0x7F,0x14,0x24,0x2A,0x7F,0x2A,0x12,
+0x23,0x13,0x08,0x64,0x62,0x36,0x49,0x55,0x22,0x50,0x07,0x1C,0x22,0x41,0x41,0x22,
+0x1C,0x14,0x08,0x3E,0x08,0x14,0x08,0x08,0x3E,0x08,0x08,0xA0,0x60,0x08,0x08,0x08,
+0x08,0x08,0x60,0x60,0x20,0x10,0x08,0x04,0x02,0x3E,0x51,0x49,0x45,0x3E,0x00,0x42,
+0x7F,0x40,0x00,0x42,0x61,0x51,0x49,0x46,0x21,0x41,0x45,0x4B,0x31,0x18,0x14,0x12,
+0x7F,0x10,0x27,0x45,0x45,0x45,0x39,0x3C,0x4A,0x49,0x49,0x30,0x01,0x71,0x09,0x05,
+0x03,0x36,0x49,0x49,0x49,0x36,0x06,0x49,0x49,0x29,0x1E,0x36,0x36,0x56,0x36,0x08,
+0x14,0x22,0x41,0x14,0x14,0x14,0x14,0x14,0x41,0x22,0x14,0x08,0x02,0x01,0x51,0x09,
+0x06,0x3E,0x49,0x55,0x59,0x2E,0x7C,0x12,0x11,0x12,0x7C,0x7F,0x49,0x49,0x49,0x36,
+0x3E,0x41,0x41,0x41,0x22,0x7F,0x41,0x41,0x22,0x1C,0x7F,0x49,0x49,0x49,0x41,0x7F,
+0x09,0x09,0x09,0x01,0x3E,0x41,0x49,0x49,0x7A,0x7F,0x08,0x08,0x08,0x7F,0x41,0x7F,
+0x41,0x20,0x40,0x41,0x3F,0x01,0x7F,0x08,0x14,0x22,0x41,0x7F,0x40,0x40,0x40,0x40,
+0x7F,0x02,0x0C,0x02,0x7F,0x7F,0x04,0x08,0x10,0x7F,0x3E,0x41,0x41,0x41,0x3E,0x7F,
+0x09,0x09,0x09,0x06,0x3E,0x41,0x51,0x21,0x5E,0x7F,0x09,0x19,0x29,0x46,0x46,0x49,
+0x49,0x49,0x31,0x01,0x01,0x7F,0x01,0x01,0x3F,0x40,0x40,0x40,0x3F,0x1F,0x20,0x40,
+0x20,0x1F,0x3F,0x40,0x38,0x40,0x3F,0x63,0x14,0x08,0x14,0x63,0x07,0x08,0x70,0x08,
+0x07,0x61,0x51,0x49,0x45,0x43,0x7F,0x41,0x41,0x02,0x04,0x08,0x10,0x20,0x41,0x41,
+0x7F,0x04,0x02,0x01,0x02,0x04,0x40,0x40,0x40,0x40,0x40,0x01,0x02,0x04,0x20,0x54,
+0x54,0x54,0x78,0x7F,0x48,0x44,0x44,0x38,0x38,0x44,0x44,0x44,0x20,0x38,0x44,0x44,
+0x48,0x7F,0x38,0x54,0x54,0x54,0x18,0x08,0x7E,0x09,0x01,0x02,0x18,0xA4,0xA4,0xA4,
+0x7C,0x7F,0x08,0x04,0x04,0x78,0x44,0x7D,0x40,0x40,0x80,0x84,0x7D,0x7F,0x10,0x28,
+0x44,0x41,0x7F,0x40,0x7C,0x04,0x18,0x04,0x78,0x7C,0x08,0x04,0x04,0x78,0x38,0x44,
+0x44,0x44,0x38,0xFC,0x24,0x24,0x24,0x18,0x18,0x24,0x24,0x18,0xFC,0x7C,0x08,0x04,
+0x04,0x08,0x48,0x54,0x54,0x54,0x20,0x04,0x3F,0x44,0x40,0x20,0x3C,0x40,0x40,0x20,
+0x7C,0x1C,0x20,0x40,0x20,0x1C,0x3C,0x40,0x30,0x40,0x3C,0x44,0x28,0x10,0x28,0x44,
+0x1C,0xA0,0xA0,0xA0,0x7C,0x44,0x64,0x54,0x4C,0x44,0x08,0x7F,0x41,0x7F,0x41,0x7F,
+0x08,0x08,0x04,0x08,0x10,0x08
+};
+extern const unsigned short OLED_FP8_Offset[] = {
+0,2,3,6,11,16,21,26,27,30,33,38,43,45,50,52,
+57,62,67,72,77,82,87,92,97,102,107,109,111,115,120,124,
+129,134,139,144,149,154,159,164,169,174,177,182,187,192,197,202,
+207,212,217,222,227,232,237,242,247,252,257,262,265,270,273,278,
+283,286,291,296,301,306,311,316,321,326,329,333,337,340,345,350,
+355,360,365,370,375,380,385,390,395,400,405,410,413,414,417
+};
+extern const unsigned char OLED_FP8_Advance[] = {
+3,2,4,6,6,6,6,2,4,4,6,6,3,6,3,6,
+6,6,6,6,6,6,6,6,6,6,3,3,5,6,5,6,
+6,6,6,6,6,6,6,6,6,4,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,4,6,4,6,6,
+4,6,6,6,6,6,6,6,6,4,5,5,4,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,4,2,4,6
+};
+
+/** 
+ * @brief 16像素高比例字体(由 Tools/oled_propfont.py 从 OLED_F8x16 生成)，字模 1176 字节 + 偏移/步进表 285 字节
+ */
+extern const unsigned char OLED_FP16_Glyph[] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x33,0x30,0x16,0x0E,0x00,0x16,0x0E,0x00,
+0x00,0x00,0x00,0x00,0x40,0xC0,0x78,0x40,0xC0,0x78,0x40,0x04,0x3F,0x04,0x04,0x3F,
+0x04,0x04,0x70,0x88,0xFC,0x08,0x30,0x18,0x20,0xFF,0x21,0x1E,0xF0,0x08,0xF0,0x00,
+0xE0,0x18,0x00,0x00,0x21,0x1C,0x03,0x1E,0x21,0x1E,0x00,0xF0,0x08,0x88,0x70,0x00,
+0x00,0x00,0x1E,0x21,0x23,0x24,0x19,0x27,0x21,0x10,0x16,0x0E,0x00,0x00,0xE0,0x18,
+0x04,0x02,0x07,0x18,0x20,0x40,0x02,0x04,0x18,0xE0,0x40,0x20,0x18,0x07,0x40,0x40,
+0x80,0xF0,0x80,0x40,0x40,0x02,0x02,0x01,0x0F,0x01,0x02,0x02,0x00,0x00,0x00,0xF0,
+0x00,0x00,0x00,0x01,0x01,0x01,0x1F,0x01,0x01,0x01,0x00,0x00,0xB0,0x70,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x30,0x30,
+0x00,0x00,0x00,0x80,0x60,0x18,0x04,0x60,0x18,0x06,0x01,0x00,0x00,0x00,0x00,0xE0,
+0x10,0x08,0x08,0x10,0xE0,0x00,0x0F,0x10,0x20,0x20,0x10,0x0F,0x00,0x10,0x10,0xF8,
+0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00,0x70,0x08,0x08,0x08,0x88,
+0x70,0x00,0x30,0x28,0x24,0x22,0x21,0x30,0x00,0x30,0x08,0x88,0x88,0x48,0x30,0x00,
+0x18,0x20,0x20,0x20,0x11,0x0E,0x00,0x00,0xC0,0x20,0x10,0xF8,0x00,0x00,0x07,0x04,
+0x24,0x24,0x3F,0x24,0x00,0xF8,0x08,0x88,0x88,0x08,0x08,0x00,0x19,0x21,0x20,0x20,
+0x11,0x0E,0x00,0xE0,0x10,0x88,0x88,0x18,0x00,0x00,0x0F,0x11,0x20,0x20,0x11,0x0E,
+0x00,0x38,0x08,0x08,0xC8,0x38,0x08,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x70,
+0x88,0x08,0x08,0x88,0x70,0x00,0x1C,0x22,0x21,0x21,0x22,0x1C,0x00,0xE0,0x10,0x08,
+0x08,0x10,0xE0,0x00,0x00,0x31,0x22,0x22,0x11,0x0F,0xC0,0xC0,0x30,0x30,0x00,0xC0,
+0xC0,0x80,0xB0,0x70,0x00,0x80,0x40,0x20,0x10,0x08,0x01,0x02,0x04,0x08,0x10,0x20,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x08,0x10,
+0x20,0x40,0x80,0x00,0x20,0x10,0x08,0x04,0x02,0x01,0x70,0x48,0x08,0x08,0x08,0xF0,
+0x00,0x00,0x30,0x36,0x01,0x00,0xC0,0x30,0xC8,0x28,0xE8,0x10,0xE0,0x07,0x18,0x27,
+0x24,0x23,0x14,0x0B,0x00,0x00,0xE0,0x38,0x1E,0xF0,0x00,0x00,0x30,0x0E,0x03,0x02,
+0x02,0x03,0x0F,0x78,0x80,0xFC,0x84,0xC6,0x46,0x7C,0x00,0x00,0x3F,0x20,0x21,0x21,
+0x13,0x1E,0xF0,0x1C,0x04,0x04,0x04,0x04,0x0C,0x08,0x0F,0x18,0x30,0x20,0x20,0x30,
+0x10,0x08,0xFC,0x02,0x06,0x0C,0x18,0xF0,0x3F,0x30,0x10,0x18,0x0C,0x07,0xFC,0x8C,
+0x84,0x84,0x04,0x04,0x7F,0x20,0x20,0x20,0x20,0x60,0xFC,0x84,0x84,0x84,0x04,0x3F,
+0x00,0x00,0x00,0x00,0xF0,0x0C,0x04,0x04,0x04,0x04,0x04,0x08,0x1F,0x30,0x20,0x40,
+0x40,0x41,0x71,0x7F,0xFE,0x80,0x80,0x80,0x80,0xFE,0x3F,0x00,0x00,0x00,0x00,0x3F,
+0x04,0x04,0xFC,0x04,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00,0x00,0x00,0xFE,0x1C,
+0x10,0x10,0x18,0x0F,0xFE,0x80,0xC0,0x30,0x18,0x0C,0x00,0x7F,0x03,0x06,0x0C,0x18,
+0x70,0x40,0xFE,0x00,0x00,0x00,0x00,0x00,0x3F,0x20,0x20,0x30,0x30,0x30,0x00,0xF8,
+0x78,0xC0,0xE0,0x1C,0xF0,0x00,0x0C,0x07,0x00,0x03,0x07,0x00,0x01,0x07,0x00,0x00,
+0xFC,0x0C,0x78,0x80,0x00,0xFC,0x20,0x1F,0x01,0x00,0x00,0x07,0x1C,0x3F,0xF8,0x04,
+0x06,0x02,0x02,0x06,0x38,0xE0,0x0F,0x18,0x10,0x10,0x10,0x18,0x0E,0x01,0xFC,0x04,
+0x04,0x84,0x84,0xE8,0x38,0x0F,0x39,0x01,0x01,0x00,0x00,0x00,0xF0,0x18,0x08,0x08,
+0x08,0xF8,0x00,0x0F,0x18,0x10,0x1B,0x0E,0x19,0x30,0xFC,0x84,0x84,0x84,0xC4,0x68,
+0x10,0x3F,0x01,0x03,0x06,0x1C,0x30,0x20,0x00,0x00,0xF0,0x18,0x08,0x08,0x0C,0x04,
+0x20,0x20,0x21,0x23,0x32,0x1E,0x00,0x00,0x02,0x02,0xC2,0x7E,0x02,0x02,0x02,0x00,
+0x00,0x3F,0x00,0x00,0x00,0x00,0x7C,0xC4,0x00,0x00,0x00,0x80,0xF8,0x00,0x0F,0x18,
+0x10,0x18,0x0F,0x00,0x3C,0xC0,0x00,0x00,0x00,0xE0,0x38,0x0C,0x00,0x01,0x0F,0x1C,
+0x07,0x01,0x00,0x00,0xFC,0x00,0x00,0xC0,0x00,0x00,0x00,0xFC,0x0F,0x18,0x10,0x0F,
+0x1C,0x10,0x10,0x0F,0x0C,0x38,0xC0,0x70,0x18,0x04,0x1C,0x07,0x01,0x03,0x0C,0x18,
+0x06,0x1C,0x70,0xE0,0x30,0x1E,0x02,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x04,0x04,
+0x04,0xC4,0x74,0x1C,0x04,0x04,0x04,0x06,0x07,0x04,0x04,0x04,0x04,0x04,0xFE,0x02,
+0x02,0x02,0x7F,0x40,0x40,0x40,0x0C,0x30,0xC0,0x00,0x00,0x00,0x00,0x00,0x01,0x06,
+0x38,0xC0,0x02,0x02,0x02,0xFE,0x40,0x40,0x40,0x7F,0x20,0x10,0x08,0x04,0x08,0x10,
+0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x02,0x04,0x08,0x00,0x00,0x00,0x00,0x80,
+0x80,0x80,0x80,0x00,0x00,0x19,0x24,0x22,0x22,0x22,0x3F,0x20,0x08,0xF8,0x00,0x80,
+0x80,0x00,0x00,0x00,0x3F,0x11,0x20,0x20,0x11,0x0E,0x00,0x00,0x80,0x80,0x80,0x00,
+0x0E,0x11,0x20,0x20,0x20,0x11,0x00,0x00,0x80,0x80,0x88,0xF8,0x00,0x0E,0x11,0x20,
+0x20,0x10,0x3F,0x20,0x00,0x80,0x80,0x80,0x80,0x00,0x1F,0x22,0x22,0x22,0x22,0x13,
+0x80,0x80,0xF0,0x88,0x88,0x88,0x18,0x20,0x20,0x3F,0x20,0x20,0x00,0x00,0x00,0x80,
+0x80,0x80,0x80,0x80,0x6B,0x94,0x94,0x94,0x93,0x60,0x08,0xF8,0x00,0x80,0x80,0x80,
+0x00,0x00,0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20,0x80,0x98,0x98,0x00,0x00,0x20,
+0x20,0x3F,0x20,0x20,0x00,0x00,0x80,0x98,0x98,0xC0,0x80,0x80,0x80,0x7F,0x08,0xF8,
+0x00,0x00,0x80,0x80,0x80,0x20,0x3F,0x24,0x02,0x2D,0x30,0x20,0x08,0x08,0xF8,0x00,
+0x00,0x20,0x20,0x3F,0x20,0x20,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x20,0x3F,
+0x20,0x00,0x3F,0x20,0x00,0x3F,0x80,0x80,0x00,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,
+0x00,0x20,0x3F,0x20,0x00,0x80,0x80,0x80,0x80,0x00,0x1F,0x20,0x20,0x20,0x20,0x1F,
+0x80,0x80,0x00,0x80,0x80,0x00,0x00,0x80,0xFF,0xA1,0x20,0x20,0x11,0x0E,0x00,0x00,
+0x80,0x80,0x80,0x80,0x00,0x0E,0x11,0x20,0x20,0xA0,0xFF,0x80,0x80,0x80,0x80,0x00,
+0x80,0x80,0x80,0x20,0x20,0x3F,0x21,0x20,0x00,0x01,0x00,0x80,0x80,0x80,0x80,0x80,
+0x33,0x24,0x24,0x24,0x24,0x19,0x80,0x80,0xE0,0x80,0x80,0x00,0x00,0x1F,0x20,0x20,
+0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x1F,0x20,0x20,0x20,0x10,0x3F,0x20,
+0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x01,0x0E,0x30,0x08,0x06,0x01,0x00,
+0x80,0x80,0x00,0x80,0x00,0x80,0x80,0x80,0x0F,0x30,0x0C,0x03,0x0C,0x30,0x0F,0x00,
+0x80,0x80,0x00,0x80,0x80,0x80,0x20,0x31,0x2E,0x0E,0x31,0x20,0x80,0x80,0x80,0x00,
+0x00,0x80,0x80,0x80,0x80,0x81,0x8E,0x70,0x18,0x06,0x01,0x00,0x80,0x80,0x80,0x80,
+0x80,0x80,0x21,0x30,0x2C,0x22,0x21,0x30,0x80,0x7C,0x02,0x02,0x00,0x3F,0x40,0x40,
+0xFF,0xFF,0x02,0x02,0x7C,0x80,0x40,0x40,0x3F,0x00,0x80,0x40,0x40,0x80,0x00,0x00,
+0x80,0x00,0x00,0x00,0x00,0x01,0x01,0x00
+};
+extern const unsigned short OLED_FP16_Offset[] = {
+0,6,10,20,34,44,58,74,78,86,94,108,122,126,140,144,
+158,172,186,200,214,228,242,256,270,284,298,302,308,320,334,346,
+358,372,388,402,418,430,442,452,468,480,490,500,514,526,542,558,
+574,588,602,616,632,646,660,676,692,704,718,734,742,754,762,776,
+792,798,812,826,838,852,864,878,890,906,916,926,940,950,966,980,
+992,1006,1020,1034,1046,1056,1072,1088,1104,1116,1132,1144,1152,1154,1162
+};
+extern const unsigned char OLED_FP16_Advance[] = {
+4,3,6,8,6,8,9,3,5,5,8,8,3,8,3,8,
+8,8,8,8,8,8,8,8,8,8,3,4,7,8,7,7,
+8,9,8,9,7,7,6,9,7,6,6,8,7,9,9,9,
+8,8,8,9,8,8,9,9,7,8,9,5,7,5,8,9,
+4,8,8,7,8,7,8,7,9,6,6,8,6,9,8,7,
+8,8,8,7,6,9,9,9,7,9,7,5,2,5,8
+};
+
+/** 
+ * @brief 12x12中文字形(由 Tools/oled_cjkfont.py 从 ArkUI CJK 12px 生成)，12 字，字模 288 字节 + 码点表 24 字节
+ * @note 字库 Tools/fonts/arkui_cjk12.bdf 是为本工程逐点画的菜单常用字，重新生成：
+ *       python Tools/oled_cjkfont.py --bdf Tools/fonts/arkui_cjk12.bdf --all --emit
+ *       需要更多的字时换用文泉驿点阵宋体 12px(wenquanyi_9pt.bdf)并用 --chars 指定，表外的字按'?'显示
+ */
+extern const unsigned short OLED_CJK12_Code[] = {
+0x4E0A,0x4E0B,0x4E2D,0x5173,0x5426,0x56DE,0x5F00,0x6587,0x662F,0x7F6E,0x8BBE,0x8FD4
+};
+extern const unsigned char OLED_CJK12_Glyph[][24] = {
+	{0x00,0x00,0x00,0x00,0x00,0xFF,0x08,0x08,0x08,0x08,0x08,0x00,0x04,0x04,0x04,0x04,0x04,0x07,0x04,0x04,0x04,0x04,0x04,0x04},// 上
+	{0x01,0x01,0x01,0x01,0x01,0xFF,0x09,0x11,0x21,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00},// 下
+	{0x7C,0x44,0x44,0x44,0x44,0xFF,0x44,0x44,0x44,0x44,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00},// 中
+	{0x20,0x24,0x25,0x26,0xA4,0x7C,0xA4,0x26,0x25,0x24,0x24,0x20,0x04,0x02,0x02,0x01,0x00,0x00,0x00,0x01,0x02,0x02,0x04,0x04},// 关
+	{0x21,0x11,0xD1,0x49,0x41,0x7D,0x47,0x49,0x49,0xD1,0x11,0x21,0x00,0x00,0x07,0x04,0x04,0x04,0x04,0x04,0x04,0x07,0x00,0x00},// 否
+	{0xFF,0x01,0x01,0xF9,0x89,0x89,0x89,0x89,0xF9,0x01,0x01,0xFF,0x07,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x07},// 回
+	{0x10,0x11,0x11,0xFF,0x11,0x11,0x11,0x11,0xFF,0x11,0x11,0x10,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00},// 开
+	{0x04,0x04,0x0C,0x14,0xA4,0x45,0x46,0xA4,0x14,0x0C,0x04,0x04,0x04,0x02,0x02,0x01,0x00,0x00,0x00,0x00,0x01,0x02,0x02,0x04},// 文
+	{0x40,0x40,0x5F,0x55,0x55,0xD5,0x55,0x55,0x55,0x5F,0x40,0x40,0x08,0x04,0x03,0x04,0x08,0x0F,0x09,0x09,0x09,0x09,0x08,0x08},// 是
+	{0xC0,0x17,0x15,0xD5,0x57,0x7D,0x55,0x57,0xD5,0x15,0x17,0x00,0x0F,0x08,0x08,0x0F,0x0D,0x0D,0x0D,0x0D,0x0F,0x08,0x08,0x08},// 置
+	{0x08,0xF9,0x02,0x00,0x28,0x67,0xA1,0x21,0xA7,0x68,0x08,0x08,0x00,0x07,0x02,0x01,0x04,0x04,0x02,0x01,0x02,0x04,0x04,0x00},// 设
+	{0x10,0x11,0xF2,0x00,0xFE,0x1A,0xAA,0x4A,0xA9,0x19,0x01,0x00,0x04,0x02,0x01,0x03,0x04,0x05,0x04,0x04,0x04,0x05,0x05,0x04},// 返
+};
+extern const OLED_WideFont OLED_CJK12 = {OLED_CJK12_Code, &OLED_CJK12_Glyph[0][0], 12, 12, 12};
+
+/** 
+ * @brief 字体描述，供 OLED_ShowText / OLED_MeasureText 使用，UTF-8中文按 OLED_CJK12 显示
+ */
+extern const OLED_Font OLED_Font6x8  = {&OLED_F6x8[0][0],  0, 0, 0, ' ', 95, 6, 8, 0, &OLED_CJK12};
+extern const OLED_Font OLED_Font8x16 = {&OLED_F8x16[0][0], 0, 0, 0, ' ', 95, 8, 16, 0, &OLED_CJK12};
+extern const OLED_Font OLED_FontP8   = {OLED_FP8_Glyph,  OLED_FP8_Offset,  OLED_FP8_Advance,  0, ' ', 95, 6, 8, 1, &OLED_CJK12};
+extern const OLED_Font OLED_FontP16  = {OLED_FP16_Glyph, OLED_FP16_Offset, OLED_FP16_Advance, 0, ' ', 95, 8, 16, 1, &OLED_CJK12};
+
+#endif /* !OLED_USE_FONT_SUBSET */
+
+/** 
+ * @brief UI初始化图像.宽96 高96，PackBits 压缩版本(由 Tools/oled_packbits.py 生成)，原始 1152 字节，压缩后 419 字节
+ */
+extern const unsigned char Fonzo_Packed[] = {
+0x86,0x00,0x06,0x80,0x80,0xC0,0xE0,0xE0,0xF0,0xF0,0xFD,0xF8,0xFA,0xFC,0x00,0xFE,
+0xFB,0xFC,0xFD,0xF8,0xFD,0xF0,0xFE,0xE0,0x02,0xC0,0xC0,0x80,0xD1,0x00,0x07,0x80,
+0xC0,0xE0,0xF0,0xF8,0xFC,0xFC,0xFE,0xF1,0xFF,0xF7,0x7F,0xF1,0xFF,0x05,0xFE,0xFC,
+0xF8,0xF0,0xE0,0x80,0xDF,0x00,0x04,0x80,0xC0,0xF0,0xF8,0xFC,0xF7,0xFF,0x05,0x7F,
+0xBF,0xDF,0xCF,0x4F,0x67,0xFE,0x63,0x01,0x61,0x61,0xFE,0x60,0xF3,0x00,0x0C,0x60,
+0x61,0x41,0xC1,0xC3,0xC3,0xC7,0xC7,0xCF,0x9F,0x9F,0xBF,0x7F,0xFA,0xFF,0x03,0xFE,
+0xF8,0xE0,0x80,0xE5,0x00,0x00,0x80,0xF8,0xFF,0x07,0x3F,0x1F,0x07,0x03,0x01,0x80,
+0xC1,0x61,0xF5,0x00,0x03,0x30,0x30,0x60,0xC0,0xF9,0x00,0x02,0x80,0x60,0x60,0xF7,
+0x00,0x06,0x01,0x01,0x30,0x21,0xC7,0x8F,0x3F,0xFB,0xFF,0x01,0xFC,0xC0,0xE8,0x00,
+0x00,0xFE,0xFB,0xFF,0x02,0x7F,0x0F,0x03,0xFD,0x00,0x02,0xFC,0xDF,0x41,0xFE,0x60,
+0x00,0x20,0xFE,0x30,0xFE,0x70,0xFA,0x10,0x03,0x11,0x33,0xFE,0xF0,0xFE,0x00,0x05,
+0xFC,0x67,0x61,0x60,0x20,0x20,0xFD,0x30,0xFE,0x70,0xFC,0x10,0x05,0x30,0x30,0x31,
+0x37,0xFF,0x7F,0xFB,0xFF,0xE8,0x00,0x02,0x01,0x07,0x1F,0xFE,0xFF,0x00,0x07,0xFA,
+0x00,0x06,0x03,0x0E,0x38,0x60,0xC0,0x80,0x80,0xF7,0x00,0x10,0x80,0xC0,0x60,0x30,
+0x1C,0x07,0x01,0x00,0x80,0x00,0x07,0x1E,0x30,0x60,0xC0,0x80,0x80,0xF8,0x00,0x08,
+0x80,0x80,0xC0,0x60,0x30,0x1E,0x07,0x00,0x0F,0xFE,0xFF,0x01,0x3F,0x01,0xE8,0x00,
+0x07,0x30,0xFE,0x87,0x01,0x01,0x1F,0xFF,0xC0,0xF5,0x00,0x03,0x01,0x01,0x03,0x03,
+0xFD,0x02,0x03,0x03,0x03,0x01,0x01,0xFE,0x00,0x07,0x08,0x18,0x10,0x30,0x21,0x23,
+0x3E,0x1C,0xFE,0x00,0x03,0x01,0x01,0x03,0x03,0xFC,0x02,0x03,0x03,0x03,0x01,0x01,
+0xFC,0x00,0x06,0x80,0xFF,0x1F,0x07,0x0F,0xBC,0xF0,0xE7,0x00,0x0A,0x01,0x03,0x06,
+0x06,0x0C,0x0C,0x0F,0x1E,0x38,0xE0,0xC0,0xEF,0x00,0x05,0x80,0x80,0xC0,0xC0,0x40,
+0x40,0xF8,0x60,0x03,0x40,0x40,0xC0,0xC0,0xF5,0x00,0x09,0x80,0xE0,0x3C,0x3F,0x31,
+0x18,0x18,0x0C,0x07,0x01,0xDD,0x00,0x0B,0x01,0x03,0x06,0x0C,0x18,0x30,0x70,0x60,
+0xC0,0xC0,0x80,0x80,0xFA,0x00,0x01,0x01,0x01,0xED,0x00,0x09,0x80,0x80,0xC0,0x60,
+0x30,0x30,0x18,0x0E,0x07,0x01,0xCA,0x00,0xFD,0x03,0x03,0x02,0x06,0x06,0x04,0xFE,
+0x0C,0xFE,0x08,0xFD,0x18,0xFD,0x08,0xFE,0x0C,0x00,0x04,0xFE,0x06,0x00,0x07,0xFE,
+0x01,0x81,0x00
 };
 
 /** 
@@ -480,6 +617,20 @@ extern const unsigned char icon_bar[]={
 0x00,0x00,0x00,0x00,0x07,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,
 };
 
+/** 
+ * @brief CatchBrick 砖块精灵.宽6 高8，每行先6字节图像平面(6x8字模)，后6字节遮罩平面(字模向外扩1像素)，
+ *        用 OLED_ShowSprite 显示时砖块带一圈暗色描边，顺序与 BrickType_t 一致：o $ W S ! + D
+ */
+extern const unsigned char sprite_Brick[][12] = {
+	{0x00,0x38,0x44,0x44,0x44,0x38, 0x7C,0xFE,0xFE,0xEE,0xFE,0xFE},// o
+	{0x00,0x24,0x2A,0x7F,0x2A,0x12, 0x7E,0x7F,0xFF,0xFF,0xFF,0x7F},// $
+	{0x00,0x3F,0x40,0x38,0x40,0x3F, 0x7F,0xFF,0xFF,0xFC,0xFF,0xFF},// W
+	{0x00,0x46,0x49,0x49,0x49,0x31, 0xEF,0xFF,0xFF,0xFF,0xFF,0xFF},// S
+	{0x00,0x00,0x00,0x2F,0x00,0x00, 0x00,0x00,0x7F,0x7F,0x7F,0x00},// !
+	{0x00,0x08,0x08,0x3E,0x08,0x08, 0x1C,0x1C,0x7F,0x7F,0x7F,0x1C},// +
+	{0x00,0x7F,0x41,0x41,0x22,0x1C, 0xFF,0xFF,0xFF,0xF7,0xFF,0x7F},// D
+};
+
 /*按照上面的格式，在这个位置加入新的图像数据*/
 //...
 
@@ -18,16 +18,69 @@ extern "C" {
 
 /* Exported macros -----------------------------------------------------------*/
 
+/**
+ * @brief 字库子集开关
+ * @note 1：字库改用 Tools/oled_fontsubset.py 生成的 dvc_oled_font_subset.c，只含源码字符串用到的字，
+ *          本文件中的完整字库不再编译；界面文字改动后要重新生成
+ *       0：使用完整字库
+ * @note 源码或字库改动后可用 python Tools/oled_fontsubset.py --check 检查子集是否过期(过期时返回1，
+ *       主机端测试的 make test 会先做这项检查)
+ */
+#ifndef OLED_USE_FONT_SUBSET
+#define OLED_USE_FONT_SUBSET    (0)
+#endif
+
 /* Exported types ------------------------------------------------------------*/
 
+/**
+ * @brief 非ASCII字形表(中文等)：码点升序排列，显示时二分查找
+ * @note 字形等宽，按页取模，每个字形 Width * 页数 字节，先存第0页的各列，再存第1页的各列
+ */
+typedef struct
+{
+    const unsigned short *Code;     // 各字形的Unicode码点，升序
+    const unsigned char *Glyphs;    // 字模
+    unsigned short Count;           // 字形个数
+    unsigned char Width;            // 字宽，也是步进宽度(像素)
+    unsigned char Height;           // 字高(像素)，不超过16
+} OLED_WideFont;
+
+/**
+ * @brief 字体描述：等宽字体只需Glyphs与Width；比例字体另给每个字形的偏移与步进宽度
+ * @note 字形宽度 = 步进宽度 - Spacing，16像素高的字形先存上半页的各列，再存下半页的各列(跨度为字形宽度)
+ * @note 字库子集只存用到的字形，由Map把字符序号映射到字形序号，查找仍是O(1)
+ */
+typedef struct
+{
+    const unsigned char *Glyphs;    // 字模
+    const unsigned short *Offset;   // 各字形在Glyphs中的偏移，0(空指针)表示等宽：偏移 = 序号 * Width * 页数
+    const unsigned char *Advance;   // 各字形的步进宽度(像素)，0(空指针)表示等宽：步进 = Width
+    const unsigned char *Map;       // 字符序号(Char - First)到字形序号的映射，0(空指针)表示字形按字符顺序全部存放
+    unsigned char First;            // 第一个字符的编码
+    unsigned char Count;            // 字符个数，范围外的字符按第一个字符(空格)显示
+    unsigned char Width;            // 等宽字体的字宽，比例字体的最大步进宽度
+    unsigned char Height;           // 字高(像素)，8或16
+    unsigned char Spacing;          // 比例字体字形右侧不存入字模的空列数
+    const OLED_WideFont *Wide;      // UTF-8多字节字符使用的字形表，0(空指针)表示只支持ASCII
+} OLED_Font;
+
 /* Exported variables --------------------------------------------------------*/
 
 //ASCII字模数据声明
 extern const unsigned char OLED_F8x16[][16];
 extern const unsigned char OLED_F6x8[][6];
 
+//字体描述：等宽 6x8/8x16，比例字体 P8/P16(由 Tools/oled_propfont.py 生成)
+extern const OLED_Font OLED_Font6x8;
+extern const OLED_Font OLED_Font8x16;
+extern const OLED_Font OLED_FontP8;
+extern const OLED_Font OLED_FontP16;
+
+//中文字形表(Tools/fonts/arkui_cjk12.bdf 的12个菜单常用字，由 Tools/oled_cjkfont.py 生成)，挂在上面各字体的Wide上
+extern const OLED_WideFont OLED_CJK12;
+
 //图像数据声明
-extern const unsigned char Fonzo[];
+extern const unsigned char Fonzo_Packed[];    // PackBits压缩，用 OLED_ShowImagePacked 显示
 extern const unsigned char icon_Key[];
 extern const unsigned char icon_Muscle[];
 extern const unsigned char icon_apple[];
@@ -39,6 +92,7 @@ extern const unsigned char icon_CatchBrick[];
 extern const unsigned char icon_Switch[];
 extern const unsigned char icon_param[];
 extern const unsigned char icon_bar[];
+extern const unsigned char sprite_Brick[][12];   // 带遮罩的精灵，用 OLED_ShowSprite 显示
 
 /*按照上面的格式，在这个位置加入新的图像数据声明*/
 //...
@@ -0,0 +1,331 @@
+/**
+ * @file dvc_oled_font_subset.c
+ * @author Wang Fangzhuo (WeChat: ncasjifa)
+ * @brief Ark OLED 字库子集(由 Tools/oled_fontsubset.py 从 dvc_oled_data.c 生成，请勿手改). 兼容 C/C++ 工程.
+ * @note OLED_USE_FONT_SUBSET 为1时代替 dvc_oled_data.c 中的完整字库；界面文字改动后重新运行
+ *       python Tools/oled_fontsubset.py --emit
+ * @version 1.0
+ * @copyright Wang Fangzhuo (c) 2026
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dvc_oled_data.h"
+
+#if OLED_USE_FONT_SUBSET
+
+/* Private variables ---------------------------------------------------------*/
+
+/**
+ * @brief 用到的ASCII字符(73个)： !%()*+-.0123456789:=?ABCDEFGHILMNOPRSTUVWXYZ[]_abcdefghiklmnoprstuvwxyz~
+ *        用到的中文(0个)：
+ * @note 各字库字节数(完整 -> 子集)：
+ *       font                   full   subset    saved
+ *       OLED_F8x16             1520     1168      352
+ *       OLED_F6x8               570      438      132
+ *       OLED_FP8                707      556      151
+ *       OLED_FP16              1461     1167      294
+ *       OLED_CJK12              312        0      312
+ *       OLED_Subset_Map                   95         
+ *       total                  4570     3424     1146
+ */
+
+/** 
+ * @brief 字符序号(Char - ' ')到子集字形序号的映射，各ASCII字体共用，没有的字映射到'?'
+ */
+extern const unsigned char OLED_Subset_Map[95] = {
+0,1,21,21,21,2,21,21,3,4,5,6,21,7,8,21,9,10,11,
+12,13,14,15,16,17,18,19,21,21,20,21,21,21,22,23,24,25,26,
+27,28,29,30,21,21,31,32,33,34,35,21,36,37,38,39,40,41,42,
+43,44,45,21,46,21,47,21,48,49,50,51,52,53,54,55,56,21,57,
+58,59,60,61,62,21,63,64,65,66,67,68,69,70,71,21,21,21,72
+};
+
+extern const unsigned char OLED_F8x16[][16] = 
+{
+	{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},//  
+	{0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x30,0x00,0x00,0x00},// !
+	{0xF0,0x08,0xF0,0x00,0xE0,0x18,0x00,0x00,0x00,0x21,0x1C,0x03,0x1E,0x21,0x1E,0x00},// %
+	{0x00,0x00,0x00,0xE0,0x18,0x04,0x02,0x00,0x00,0x00,0x00,0x07,0x18,0x20,0x40,0x00},// (
+	{0x00,0x02,0x04,0x18,0xE0,0x00,0x00,0x00,0x00,0x40,0x20,0x18,0x07,0x00,0x00,0x00},// )
+	{0x40,0x40,0x80,0xF0,0x80,0x40,0x40,0x00,0x02,0x02,0x01,0x0F,0x01,0x02,0x02,0x00},// *
+	{0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x1F,0x01,0x01,0x01,0x00},// +
+	{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01},// -
+	{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x00},// .
+	{0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x0F,0x10,0x20,0x20,0x10,0x0F,0x00},// 0
+	{0x00,0x10,0x10,0xF8,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},// 1
+	{0x00,0x70,0x08,0x08,0x08,0x88,0x70,0x00,0x00,0x30,0x28,0x24,0x22,0x21,0x30,0x00},// 2
+	{0x00,0x30,0x08,0x88,0x88,0x48,0x30,0x00,0x00,0x18,0x20,0x20,0x20,0x11,0x0E,0x00},// 3
+	{0x00,0x00,0xC0,0x20,0x10,0xF8,0x00,0x00,0x00,0x07,0x04,0x24,0x24,0x3F,0x24,0x00},// 4
+	{0x00,0xF8,0x08,0x88,0x88,0x08,0x08,0x00,0x00,0x19,0x21,0x20,0x20,0x11,0x0E,0x00},// 5
+	{0x00,0xE0,0x10,0x88,0x88,0x18,0x00,0x00,0x00,0x0F,0x11,0x20,0x20,0x11,0x0E,0x00},// 6
+	{0x00,0x38,0x08,0x08,0xC8,0x38,0x08,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00},// 7
+	{0x00,0x70,0x88,0x08,0x08,0x88,0x70,0x00,0x00,0x1C,0x22,0x21,0x21,0x22,0x1C,0x00},// 8
+	{0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x00,0x31,0x22,0x22,0x11,0x0F,0x00},// 9
+	{0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00},// :
+	{0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x00,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x00},// =
+	{0x00,0x70,0x48,0x08,0x08,0x08,0xF0,0x00,0x00,0x00,0x00,0x30,0x36,0x01,0x00,0x00},// ?
+	{0x00,0x00,0xE0,0x38,0x1E,0xF0,0x00,0x00,0x30,0x0E,0x03,0x02,0x02,0x03,0x0F,0x78},// A
+	{0x80,0xFC,0x84,0xC6,0x46,0x7C,0x00,0x00,0x00,0x3F,0x20,0x21,0x21,0x13,0x1E,0x00},// B
+	{0xF0,0x1C,0x04,0x04,0x04,0x04,0x0C,0x08,0x0F,0x18,0x30,0x20,0x20,0x30,0x10,0x08},// C
+	{0x00,0xFC,0x02,0x06,0x0C,0x18,0xF0,0x00,0x00,0x3F,0x30,0x10,0x18,0x0C,0x07,0x00},// D
+	{0x00,0xFC,0x8C,0x84,0x84,0x04,0x04,0x00,0x00,0x7F,0x20,0x20,0x20,0x20,0x60,0x00},// E
+	{0x00,0x00,0xFC,0x84,0x84,0x84,0x04,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00},// F
+	{0xF0,0x0C,0x04,0x04,0x04,0x04,0x04,0x08,0x1F,0x30,0x20,0x40,0x40,0x41,0x71,0x7F},// G
+	{0x00,0xFE,0x80,0x80,0x80,0x80,0xFE,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x3F,0x00},// H
+	{0x00,0x00,0x04,0x04,0xFC,0x04,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00},// I
+	{0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x20,0x20,0x30,0x30,0x30},// L
+	{0x00,0xF8,0x78,0xC0,0xE0,0x1C,0xF0,0x00,0x0C,0x07,0x00,0x03,0x07,0x00,0x01,0x07},// M
+	{0x00,0x00,0xFC,0x0C,0x78,0x80,0x00,0xFC,0x20,0x1F,0x01,0x00,0x00,0x07,0x1C,0x3F},// N
+	{0xF8,0x04,0x06,0x02,0x02,0x06,0x38,0xE0,0x0F,0x18,0x10,0x10,0x10,0x18,0x0E,0x01},// O
+	{0x00,0xFC,0x04,0x04,0x84,0x84,0xE8,0x38,0x00,0x0F,0x39,0x01,0x01,0x00,0x00,0x00},// P
+	{0x00,0xFC,0x84,0x84,0x84,0xC4,0x68,0x10,0x00,0x3F,0x01,0x03,0x06,0x1C,0x30,0x20},// R
+	{0x00,0x00,0xF0,0x18,0x08,0x08,0x0C,0x04,0x20,0x20,0x21,0x23,0x32,0x1E,0x00,0x00},// S
+	{0x00,0x02,0x02,0xC2,0x7E,0x02,0x02,0x02,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00},// T
+	{0x00,0x7C,0xC4,0x00,0x00,0x00,0x80,0xF8,0x00,0x00,0x0F,0x18,0x10,0x18,0x0F,0x00},// U
+	{0x3C,0xC0,0x00,0x00,0x00,0xE0,0x38,0x0C,0x00,0x01,0x0F,0x1C,0x07,0x01,0x00,0x00},// V
+	{0xFC,0x00,0x00,0xC0,0x00,0x00,0x00,0xFC,0x0F,0x18,0x10,0x0F,0x1C,0x10,0x10,0x0F},// W
+	{0x00,0x0C,0x38,0xC0,0x70,0x18,0x04,0x00,0x00,0x1C,0x07,0x01,0x03,0x0C,0x18,0x00},// X
+	{0x00,0x06,0x1C,0x70,0xE0,0x30,0x1E,0x02,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00},// Y
+	{0x04,0x04,0x04,0xC4,0x74,0x1C,0x04,0x04,0x04,0x06,0x07,0x04,0x04,0x04,0x04,0x04},// Z
+	{0x00,0x00,0x00,0xFE,0x02,0x02,0x02,0x00,0x00,0x00,0x00,0x7F,0x40,0x40,0x40,0x00},// [
+	{0x00,0x02,0x02,0x02,0xFE,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x7F,0x00,0x00,0x00},// ]
+	{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},// _
+	{0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x19,0x24,0x22,0x22,0x22,0x3F,0x20},// a
+	{0x08,0xF8,0x00,0x80,0x80,0x00,0x00,0x00,0x00,0x3F,0x11,0x20,0x20,0x11,0x0E,0x00},// b
+	{0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x0E,0x11,0x20,0x20,0x20,0x11,0x00},// c
+	{0x00,0x00,0x00,0x80,0x80,0x88,0xF8,0x00,0x00,0x0E,0x11,0x20,0x20,0x10,0x3F,0x20},// d
+	{0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x1F,0x22,0x22,0x22,0x22,0x13,0x00},// e
+	{0x00,0x80,0x80,0xF0,0x88,0x88,0x88,0x18,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},// f
+	{0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x6B,0x94,0x94,0x94,0x93,0x60,0x00},// g
+	{0x08,0xF8,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20},// h
+	{0x00,0x80,0x98,0x98,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},// i
+	{0x08,0xF8,0x00,0x00,0x80,0x80,0x80,0x00,0x20,0x3F,0x24,0x02,0x2D,0x30,0x20,0x00},// k
+	{0x00,0x08,0x08,0xF8,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},// l
+	{0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x20,0x3F,0x20,0x00,0x3F,0x20,0x00,0x3F},// m
+	{0x00,0x80,0x80,0x00,0x80,0x80,0x00,0x00,0x00,0x20,0x3F,0x21,0x00,0x20,0x3F,0x20},// n
+	{0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x1F,0x20,0x20,0x20,0x20,0x1F,0x00},// o
+	{0x80,0x80,0x00,0x80,0x80,0x00,0x00,0x00,0x80,0xFF,0xA1,0x20,0x20,0x11,0x0E,0x00},// p
+	{0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x20,0x20,0x3F,0x21,0x20,0x00,0x01,0x00},// r
+	{0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x33,0x24,0x24,0x24,0x24,0x19,0x00},// s
+	{0x00,0x80,0x80,0xE0,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x1F,0x20,0x20,0x00,0x00},// t
+	{0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x1F,0x20,0x20,0x20,0x10,0x3F,0x20},// u
+	{0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x01,0x0E,0x30,0x08,0x06,0x01,0x00},// v
+	{0x80,0x80,0x00,0x80,0x00,0x80,0x80,0x80,0x0F,0x30,0x0C,0x03,0x0C,0x30,0x0F,0x00},// w
+	{0x00,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x31,0x2E,0x0E,0x31,0x20,0x00},// x
+	{0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x80,0x81,0x8E,0x70,0x18,0x06,0x01,0x00},// y
+	{0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x21,0x30,0x2C,0x22,0x21,0x30,0x00},// z
+	{0x00,0x80,0x40,0x40,0x80,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00},// ~
+};
+
+extern const unsigned char OLED_F6x8[][6] = 
+{
+	{0x00,0x00,0x00,0x00,0x00,0x00},//  
+	{0x00,0x00,0x00,0x2F,0x00,0x00},// !
+	{0x00,0x23,0x13,0x08,0x64,0x62},// %
+	{0x00,0x00,0x1C,0x22,0x41,0x00},// (
+	{0x00,0x00,0x41,0x22,0x1C,0x00},// )
+	{0x00,0x14,0x08,0x3E,0x08,0x14},// *
+	{0x00,0x08,0x08,0x3E,0x08,0x08},// +
+	{0x00,0x08,0x08,0x08,0x08,0x08},// -
+	{0x00,0x00,0x60,0x60,0x00,0x00},// .
+	{0x00,0x3E,0x51,0x49,0x45,0x3E},// 0
+	{0x00,0x00,0x42,0x7F,0x40,0x00},// 1
+	{0x00,0x42,0x61,0x51,0x49,0x46},// 2
+	{0x00,0x21,0x41,0x45,0x4B,0x31},// 3
+	{0x00,0x18,0x14,0x12,0x7F,0x10},// 4
+	{0x00,0x27,0x45,0x45,0x45,0x39},// 5
+	{0x00,0x3C,0x4A,0x49,0x49,0x30},// 6
+	{0x00,0x01,0x71,0x09,0x05,0x03},// 7
+	{0x00,0x36,0x49,0x49,0x49,0x36},// 8
+	{0x00,0x06,0x49,0x49,0x29,0x1E},// 9
+	{0x00,0x00,0x36,0x36,0x00,0x00},// :
+	{0x00,0x14,0x14,0x14,0x14,0x14},// =
+	{0x00,0x02,0x01,0x51,0x09,0x06},// ?
+	{0x00,0x7C,0x12,0x11,0x12,0x7C},// A
+	{0x00,0x7F,0x49,0x49,0x49,0x36},// B
+	{0x00,0x3E,0x41,0x41,0x41,0x22},// C
+	{0x00,0x7F,0x41,0x41,0x22,0x1C},// D
+	{0x00,0x7F,0x49,0x49,0x49,0x41},// E
+	{0x00,0x7F,0x09,0x09,0x09,0x01},// F
+	{0x00,0x3E,0x41,0x49,0x49,0x7A},// G
+	{0x00,0x7F,0x08,0x08,0x08,0x7F},// H
+	{0x00,0x00,0x41,0x7F,0x41,0x00},// I
+	{0x00,0x7F,0x40,0x40,0x40,0x40},// L
+	{0x00,0x7F,0x02,0x0C,0x02,0x7F},// M
+	{0x00,0x7F,0x04,0x08,0x10,0x7F},// N
+	{0x00,0x3E,0x41,0x41,0x41,0x3E},// O
+	{0x00,0x7F,0x09,0x09,0x09,0x06},// P
+	{0x00,0x7F,0x09,0x19,0x29,0x46},// R
+	{0x00,0x46,0x49,0x49,0x49,0x31},// S
+	{0x00,0x01,0x01,0x7F,0x01,0x01},// T
+	{0x00,0x3F,0x40,0x40,0x40,0x3F},// U
+	{0x00,0x1F,0x20,0x40,0x20,0x1F},// V
+	{0x00,0x3F,0x40,0x38,0x40,0x3F},// W
+	{0x00,0x63,0x14,0x08,0x14,0x63},// X
+	{0x00,0x07,0x08,0x70,0x08,0x07},// Y
+	{0x00,0x61,0x51,0x49,0x45,0x43},// Z
+	{0x00,0x00,0x7F,0x41,0x41,0x00},// [
+	{0x00,0x00,0x41,0x41,0x7F,0x00},// ]
+	{0x00,0x40,0x40,0x40,0x40,0x40},// _
+	{0x00,0x20,0x54,0x54,0x54,0x78},// a
+	{0x00,0x7F,0x48,0x44,0x44,0x38},// b
+	{0x00,0x38,0x44,0x44,0x44,0x20},// c
+	{0x00,0x38,0x44,0x44,0x48,0x7F},// d
+	{0x00,0x38,0x54,0x54,0x54,0x18},// e
+	{0x00,0x08,0x7E,0x09,0x01,0x02},// f
+	{0x00,0x18,0xA4,0xA4,0xA4,0x7C},// g
+	{0x00,0x7F,0x08,0x04,0x04,0x78},// h
+	{0x00,0x00,0x44,0x7D,0x40,0x00},// i
+	{0x00,0x7F,0x10,0x28,0x44,0x00},// k
+	{0x00,0x00,0x41,0x7F,0x40,0x00},// l
+	{0x00,0x7C,0x04,0x18,0x04,0x78},// m
+	{0x00,0x7C,0x08,0x04,0x04,0x78},// n
+	{0x00,0x38,0x44,0x44,0x44,0x38},// o
+	{0x00,0xFC,0x24,0x24,0x24,0x18},// p
+	{0x00,0x7C,0x08,0x04,0x04,0x08},// r
+	{0x00,0x48,0x54,0x54,0x54,0x20},// s
+	{0x00,0x04,0x3F,0x44,0x40,0x20},// t
+	{0x00,0x3C,0x40,0x40,0x20,0x7C},// u
+	{0x00,0x1C,0x20,0x40,0x20,0x1C},// v
+	{0x00,0x3C,0x40,0x30,0x40,0x3C},// w
+	{0x00,0x44,0x28,0x10,0x28,0x44},// x
+	{0x00,0x1C,0xA0,0xA0,0xA0,0x7C},// y
+	{0x00,0x44,0x64,0x54,0x4C,0x44},// z
+	{0x00,0x08,0x04,0x08,0x10,0x08},// ~
+};
+
+extern const unsigned char OLED_FP8_Glyph[] = {
+0x00,0x00,0x2F,0x23,0x13,0x08,0x64,0x62,0x1C,0x22,0x41,0x41,0x22,0x1C,0x14,0x08,
+0x3E,0x08,0x14,0x08,0x08,0x3E,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x60,0x60,0x3E,
+0x51,0x49,0x45,0x3E,0x00,0x42,0x7F,0x40,0x00,0x42,0x61,0x51,0x49,0x46,0x21,0x41,
+0x45,0x4B,0x31,0x18,0x14,0x12,0x7F,0x10,0x27,0x45,0x45,0x45,0x39,0x3C,0x4A,0x49,
+0x49,0x30,0x01,0x71,0x09,0x05,0x03,0x36,0x49,0x49,0x49,0x36,0x06,0x49,0x49,0x29,
+0x1E,0x36,0x36,0x14,0x14,0x14,0x14,0x14,0x02,0x01,0x51,0x09,0x06,0x7C,0x12,0x11,
+0x12,0x7C,0x7F,0x49,0x49,0x49,0x36,0x3E,0x41,0x41,0x41,0x22,0x7F,0x41,0x41,0x22,
+0x1C,0x7F,0x49,0x49,0x49,0x41,0x7F,0x09,0x09,0x09,0x01,0x3E,0x41,0x49,0x49,0x7A,
+0x7F,0x08,0x08,0x08,0x7F,0x41,0x7F,0x41,0x7F,0x40,0x40,0x40,0x40,0x7F,0x02,0x0C,
+0x02,0x7F,0x7F,0x04,0x08,0x10,0x7F,0x3E,0x41,0x41,0x41,0x3E,0x7F,0x09,0x09,0x09,
+0x06,0x7F,0x09,0x19,0x29,0x46,0x46,0x49,0x49,0x49,0x31,0x01,0x01,0x7F,0x01,0x01,
+0x3F,0x40,0x40,0x40,0x3F,0x1F,0x20,0x40,0x20,0x1F,0x3F,0x40,0x38,0x40,0x3F,0x63,
+0x14,0x08,0x14,0x63,0x07,0x08,0x70,0x08,0x07,0x61,0x51,0x49,0x45,0x43,0x7F,0x41,
+0x41,0x41,0x41,0x7F,0x40,0x40,0x40,0x40,0x40,0x20,0x54,0x54,0x54,0x78,0x7F,0x48,
+0x44,0x44,0x38,0x38,0x44,0x44,0x44,0x20,0x38,0x44,0x44,0x48,0x7F,0x38,0x54,0x54,
+0x54,0x18,0x08,0x7E,0x09,0x01,0x02,0x18,0xA4,0xA4,0xA4,0x7C,0x7F,0x08,0x04,0x04,
+0x78,0x44,0x7D,0x40,0x7F,0x10,0x28,0x44,0x41,0x7F,0x40,0x7C,0x04,0x18,0x04,0x78,
+0x7C,0x08,0x04,0x04,0x78,0x38,0x44,0x44,0x44,0x38,0xFC,0x24,0x24,0x24,0x18,0x7C,
+0x08,0x04,0x04,0x08,0x48,0x54,0x54,0x54,0x20,0x04,0x3F,0x44,0x40,0x20,0x3C,0x40,
+0x40,0x20,0x7C,0x1C,0x20,0x40,0x20,0x1C,0x3C,0x40,0x30,0x40,0x3C,0x44,0x28,0x10,
+0x28,0x44,0x1C,0xA0,0xA0,0xA0,0x7C,0x44,0x64,0x54,0x4C,0x44,0x08,0x04,0x08,0x10,
+0x08
+};
+extern const unsigned short OLED_FP8_Offset[] = {
+0,2,3,8,11,14,19,24,29,31,36,41,46,51,56,61,
+66,71,76,81,83,88,93,98,103,108,113,118,123,128,133,136,
+141,146,151,156,161,166,171,176,181,186,191,196,201,206,209,212,
+217,222,227,232,237,242,247,252,257,260,264,267,272,277,282,287,
+292,297,302,307,312,317,322,327,332
+};
+extern const unsigned char OLED_FP8_Advance[] = {
+3,2,6,4,4,6,6,6,3,6,6,6,6,6,6,6,
+6,6,6,3,6,6,6,6,6,6,6,6,6,6,4,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,4,4,6,
+6,6,6,6,6,6,6,6,4,5,4,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6
+};
+
+extern const unsigned char OLED_FP16_Glyph[] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x33,0x30,0xF0,0x08,0xF0,0x00,0xE0,0x18,
+0x00,0x00,0x21,0x1C,0x03,0x1E,0x21,0x1E,0xE0,0x18,0x04,0x02,0x07,0x18,0x20,0x40,
+0x02,0x04,0x18,0xE0,0x40,0x20,0x18,0x07,0x40,0x40,0x80,0xF0,0x80,0x40,0x40,0x02,
+0x02,0x01,0x0F,0x01,0x02,0x02,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x01,0x01,0x01,
+0x1F,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,
+0x01,0x01,0x00,0x00,0x30,0x30,0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x0F,0x10,
+0x20,0x20,0x10,0x0F,0x00,0x10,0x10,0xF8,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,
+0x20,0x00,0x00,0x70,0x08,0x08,0x08,0x88,0x70,0x00,0x30,0x28,0x24,0x22,0x21,0x30,
+0x00,0x30,0x08,0x88,0x88,0x48,0x30,0x00,0x18,0x20,0x20,0x20,0x11,0x0E,0x00,0x00,
+0xC0,0x20,0x10,0xF8,0x00,0x00,0x07,0x04,0x24,0x24,0x3F,0x24,0x00,0xF8,0x08,0x88,
+0x88,0x08,0x08,0x00,0x19,0x21,0x20,0x20,0x11,0x0E,0x00,0xE0,0x10,0x88,0x88,0x18,
+0x00,0x00,0x0F,0x11,0x20,0x20,0x11,0x0E,0x00,0x38,0x08,0x08,0xC8,0x38,0x08,0x00,
+0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x70,0x88,0x08,0x08,0x88,0x70,0x00,0x1C,0x22,
+0x21,0x21,0x22,0x1C,0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x31,0x22,0x22,
+0x11,0x0F,0xC0,0xC0,0x30,0x30,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x04,0x04,0x04,
+0x04,0x04,0x04,0x04,0x70,0x48,0x08,0x08,0x08,0xF0,0x00,0x00,0x30,0x36,0x01,0x00,
+0x00,0x00,0xE0,0x38,0x1E,0xF0,0x00,0x00,0x30,0x0E,0x03,0x02,0x02,0x03,0x0F,0x78,
+0x80,0xFC,0x84,0xC6,0x46,0x7C,0x00,0x00,0x3F,0x20,0x21,0x21,0x13,0x1E,0xF0,0x1C,
+0x04,0x04,0x04,0x04,0x0C,0x08,0x0F,0x18,0x30,0x20,0x20,0x30,0x10,0x08,0xFC,0x02,
+0x06,0x0C,0x18,0xF0,0x3F,0x30,0x10,0x18,0x0C,0x07,0xFC,0x8C,0x84,0x84,0x04,0x04,
+0x7F,0x20,0x20,0x20,0x20,0x60,0xFC,0x84,0x84,0x84,0x04,0x3F,0x00,0x00,0x00,0x00,
+0xF0,0x0C,0x04,0x04,0x04,0x04,0x04,0x08,0x1F,0x30,0x20,0x40,0x40,0x41,0x71,0x7F,
+0xFE,0x80,0x80,0x80,0x80,0xFE,0x3F,0x00,0x00,0x00,0x00,0x3F,0x04,0x04,0xFC,0x04,
+0x00,0x20,0x20,0x3F,0x20,0x20,0xFE,0x00,0x00,0x00,0x00,0x00,0x3F,0x20,0x20,0x30,
+0x30,0x30,0x00,0xF8,0x78,0xC0,0xE0,0x1C,0xF0,0x00,0x0C,0x07,0x00,0x03,0x07,0x00,
+0x01,0x07,0x00,0x00,0xFC,0x0C,0x78,0x80,0x00,0xFC,0x20,0x1F,0x01,0x00,0x00,0x07,
+0x1C,0x3F,0xF8,0x04,0x06,0x02,0x02,0x06,0x38,0xE0,0x0F,0x18,0x10,0x10,0x10,0x18,
+0x0E,0x01,0xFC,0x04,0x04,0x84,0x84,0xE8,0x38,0x0F,0x39,0x01,0x01,0x00,0x00,0x00,
+0xFC,0x84,0x84,0x84,0xC4,0x68,0x10,0x3F,0x01,0x03,0x06,0x1C,0x30,0x20,0x00,0x00,
+0xF0,0x18,0x08,0x08,0x0C,0x04,0x20,0x20,0x21,0x23,0x32,0x1E,0x00,0x00,0x02,0x02,
+0xC2,0x7E,0x02,0x02,0x02,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x7C,0xC4,0x00,0x00,
+0x00,0x80,0xF8,0x00,0x0F,0x18,0x10,0x18,0x0F,0x00,0x3C,0xC0,0x00,0x00,0x00,0xE0,
+0x38,0x0C,0x00,0x01,0x0F,0x1C,0x07,0x01,0x00,0x00,0xFC,0x00,0x00,0xC0,0x00,0x00,
+0x00,0xFC,0x0F,0x18,0x10,0x0F,0x1C,0x10,0x10,0x0F,0x0C,0x38,0xC0,0x70,0x18,0x04,
+0x1C,0x07,0x01,0x03,0x0C,0x18,0x06,0x1C,0x70,0xE0,0x30,0x1E,0x02,0x00,0x00,0x00,
+0x3F,0x00,0x00,0x00,0x04,0x04,0x04,0xC4,0x74,0x1C,0x04,0x04,0x04,0x06,0x07,0x04,
+0x04,0x04,0x04,0x04,0xFE,0x02,0x02,0x02,0x7F,0x40,0x40,0x40,0x02,0x02,0x02,0xFE,
+0x40,0x40,0x40,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,
+0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x19,0x24,0x22,0x22,0x22,
+0x3F,0x20,0x08,0xF8,0x00,0x80,0x80,0x00,0x00,0x00,0x3F,0x11,0x20,0x20,0x11,0x0E,
+0x00,0x00,0x80,0x80,0x80,0x00,0x0E,0x11,0x20,0x20,0x20,0x11,0x00,0x00,0x80,0x80,
+0x88,0xF8,0x00,0x0E,0x11,0x20,0x20,0x10,0x3F,0x20,0x00,0x80,0x80,0x80,0x80,0x00,
+0x1F,0x22,0x22,0x22,0x22,0x13,0x80,0x80,0xF0,0x88,0x88,0x88,0x18,0x20,0x20,0x3F,
+0x20,0x20,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x6B,0x94,0x94,0x94,0x93,0x60,
+0x08,0xF8,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20,
+0x80,0x98,0x98,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x08,0xF8,0x00,0x00,0x80,0x80,
+0x80,0x20,0x3F,0x24,0x02,0x2D,0x30,0x20,0x08,0x08,0xF8,0x00,0x00,0x20,0x20,0x3F,
+0x20,0x20,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x20,0x3F,0x20,0x00,0x3F,0x20,
+0x00,0x3F,0x80,0x80,0x00,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,0x00,0x20,0x3F,0x20,
+0x00,0x80,0x80,0x80,0x80,0x00,0x1F,0x20,0x20,0x20,0x20,0x1F,0x80,0x80,0x00,0x80,
+0x80,0x00,0x00,0x80,0xFF,0xA1,0x20,0x20,0x11,0x0E,0x80,0x80,0x80,0x00,0x80,0x80,
+0x80,0x20,0x20,0x3F,0x21,0x20,0x00,0x01,0x00,0x80,0x80,0x80,0x80,0x80,0x33,0x24,
+0x24,0x24,0x24,0x19,0x80,0x80,0xE0,0x80,0x80,0x00,0x00,0x1F,0x20,0x20,0x80,0x80,
+0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x1F,0x20,0x20,0x20,0x10,0x3F,0x20,0x80,0x80,
+0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x01,0x0E,0x30,0x08,0x06,0x01,0x00,0x80,0x80,
+0x00,0x80,0x00,0x80,0x80,0x80,0x0F,0x30,0x0C,0x03,0x0C,0x30,0x0F,0x00,0x80,0x80,
+0x00,0x80,0x80,0x80,0x20,0x31,0x2E,0x0E,0x31,0x20,0x80,0x80,0x80,0x00,0x00,0x80,
+0x80,0x80,0x80,0x81,0x8E,0x70,0x18,0x06,0x01,0x00,0x80,0x80,0x80,0x80,0x80,0x80,
+0x21,0x30,0x2C,0x22,0x21,0x30,0x80,0x40,0x40,0x80,0x00,0x00,0x80,0x00,0x00,0x00,
+0x00,0x01,0x01,0x00
+};
+extern const unsigned short OLED_FP16_Offset[] = {
+0,6,10,24,32,40,54,68,82,86,100,114,128,142,156,170,
+184,198,212,226,230,244,256,272,286,302,314,326,336,352,364,374,
+386,402,418,434,448,462,478,492,506,522,538,550,564,580,588,596,
+612,626,640,652,666,678,692,704,720,730,744,754,770,784,796,810,
+824,836,846,862,878,894,906,922,934
+};
+extern const unsigned char OLED_FP16_Advance[] = {
+4,3,8,5,5,8,8,8,3,8,8,8,8,8,8,8,
+8,8,8,3,8,7,9,8,9,7,7,6,9,7,6,7,
+9,9,9,8,8,9,8,8,9,9,7,8,9,5,5,9,
+8,8,7,8,7,8,7,9,6,8,6,9,8,7,8,8,
+7,6,9,9,9,7,9,7,8
+};
+
+extern const unsigned short OLED_CJK12_Code[] = {
+0x0000
+};
+extern const unsigned char OLED_CJK12_Glyph[][24] = {
+	{0}
+};
+extern const OLED_WideFont OLED_CJK12 = {OLED_CJK12_Code, &OLED_CJK12_Glyph[0][0], 0, 12, 12};
+
+/** 
+ * @brief 字体描述，与 dvc_oled_data.c 中的相同，另加 OLED_Subset_Map
+ */
+extern const OLED_Font OLED_Font6x8  = {&OLED_F6x8[0][0],  0, 0, OLED_Subset_Map, ' ', 95, 6, 8, 0, &OLED_CJK12};
+extern const OLED_Font OLED_Font8x16 = {&OLED_F8x16[0][0], 0, 0, OLED_Subset_Map, ' ', 95, 8, 16, 0, &OLED_CJK12};
+extern const OLED_Font OLED_FontP8   = {OLED_FP8_Glyph,  OLED_FP8_Offset,  OLED_FP8_Advance,  OLED_Subset_Map, ' ', 95, 6, 8, 1, &OLED_CJK12};
+extern const OLED_Font OLED_FontP16  = {OLED_FP16_Glyph, OLED_FP16_Offset, OLED_FP16_Advance, OLED_Subset_Map, ' ', 95, 8, 16, 1, &OLED_CJK12};
+
+#endif /* OLED_USE_FONT_SUBSET */
+
+/************************ COPYRIGHT(C) 2026 WANG FANGZHUO **************************/
@@ -16,6 +16,8 @@
 
 /* Private macros ------------------------------------------------------------*/
 
+#define ITEM_VALUE_RIGHT        (SCREEN_WIDTH - SCROLL_BAR_WIDTH - FONT_WIDTH)  // 列表项右侧数值的右端(像素)
+
 /* Private types -------------------------------------------------------------*/
 
 /* Private variables ---------------------------------------------------------*/
@@ -72,6 +74,10 @@ Class_ArkUI_Cursor Cursor;
 /* Private function declarations ---------------------------------------------*/
 
 static void ArkUIDisplayItem(ArkUIItem_t *item);
+static int32_t ArkUIParamToFixed(paramType value, uint8_t scale);
+static void ArkUIDisplayItemsIn(ArkUIPage_t *page, int16_t x, int16_t y, int16_t width, int16_t height);
+static void ArkUIShiftListFrame(ArkUIPage_t *page, int16_t dy);
+static uint32_t ArkUIItemSig(const ArkUIItem_t *item, uint32_t sig);
 static void ArkUIGetItemPos(ArkUIPage_t *page, ArkUIItem_t *item, uint8_t index, uint8_t timer);
 static void ArkUIDrawIndicator(ArkUIPage_t *page, uint8_t index, uint8_t timer, uint8_t status);
 
@@ -93,7 +99,7 @@ void ArkUIInit(void)
     Cursor.Init();
 
     // Display the welcome photo and info
-    ArkUIDisplayBMP((SCREEN_WIDTH - WELOCOME_PICTURE_WIDTH) / 2, (SCREEN_HEIGHT - WELOCOME_PICTURE_HEIGHT) / 2, WELOCOME_PICTURE_WIDTH, WELOCOME_PICTURE_HEIGHT, Fonzo);
+    ArkUIDisplayPackedBMP((SCREEN_WIDTH - WELOCOME_PICTURE_WIDTH) / 2, (SCREEN_HEIGHT - WELOCOME_PICTURE_HEIGHT) / 2, WELOCOME_PICTURE_WIDTH, WELOCOME_PICTURE_HEIGHT, Fonzo_Packed);
     //根据屏幕宽度显示不同的文字
     if (2 * SCREEN_WIDTH / 3 > (25 * FONT_WIDTH + 1))
     {
@@ -122,10 +128,16 @@ void ArkUI(uint8_t timer)
     static uint8_t itemSum = 0; //当前页面的最大id
     static uint8_t lastLayer = 0xFF; //上一次所在层
     static uint8_t lastPageId = 0xFF; //上一次所在页面id
+    static ArkUIPage_t *listFramePage = NULL; //显存里留着的上一帧是哪个列表页的完整画面，NULL表示不能复用
+    static uint32_t listFrameStamp = 0; //画完上一帧列表时的显存写入计数
+    static uint32_t listFrameSig = 0; //上一帧列表各item的标题与数值签名
 
     //设置绘制模式为正常模式
     ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
 
+    //页面切换的对比度渐亮(随本帧一起发送)
+    ArkUIFadeInStep();
+
     //当层级变了或者页变了,需要同步index,展现出光标记忆效果
     if (lastLayer != layer || lastPageId != pageIndex[layer])
     {
@@ -141,6 +153,10 @@ void ArkUI(uint8_t timer)
         page = page->next;
     }
 
+    //上一帧能否平移复用只看到这里，这一帧画完列表后再重新记录
+    ArkUIPage_t *lastListPage = listFramePage;
+    listFramePage = NULL;
+
     //Quit UI to run function
     //If running function and hold the confirm button, quit the function
     if (functionIsRunning)
@@ -171,11 +187,10 @@ void ArkUI(uint8_t timer)
         return;
     }
 
-    ArkUIClearBuffer();
-
     // Custom page--------------------------------------------------------------------------------
     if (page->funcType == PAGE_CUSTOM)
     {
+        ArkUIClearBuffer();
         page->Event(page);
 
         // Clear the states of key to monitor next key action
@@ -203,13 +218,48 @@ void ArkUI(uint8_t timer)
     // -------------------------------------------------------------------------------------------
 
     // List page----------------------------------------------------------------------------------
+    //先算出这一帧每个item的位置：屏幕内的item都移动了同样的行数时就是整页滚动
+    int16_t scrollDy = 0;
+    bool scrollUniform = true, scrollFirst = true;
+    uint32_t sig = 2166136261u;
     for (ArkUIItem_t *item = page->itemHead; item != NULL; item = item->next)
     {
+        int16_t lastPos = item->position;
         ArkUIGetItemPos(page, item, index, timer);
-        ArkUIDisplayItem(item);
+        sig = ArkUIItemSig(item, sig);
+
+        if ((lastPos > -ITEM_HEIGHT && lastPos < SCREEN_HEIGHT) ||
+            (item->position > -ITEM_HEIGHT && item->position < SCREEN_HEIGHT))
+        {
+            if (scrollFirst) { scrollDy = item->position - lastPos; scrollFirst = false; }
+            else if (item->position - lastPos != scrollDy) scrollUniform = false;
+        }
+    }
+    if (!scrollUniform) scrollDy = 0;
+
+    //平移复用的前提：显存里是这一页的上一帧，之后没有别的地方(中断、其他任务)在显存上画过，item的标题和数值也都没变
+    if (ARKUI_LIST_SHIFT_SCROLL && scrollDy != 0 && lastListPage == page &&
+        ArkUIDrawStamp() == listFrameStamp && sig == listFrameSig &&
+        scrollDy > -SCREEN_HEIGHT && scrollDy < SCREEN_HEIGHT)
+    {
+        //整页滚动且显存里是这一页的上一帧：平移上一帧，只画新露出的行
+        ArkUIShiftListFrame(page, scrollDy);
     }
+    else
+    {
+        ArkUIClearBuffer();
+        for (ArkUIItem_t *item = page->itemHead; item != NULL; item = item->next)
+        {
+            ArkUIDisplayItem(item);
+        }
+    }
+    //整页滚动时让屏幕硬件滚动，刷新时基本只需发送新露出的行
+    if (scrollDy != 0) ArkUIScrollLines(-scrollDy);
     // Draw indicator and scroll bar
     ArkUIDrawIndicator(page, index, timer, 0);
+    listFramePage = page;
+    listFrameStamp = ArkUIDrawStamp();
+    listFrameSig = sig;
 
     // Operation move reaction
     itemSum = page->itemTail->id;
@@ -237,6 +287,7 @@ void ArkUI(uint8_t timer)
             }
 
             ArkUIItemOperationResponse(page, item, &index);
+            listFramePage = NULL;   //响应里可能画了消息框或换了页面
             break;
         }
     }
@@ -265,6 +316,7 @@ void ArkUI(uint8_t timer)
             itemTmp->position = 0;
             itemTmp->posForCal = 0;
         }
+        listFramePage = NULL;
         ArkUITransitionAnim();
     }
     // -------------------------------------------------------------------------------------------
@@ -320,6 +372,7 @@ void ArkUIKeyActionMonitor(void)
  * @param func 项目的功能类型，用于指定项目的行为
  * @param args 指向ArkUIItemArgs_t结构体的指针，用于指定项目的参数
  * @note 定义参数的时候自觉点，无符整型就别让初值等于小数或则和负数；有符整型同理
+ * @note 标题宽度在这里按 ARKUI_FONT 量好保存，之后修改标题内容要重新赋值 item->titleWidth
  */
 void ArkUIAddItem(ArkUIPage_t *page, ArkUIItem_t *item, char *_title,ArkUIItem_e func, const ArkUIItemArgs_t *args)
 {
@@ -328,6 +381,7 @@ void ArkUIAddItem(ArkUIPage_t *page, ArkUIItem_t *item, char *_title,ArkUIItem_e
 
     /* 1) 基本字段 */
     item->title   = _title;
+    item->titleWidth = ArkUIMeasureText(_title);
     item->funcType = func;
     item->next = NULL;
 
@@ -507,6 +561,90 @@ void ArkUIItemOperationResponse(ArkUIPage_t *page, ArkUIItem_t *item, uint8_t *i
     }
 }
 
+/**
+ * @brief 内部函数，只在给定矩形内重画与它相交的item
+ * @param page ArkUI页面指针
+ * @param x y width height 重画的矩形(作为裁剪区，矩形外的像素不动)
+ */
+static void ArkUIDisplayItemsIn(ArkUIPage_t *page, int16_t x, int16_t y, int16_t width, int16_t height)
+{
+    if (width <= 0 || height <= 0) return;
+    if (!ArkUIPushClip(x, y, width, height)) return;
+
+    for (ArkUIItem_t *item = page->itemHead; item != NULL; item = item->next)
+    {
+        //item的内容(含复选框)在 [position - ITEM_HEIGHT, position + ITEM_HEIGHT) 之内
+        if (item->position - ITEM_HEIGHT < y + height && item->position + ITEM_HEIGHT > y)
+            ArkUIDisplayItem(item);
+    }
+    ArkUIPopClip();
+}
+
+/**
+ * @brief 内部函数，列表整页滚动时复用上一帧：擦掉光标和滚动条，平移item内容，只重画新露出的行
+ * @param page ArkUI页面指针
+ * @param dy 这一帧item移动的行数，正数下移，负数上移，绝对值小于屏幕高度
+ * @note 只能在显存里是同一列表页上一帧完整画面、且item的标题和数值都没变时调用(见ArkUI中的判断)，
+ *       平移过来的行不重画
+ */
+static void ArkUIShiftListFrame(ArkUIPage_t *page, int16_t dy)
+{
+    const int16_t trackX = SCREEN_WIDTH - SCROLL_BAR_WIDTH;
+    int16_t bandH = (dy < 0) ? -dy : dy;                        //新露出的行数
+    int16_t bandY = (dy < 0) ? SCREEN_HEIGHT - bandH : 0;
+
+    //光标是异或画的，原样再画一次就擦掉了；滚动条整列清掉
+    Cursor.Erase_Cursor();
+    ArkUIScrollRegion(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, dy);
+    ArkUIDrawBox(trackX, 0, SCROLL_BAR_WIDTH, SCREEN_HEIGHT, 0);
+
+    //新露出的行整行重画；滚动条那一列的其余行也补画(标题过长时会伸进这一列)
+    ArkUIDisplayItemsIn(page, 0, bandY, SCREEN_WIDTH, bandH);
+    ArkUIDisplayItemsIn(page, trackX, (dy < 0) ? 0 : bandH, SCROLL_BAR_WIDTH, SCREEN_HEIGHT - bandH);
+}
+
+/**
+ * @brief 内部函数，把item的标题和显示的数值(开关状态、参数值)累加进签名(FNV-1a)
+ * @param item ArkUI Item指针
+ * @param sig 之前的签名
+ * @return 新的签名，两帧签名不同说明有item的显示内容变了
+ */
+static uint32_t ArkUIItemSig(const ArkUIItem_t *item, uint32_t sig)
+{
+    const uint8_t *p;
+    uint8_t n;
+
+    for (p = (const uint8_t *)item->title; p != NULL && *p != 0; p++)
+        sig = (sig ^ *p) * 16777619u;
+    if (item->flag != NULL)
+        sig = (sig ^ (uint8_t)*item->flag) * 16777619u;
+    if (item->param != NULL)
+    {
+        p = (const uint8_t *)item->param;
+        for (n = 0; n < sizeof(paramType); n++)
+            sig = (sig ^ p[n]) * 16777619u;
+    }
+    return sig;
+}
+
+/**
+ * @brief 内部函数,把参数值换算成保留scale位小数的定点数(四舍五入，十进制恰好一半时远离0)，供ArkUIDisplayNum显示
+ * @param value 参数值
+ * @param scale 小数位数
+ * @return 定点数，超出int32范围时取边界值
+ * @note 1.2345这类值的二进制略小于一半，乘10后也可能变得略小，按1e-14的相对误差补偿
+ */
+static int32_t ArkUIParamToFixed(paramType value, uint8_t scale)
+{
+    while (scale--)
+        value *= 10;
+    if (value >= 2147483647.0)
+        return INT32_MAX;
+    if (value <= -2147483647.0)
+        return -INT32_MAX;
+    return (int32_t)(value < 0 ? value - 0.5 + value * 1e-14 : value + 0.5 + value * 1e-14);
+}
+
 /**
  * @brief 内部函数,显示一个ArkUI Item
  * @param item 指向ArkUIItem_t结构体的指针，用于指定要显示的项
@@ -514,6 +652,10 @@ void ArkUIItemOperationResponse(ArkUIPage_t *page, ArkUIItem_t *item, uint8_t *i
  */
 static void ArkUIDisplayItem(ArkUIItem_t *item)
 {
+    int32_t value;
+    uint8_t shown = 1;
+    uint8_t fra;
+
     switch (item->funcType)
     {
     case ITEM_JUMP_PAGE:
@@ -542,101 +684,48 @@ static void ArkUIDisplayItem(ArkUIItem_t *item)
     case ITEM_PROGRESS_BAR:
         ArkUIDisplayStr(2, item->position, "-");
         ArkUIDisplayStr(5 + FONT_WIDTH, item->position, item->title);
-        if(*item->param < 10 && *item->param > 0){
-            ArkUIDisplayFloat(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 7*FONT_WIDTH, item->position,
-                               *item->param, 3, 2);
-						ArkUISetDrawColor(OLED_DRAWMODE_XOR);
-						ArkUIDisplayStr(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 7*FONT_WIDTH,item->position,"+");
-						ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
-						ArkUIDisplayStr(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 2*FONT_WIDTH,item->position,"%");
-        }else if(*item->param < 100 && *item->param >= 10){
-            ArkUIDisplayFloat(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 8*FONT_WIDTH, item->position,
-                               *item->param, 4, 2);
-						ArkUISetDrawColor(OLED_DRAWMODE_XOR);
-						ArkUIDisplayStr(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 8*FONT_WIDTH,item->position,"+");
-						ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
-						ArkUIDisplayStr(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 2*FONT_WIDTH,item->position,"%");
-        }else if(*item->param == 100){
-						ArkUIDisplayStr(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 5*FONT_WIDTH,item->position,"100%");
-				}else if(*item->param == 0){
-						ArkUIDisplayStr(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 3*FONT_WIDTH,item->position,"0%");
-				}else{// Hide because it's < 0 or > 100
-						ArkUIDisplayStr(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"***");
-				}
+        if (*item->param >= 0 && *item->param <= 100)
+        {
+            // 百分数保留两位小数，0%和100%不显示小数
+            value = ArkUIParamToFixed(*item->param, 2);
+            ArkUIDisplayNum(ITEM_VALUE_RIGHT - FONT_WIDTH, item->position, value, 2, (value % 10000) ? 2 : 0, 0, ARKUI_NUM_RIGHT);
+            ArkUIDisplayStr(ITEM_VALUE_RIGHT - FONT_WIDTH, item->position, "%");
+        }
+        else// Hide because it's < 0 or > 100
+        {
+            ArkUIDisplayStr(ITEM_VALUE_RIGHT - 3 * FONT_WIDTH, item->position, "***");
+        }
         break;
     case ITEM_CHANGE_VALUE:
         ArkUIDisplayStr(2, item->position, "-");
         ArkUIDisplayStr(5 + FONT_WIDTH, item->position, item->title);
-		
-			if(item->Event == &ArkUIEventChangeUint || item->Event == &ArkUIEventChangeUint_Cursor){
-                if(*item->param < 10 && *item->param >= 0){
-                    ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 2*FONT_WIDTH,item->position,"%d",(unsigned int)(*item->param));
-                }else if(*item->param < 100 && *item->param >= 10){
-                    ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 3*FONT_WIDTH,item->position,"%d",(unsigned int)(*item->param));
-                }else if(*item->param < 1000 && *item->param >= 100){
-                    ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"%d",(unsigned int)(*item->param));
-                }else if(*item->param < 10000 && *item->param >= 1000){
-                    ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 5*FONT_WIDTH,item->position,"%d",(unsigned int)(*item->param));
-                }else if(*item->param >= 10000){// Hide because it's too long
-                    ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"...");
-                }else{// Hide because it's < 0
-                    ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"***");
-                }
-			}else if(item->Event == &ArkUIEventChangeInt){
-                if(*item->param >= 0){
-                    if(*item->param < 10 && *item->param >= 0){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 2*FONT_WIDTH,item->position,"%d",(int)(*item->param));
-                    }else if(*item->param < 100 && *item->param >= 10){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 3*FONT_WIDTH,item->position,"%d",(int)(*item->param));
-                    }else if(*item->param < 1000 && *item->param >= 100){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"%d",(int)(*item->param));
-                    }else if(*item->param < 10000 && *item->param >= 1000){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 5*FONT_WIDTH,item->position,"%d",(int)(*item->param));
-                    }else if(*item->param >= 10000){// Hide because it's too long
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"...");
-                    }
-                }else{
-                    if(*item->param > -10 && *item->param <= 0){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 3*FONT_WIDTH,item->position,"%d",(int)(*item->param));
-                    }else if(*item->param > -100 && *item->param <= -10){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"%d",(int)(*item->param));
-                    }else if(*item->param > -1000 && *item->param <= -100){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 5*FONT_WIDTH,item->position,"%d",(int)(*item->param));
-                    }else if(*item->param > -10000 && *item->param <= -1000){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 6*FONT_WIDTH,item->position,"%d",(int)(*item->param));
-                    }else if(*item->param <= -10000){// Hide because it's too long
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"...");
-                    }
-                }
-			}else if(item->Event == &ArkUIEventChangeFloat){
-                if(*item->param > 0){
-                    if(*item->param >= 10000){// Hide because it's too long
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"...");
-                    }else if(*item->param < 10 && *item->param > 0){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 6*FONT_WIDTH,item->position,"%.3f",*item->param);
-                    }else if(*item->param < 100 && *item->param >= 10){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 6*FONT_WIDTH,item->position,"%.2f",*item->param);
-                    }else if(*item->param < 1000 && *item->param >= 100){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 6*FONT_WIDTH,item->position,"%.1f",*item->param);
-                    }else if(*item->param < 10000 && *item->param >= 1000){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 5*FONT_WIDTH,item->position,"%.0f",*item->param);
-                    }
-                }else if(*item->param < 0){
-                    if(*item->param <= -10000){// Hide because it's too long
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 4*FONT_WIDTH,item->position,"...");
-                    }else if(*item->param > -10 && *item->param < 0){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 7*FONT_WIDTH,item->position,"%.3f",*item->param);
-                    }else if(*item->param > -100 && *item->param <= -10){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 7*FONT_WIDTH,item->position,"%.2f",*item->param);
-                    }else if(*item->param > -1000 && *item->param <= -100){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 7*FONT_WIDTH,item->position,"%.1f",*item->param);
-                    }else if(*item->param > -10000 && *item->param <= -1000){
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 6*FONT_WIDTH,item->position,"%.0f",*item->param);
-                    }
-                }else{
-                        ArkUIPrintf(SCREEN_WIDTH - SCROLL_BAR_WIDTH - 2*FONT_WIDTH,item->position,"0");
-                }
-			}
+
+        if ((item->Event == &ArkUIEventChangeUint || item->Event == &ArkUIEventChangeUint_Cursor) && *item->param < 0)
+        {
+            ArkUIDisplayStr(ITEM_VALUE_RIGHT - 3 * FONT_WIDTH, item->position, "***");// Hide because it's < 0
+        }
+        else if (item->Event == &ArkUIEventChangeUint || item->Event == &ArkUIEventChangeUint_Cursor ||
+                 item->Event == &ArkUIEventChangeInt)
+        {
+            // 整数最多4位(不含负号)，右对齐
+            shown = ArkUIDisplayNum(ITEM_VALUE_RIGHT, item->position, ArkUIParamToFixed(*item->param, 0), 0, 0, 4, ARKUI_NUM_RIGHT);
+        }
+        else if (item->Event == &ArkUIEventChangeFloat)
+        {
+            // 小数最多占5个字符(不含负号)，整数部分越长小数位越少：1.234 12.35 123.5 1235
+            // 每种小数位数都从参数值直接舍入(ARKUI_NUM_FIT 在已舍入的值上再舍入，12.3449 会显示成 12.35)；0只显示"0"
+            for (fra = (*item->param == 0) ? 0 : 3; ; fra--)
+            {
+                shown = ArkUIDisplayNum(ITEM_VALUE_RIGHT, item->position, ArkUIParamToFixed(*item->param, fra), fra, fra, 5,
+                                        ARKUI_NUM_RIGHT);
+                if (shown || fra == 0)
+                    break;
+            }
+        }
+        if (!shown)// Hide because it's too long
+        {
+            ArkUIDisplayStr(ITEM_VALUE_RIGHT - 3 * FONT_WIDTH, item->position, "...");
+        }
         break;
     default:
         ArkUIDisplayStr(2, item->position, "-");
@@ -702,7 +791,15 @@ static void ArkUIGetItemPos(ArkUIPage_t *page, ArkUIItem_t *item, uint8_t index,
     {
         item->posForCal = target;
     }        
-    item->position = (int16_t) item->posForCal;//posForCal就是浮点数版本的position，前面用浮点数算来防止每次步进取整抖动
+    //posForCal就是浮点数版本的position，前面用浮点数算来防止每次步进取整抖动
+#if ARKUI_LIST_FLOOR_POS
+    //向下取整(而不是向零取整)，屏幕上方负坐标的item与其它item每帧移动的行数一致，整页滚动时可以平移上一帧、硬件滚动；
+    //加一点余量吸收浮点累加误差(25.9999与2.0应同样算作整数)
+    item->position = (int16_t) floorf(item->posForCal + 0.001f);
+#else
+    //不平移上一帧也不硬件滚动时保持向零取整，列表的显示与原来逐帧相同
+    item->position = (int16_t) item->posForCal;
+#endif
 
     lastIndex = index;
 
@@ -739,9 +836,9 @@ void ArkUIDrawCursor(ArkUIPage_t *page, uint8_t index, uint8_t timer)
     if ((int)nowCursor.w == 0 && page->itemHead != NULL)
     {
         if (page->itemHead->funcType == ITEM_PAGE_DESCRIPTION)
-            Cursor.Set_Now(0,SCREEN_HEIGHT,(float)(strlen(page->itemHead->title)) * FONT_WIDTH + 5,0,1);
+            Cursor.Set_Now(0,SCREEN_HEIGHT,(float)page->itemHead->titleWidth + 5,0,1);
         else
-            Cursor.Set_Now(0,SCREEN_HEIGHT,(float)(strlen(page->itemHead->title) + 1) * FONT_WIDTH + 8,0,1);
+            Cursor.Set_Now(0,SCREEN_HEIGHT,(float)(page->itemHead->titleWidth + FONT_WIDTH) + 8,0,1);
         nowCursor = Cursor.Get_Now_Cursor();
     }
 
@@ -751,9 +848,9 @@ void ArkUIDrawCursor(ArkUIPage_t *page, uint8_t index, uint8_t timer)
         if (index == itemTmp->id)
         {
             if (itemTmp->funcType == ITEM_PAGE_DESCRIPTION)
-                tw = (uint16_t)(strlen(itemTmp->title)) * FONT_WIDTH + 5;
+                tw = itemTmp->titleWidth + 5;
             else
-                tw = (uint16_t)(strlen(itemTmp->title) + 1) * FONT_WIDTH + 8;
+                tw = itemTmp->titleWidth + FONT_WIDTH + 8;
 
             ty = (uint16_t)(itemTmp->lineId * ITEM_HEIGHT);
 
@@ -75,6 +75,7 @@ typedef struct ArkUI_item
     int16_t position;         // 菜单项位置
     float step;               // 每帧移动的步长（像素）
     char *title;              // 菜单项的标题
+    uint16_t titleWidth;      // 标题显示宽度(像素)，ArkUIAddItem 时用 ArkUIMeasureText 算好，绘制时不再逐帧 strlen
 
     void (*Event)(struct ArkUI_item *item);  // item触发的事件回调函数指针
 
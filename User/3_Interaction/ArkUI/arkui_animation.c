@@ -16,85 +16,80 @@
 
 /* Private variables ---------------------------------------------------------*/
 
+static uint8_t fadeContrast = 0;    // 渐变前的对比度，渐亮的目标
+static uint8_t fadeInStep = 0;      // 0：没有进行中的渐亮；n：渐亮的第n个tick
+
 /* Private function declarations ---------------------------------------------*/
 
 /* Function definitions -------------------------------------------------------*/
 
 /**
- * @brief 屏幕渐变消失至0,阻塞函数
+ * @brief 屏幕渐变消失至0,阻塞函数,过渡方式由 TRANSITION_STYLE 配置
  */
 void ArkUITransitionAnim()
 {
-    for (int j = 1; j < SCREEN_HEIGHT + 1; j += 2)
-    {
-        for (int i = 0; i < SCREEN_WIDTH + 1; i += 2)
-        {
-            ArkUIDrawDot(i, j, 0);
-        }
-    }
-    ArkUIDelay_ms(TRANSITION_TIME / 4);
-    ArkUISendBuffer();
-    for (int j = 1; j < SCREEN_HEIGHT + 1; j += 2)
+    ArkUITransitionAnimEx(TRANSITION_STYLE);
+}
+
+/**
+ * @brief 以指定方式执行页面切换过渡动画,阻塞函数
+ * @param style ARKUI_TRANSITION_DISSOLVE：抖动图案分4次熄灭，共发送4帧显存；
+ *              ARKUI_TRANSITION_FADE：在 TRANSITION_TIME/2 内把对比度分级降到0，每级只发2个命令字节，
+ *              返回时屏幕保持最暗，之后新页面以最暗发送一帧，再由 ArkUIFadeInStep 逐帧恢复亮度
+ */
+void ArkUITransitionAnimEx(ArkUITransition_e style)
+{
+    if (style == ARKUI_TRANSITION_FADE)
     {
-        for (int i = 1; i < SCREEN_WIDTH + 1; i += 2)
+        // 上一次渐亮还没结束时沿用原来的目标亮度，不把半亮当成目标
+        if (fadeInStep == 0) fadeContrast = ArkUIGetContrast();
+        for (int i = TRANSITION_FADE_STEPS - 1; i >= 0; i--)
         {
-            ArkUIDrawDot(i, j, 0);
+            ArkUISetContrast((uint8_t)(fadeContrast * i / TRANSITION_FADE_STEPS));
+            ArkUISendCommands();
+            ArkUIDelay_ms(TRANSITION_TIME / 2 / TRANSITION_FADE_STEPS);
         }
+        fadeInStep = 1;
+        return;
     }
-    ArkUIDelay_ms(TRANSITION_TIME / 4);
-    ArkUISendBuffer();
-    for (int j = 0; j < SCREEN_HEIGHT + 1; j += 2)
+
+    // 抖动图案逐级减少保留的像素：3/4 → 1/2 → 1/4 → 全灭，每级只是整屏按页字节与一次
+    for (int level = OLED_PATTERN_3_4; level >= 0; level -= OLED_PATTERN_LEVELS / 4)
     {
-        for (int i = 1; i < SCREEN_WIDTH + 1; i += 2)
-        {
-            ArkUIDrawDot(i, j, 0);
-        }
+        ArkUIFillPattern(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, (uint8_t)level, OLED_PATTERN_AND);
+        ArkUIDelay_ms(TRANSITION_TIME / 4);
+        ArkUISendBuffer();
     }
-    ArkUIDelay_ms(TRANSITION_TIME / 4);
-    ArkUISendBuffer();
-    for (int j = 1; j < SCREEN_HEIGHT + 1; j += 2)
+}
+
+/**
+ * @brief 对比度渐亮的推进，每个 tick 开始(绘制之前)调用一次
+ * @note 第1个tick不改亮度，新页面以最暗发送；之后每个tick升一级，
+ *       对比度命令随该tick的 ArkUISendBuffer 一起发出，不额外占用刷新
+ */
+void ArkUIFadeInStep(void)
+{
+    if (fadeInStep == 0) return;
+    if (fadeInStep > 1)
     {
-        for (int i = 1; i < SCREEN_WIDTH + 1; i += 2)
-        {
-            ArkUIDrawDot(i - 1, j - 1, 0);
-        }
+        ArkUISetContrast((uint8_t)(fadeContrast * (fadeInStep - 1) / TRANSITION_FADE_STEPS));
     }
-    ArkUIDelay_ms(TRANSITION_TIME / 4);
-    ArkUISendBuffer();
+    fadeInStep = (fadeInStep > TRANSITION_FADE_STEPS) ? 0 : (uint8_t)(fadeInStep + 1);
 }
 
 /**
- * @brief 屏幕渐变消失至1/3,阻塞函数
+ * @brief 屏幕渐变消失至1/4,阻塞函数
+ * @note 弹窗要以正常亮度画在虚化的背景上，而对比度作用于整屏，所以虚化用抖动图案：
+ *       分3级只保留3/4、1/2、1/4的像素，整屏一级只需1152次字节运算
  */
 void ArkUIBackgroundBlur()
 {
-    for (int j = 1; j < SCREEN_HEIGHT + 1; j += 2)
+    for (int level = OLED_PATTERN_3_4; level >= OLED_PATTERN_1_4; level -= OLED_PATTERN_LEVELS / 4)
     {
-        for (int i = 0; i < SCREEN_WIDTH + 1; i += 2)
-        {
-            ArkUIDrawDot(i, j, 0);
-        }
+        ArkUIFillPattern(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, (uint8_t)level, OLED_PATTERN_AND);
+        ArkUIDelay_ms(TRANSITION_TIME / 3);
+        ArkUISendBuffer();
     }
-    ArkUIDelay_ms(TRANSITION_TIME / 3);
-    ArkUISendBuffer();
-    for (int j = 1; j < SCREEN_HEIGHT + 1; j += 2)
-    {
-        for (int i = 1; i < SCREEN_WIDTH + 1; i += 2)
-        {
-            ArkUIDrawDot(i, j, 0);
-        }
-    }
-    ArkUIDelay_ms(TRANSITION_TIME / 3);
-    ArkUISendBuffer();
-    for (int j = 0; j < SCREEN_HEIGHT + 1; j += 2)
-    {
-        for (int i = 1; i < SCREEN_WIDTH + 1; i += 2)
-        {
-            ArkUIDrawDot(i, j, 0);
-        }
-    }
-    ArkUIDelay_ms(TRANSITION_TIME / 3);
-    ArkUISendBuffer();
 }
 
 /**
@@ -211,6 +206,7 @@ void ArkUIDrawMsgBox(const char *msg)
     ArkUIDrawRBox(x, y, boxW, boxH, 1, r);        // 只画一个实心圆角矩形（无外框）
 
     ArkUISetDrawColor(OLED_DRAWMODE_XOR);         // 文本用 XOR，保证可读性
+    uint8_t clipped = ArkUIPushClip((int16_t)(x + padX), (int16_t)(y + padY), (uint8_t)contentW, (uint8_t)contentH); // 文本不越出气泡内容区
 
     // 逐行真正绘制文本
     p = msg;
@@ -248,6 +244,7 @@ void ArkUIDrawMsgBox(const char *msg)
         ArkUIDisplayStr((int16_t)(x + padX), ty, lineBuf);
     }
 
+    if (clipped) ArkUIPopClip();
     ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
     ArkUISendBuffer();
 }
@@ -262,14 +259,15 @@ void ArkUIDrawProgressBar(ArkUIItem_t *item)
     static uint16_t width, height;  // 对话框尺寸
     static uint8_t itemHeightOffset = (ITEM_HEIGHT - FONT_HEIGHT) / 2 + 1;  // 文本垂直居中偏移量
     static uint16_t barWidth;  // 进度条实际宽度
+    int32_t percent;  // 进度值(百分数的100倍)
 
     ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);  // 使用正常绘制模式
 
     // Display information and draw box
     height = ITEM_HEIGHT * 2 + 2;  // 固定高度：2个列表项高度+边距
     // 根据标题长度计算宽度
-    if (strlen(item->title) + 1 > 12)
-        width = (strlen(item->title) + 1) * FONT_WIDTH + 7;
+    if (item->titleWidth + FONT_WIDTH > 12 * FONT_WIDTH)
+        width = item->titleWidth + FONT_WIDTH + 7;
     else
         width = 12 * FONT_WIDTH + 7;
     // 确保宽度不小于屏幕宽度的2/3
@@ -285,7 +283,7 @@ void ArkUIDrawProgressBar(ArkUIItem_t *item)
     ArkUIDrawBox(x, y, width, height, 0);// 背景填充
     //显示标题
     ArkUIDisplayStr(x + 3, y + itemHeightOffset, item->title);// 标题文本
-    ArkUIDisplayStr(x + 3 + strlen(item->title) * FONT_WIDTH, y + itemHeightOffset, ":");// 标题后的冒号
+    ArkUIDisplayStr(x + 3 + item->titleWidth, y + itemHeightOffset, ":");// 标题后的冒号
 		float temp_Bar = (float)*item->param;
 		if(temp_Bar < 0){
 			temp_Bar = 0;
@@ -296,16 +294,10 @@ void ArkUIDrawProgressBar(ArkUIItem_t *item)
     //绘制进度条
     ArkUIDrawFrame(x + 3, y + ITEM_HEIGHT + itemHeightOffset, barWidth, FONT_HEIGHT, 1);// 进度条背景框
     ArkUIDrawBox(x + 5, y + ITEM_HEIGHT + itemHeightOffset + 2, temp_Bar/ 100 * (barWidth - 4),FONT_HEIGHT - 4, 1);// 进度条填充
-    //显示进度数值
-		if(temp_Bar < 10 && temp_Bar > 0){
-			ArkUIPrintf(x + width - 5 * FONT_WIDTH - 4, y + ITEM_HEIGHT + itemHeightOffset,"%.2f%%",temp_Bar);
-		}else if(temp_Bar < 100 && temp_Bar >= 10){
-			ArkUIPrintf(x + width - 6 * FONT_WIDTH - 5, y + ITEM_HEIGHT + itemHeightOffset,"%.2f%%",temp_Bar);
-		}else if(temp_Bar == 100){
-			ArkUIPrintf(x + width - 4 * FONT_WIDTH - 4, y + ITEM_HEIGHT + itemHeightOffset,"100%%");
-		}else{
-			ArkUIPrintf(x + width - 2 * FONT_WIDTH - 4, y + ITEM_HEIGHT + itemHeightOffset,"0%%");
-		}
+    //显示进度数值(右对齐，保留两位小数，0%和100%不显示小数)
+    percent = (int32_t)(temp_Bar * 100 + 0.5f);
+    ArkUIDisplayNum(x + width - 4 - FONT_WIDTH, y + ITEM_HEIGHT + itemHeightOffset, percent, 2, (percent % 10000) ? 2 : 0, 0, ARKUI_NUM_RIGHT);
+    ArkUIDisplayStr(x + width - 4 - FONT_WIDTH, y + ITEM_HEIGHT + itemHeightOffset, "%");
 		
     ArkUISendBuffer();
 }
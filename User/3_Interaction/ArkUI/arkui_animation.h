@@ -23,13 +23,28 @@ extern "C" {
 
 /* Exported types ------------------------------------------------------------*/
 
+/**
+ * @brief 页面切换过渡方式
+ */
+typedef enum
+{
+    ARKUI_TRANSITION_DISSOLVE,  // 抖动图案分4次熄灭，每次整帧发送
+    ARKUI_TRANSITION_FADE       // 对比度渐暗，新页面在最暗时换上后逐帧渐亮，只发送对比度命令
+} ArkUITransition_e;
+
 /* Exported variables --------------------------------------------------------*/
 
 /* Exported function declarations --------------------------------------------*/
 
-// 执行页面切换过渡动画
+// 执行页面切换过渡动画(过渡方式为 TRANSITION_STYLE)
 void ArkUITransitionAnim(void);
 
+// 以指定方式执行页面切换过渡动画
+void ArkUITransitionAnimEx(ArkUITransition_e style);
+
+// 对比度渐亮的推进，每个 tick 开始时调用一次
+void ArkUIFadeInStep(void);
+
 // 执行背景模糊效果
 void ArkUIBackgroundBlur(void);
 
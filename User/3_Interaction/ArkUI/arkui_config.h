@@ -28,7 +28,8 @@ extern "C" {
  */
 #define SCREEN_WIDTH            96  // 屏幕宽度(像素)
 #define SCREEN_HEIGHT           96  // 屏幕高度(像素)
-#define FONT_WIDTH              6  // 字体宽度(像素)
+#define ARKUI_FONT              (&OLED_Font6x8)  // 界面文字字体：&OLED_Font6x8 等宽，&OLED_FontP8 比例字体(数值仍用6x8等宽显示)
+#define FONT_WIDTH              6  // 字体宽度(像素)，比例字体为最大字宽
 #define FONT_HEIGHT             8  // 字体高度(像素)
 #define ITEM_HEIGHT             12  // 列表项高度(像素)
 #define CHECK_BOX_OFFSET        2  // 复选框偏移量(像素)
@@ -45,18 +46,51 @@ extern "C" {
 #define INDICATOR_MOVE_TIME     100  // 指示器移动动画时间(ms)
 #define ITEM_MOVE_TIME          100  // 列表项移动动画时间(ms)
 #define TRANSITION_TIME         120  // 页面切换过渡动画时间(ms)
+#define TRANSITION_STYLE        ARKUI_TRANSITION_DISSOLVE  // ArkUITransitionAnim 使用的过渡方式(见 ArkUITransition_e)
+#define TRANSITION_FADE_STEPS   4    // 对比度渐变过渡渐暗/渐亮的级数
 
 /**
  * @brief 屏幕操作调用相关API接口对齐
  */
+#if OLED_USE_DISPLAY_LIST
+/*------------------------------显示列表模式：以下宏只记录绘图命令，ArkUISendBuffer时按条带光栅化并发送------------------------------*/
+#define ArkUIScreenInit()                                      (OLED_Init())    // 初始化屏幕
+#define ArkUIClearBuffer()                                     (OLED_ListBegin())   // 清空显示列表
+#define ArkUISendBuffer()                                      (OLED_ListRender())  // 按条带重放显示列表并整屏发送(列表保留)
+
+#define ArkUIDisplayStr(x, y, str)                             (OLED_ListShowText(x, y, str, ARKUI_FONT))
+#define ArkUIDisplayNum(x, y, value, scale, fra, width, flags) (OLED_ListShowFixedNum(x, y, value, scale, fra, width, flags, OLED_6X8))
+#define ArkUIPrintf(x, y, format, ...)                         (OLED_ListPrintf(x, y, OLED_6X8, format, ##__VA_ARGS__))
+
+#define ArkUIDrawDot(x, y, color)                              (OLED_ListDrawPoint(x, y, color))  // 连续的棋盘格点自动合并为一条命令
+#define ArkUIDrawBox(x, y, width, height, color)               (OLED_ListDrawRectangle(x, y, width, height, OLED_FILLED, color))
+#define ArkUIDrawFrame(x, y, width, height, color)             (OLED_ListDrawRectangle(x, y, width, height, OLED_UNFILLED, color))
+#define ArkUIDrawRFrame(x, y, width, height, color, r)         (OLED_ListDrawRoundRect(x, y, width, height, r, OLED_UNFILLED, color))
+#define ArkUIDrawRBox(x, y, width, height, color, r)           (OLED_ListDrawRoundRect(x, y, width, height, r, OLED_FILLED, color))
+#define ArkUIFillPattern(x, y, width, height, level, op)       (OLED_ListFillPattern(x, y, width, height, level, op))
+
+#define ArkUISetDrawColor(mode)                                (OLED_ListSetDrawMode((OLED_DrawMode)(mode)))
+#define ArkUIDisplayBMP(x, y, w, h, pic)                       (OLED_ListShowImage(x, y, w, h, pic, OLED_IMAGE_OR))
+#define ArkUIDisplayPackedBMP(x, y, w, h, pic)                 (OLED_ListShowImagePacked(x, y, w, h, pic, OLED_IMAGE_OR))
+#define ArkUIDisplaySprite(x, y, w, h, spr)                    (OLED_ListShowSprite(x, y, w, h, spr, OLED_SPRITE_MASK))
+#define ArkUIDisplayScaledBMP(x, y, w, h, pic, dw, dh)         (OLED_ListShowImageScaled(x, y, w, h, pic, dw, dh, OLED_IMAGE_OR))
+
+#define ArkUIPushClip(x, y, width, height)                     (OLED_ListPushClip(x, y, width, height))
+#define ArkUIPopClip()                                         (OLED_ListPopClip())
+
+#undef  ARKUI_LIST_SHIFT_SCROLL
+#define ARKUI_LIST_SHIFT_SCROLL                                0    // 显示列表不保留上一帧，列表滚动只能整帧重画
+#define ArkUIScrollRegion(x, y, width, height, dy)             ((void)0)
+
+#else
 /*------------------------------初始化与清屏，更新------------------------------*/
 #define ArkUIScreenInit()                                      (OLED_Init())    // 初始化屏幕
 #define ArkUIClearBuffer()                                     (OLED_Clear())   // 清空屏幕缓冲区
-#define ArkUISendBuffer()                                      (OLED_Update())  // 更新到屏幕显示
+#define ArkUISendBuffer()                                      (OLED_UpdateDirty())  // 更新到屏幕显示(只发送变化的部分)
 
 /*------------------------------字符串、数值显示------------------------------*/
-#define ArkUIDisplayStr(x, y, str)                             (OLED_ShowString(x, y, str, OLED_6X8)) // 显示字符串
-#define ArkUIDisplayFloat(x, y, dat, num, pointNum)            (OLED_ShowFloatNum(x, y, dat, (num - pointNum), pointNum, OLED_6X8)) // 显示浮点数，num为总位数，pointNum为小数位数
+#define ArkUIDisplayStr(x, y, str)                             (OLED_ShowText(x, y, str, ARKUI_FONT)) // 显示字符串
+#define ArkUIDisplayNum(x, y, value, scale, fra, width, flags) (OLED_ShowFixedNum(x, y, value, scale, fra, width, flags, OLED_6X8)) // 显示定点数value/10^scale，保留fra位小数，数字部分最多width个字符，返回0表示放不下
 #define ArkUIPrintf(x, y, format, ...)                         (OLED_Printf(x, y, OLED_6X8, format, ##__VA_ARGS__))
 
 /*------------------------------点与图形绘制------------------------------*/
@@ -65,14 +99,56 @@ extern "C" {
 #define ArkUIDrawFrame(x, y, width, height, color)             (OLED_DrawRectangle(x, y, width, height, OLED_UNFILLED, color)) // 绘制矩形边框
 #define ArkUIDrawRFrame(x, y, width, height, color, r)         (OLED_DrawRoundRect(x, y, width, height, r, OLED_UNFILLED, color)) // 绘制圆角矩形边框
 #define ArkUIDrawRBox(x, y, width, height, color, r)           (OLED_DrawRoundRect(x, y, width, height, r, OLED_FILLED, color)) // 绘制圆角实心矩形框
+#define ArkUIFillPattern(x, y, width, height, level, op)       (OLED_FillPattern(x, y, width, height, level, op)) // 区域与抖动图案按位运算(AND变暗/OR网纹/XOR翻转)，level为点亮比例(1/64)
 
 /*------------------------------绘制模式 & 位图显示------------------------------*/
 #define ArkUISetDrawColor(mode)                                (OLED_SetDrawMode((OLED_DrawMode)(mode))) //OLED_DRAWMODE_XOR,OLED_DRAWMODE_NORMAL
-#define ArkUIDisplayBMP(x, y, w, h, pic)                       (OLED_ShowImage(x, y, w, h, pic,1))
+#define ArkUIDisplayBMP(x, y, w, h, pic)                       (OLED_ShowImage(x, y, w, h, pic, OLED_IMAGE_OR))
+#define ArkUIDisplayPackedBMP(x, y, w, h, pic)                 (OLED_ShowImagePacked(x, y, w, h, pic, OLED_IMAGE_OR)) // 显示PackBits压缩位图
+#define ArkUIDisplaySprite(x, y, w, h, spr)                    (OLED_ShowSprite(x, y, w, h, spr, OLED_SPRITE_MASK)) // 显示带遮罩的精灵(遮罩外透明)
+#define ArkUIDisplayScaledBMP(x, y, w, h, pic, dw, dh)         (OLED_ShowImageScaled(x, y, w, h, pic, dw, dh, OLED_IMAGE_OR)) // w*h的位图缩放到dw*dh显示(最近邻)
+
+/*------------------------------裁剪区------------------------------*/
+#define ArkUIPushClip(x, y, width, height)                     (OLED_PushClip(x, y, width, height)) // 之后的绘制只作用于该矩形内，返回0表示栈满
+#define ArkUIPopClip()                                         (OLED_PopClip())   // 恢复外层裁剪区
+
+/*------------------------------区域平移------------------------------*/
+#ifndef ARKUI_LIST_SHIFT_SCROLL
+#define ARKUI_LIST_SHIFT_SCROLL                                0    // 1：列表整页滚动时平移上一帧，只绘制新露出的行；0：每帧整帧重画
+#endif
+#define ArkUIScrollRegion(x, y, width, height, dy)             (OLED_ScrollRegion(x, y, width, height, dy)) // 区域内容下移dy行(负数上移)，空出的行清零
+#endif
+
+/*------------------------------文字宽度------------------------------*/
+#define ArkUIMeasureText(str)                                  (OLED_MeasureText(str, ARKUI_FONT))  // 字符串按ARKUI_FONT显示的宽度(像素)
+
+/*------------------------------数值显示方式(ArkUIDisplayNum的flags)------------------------------*/
+#define ARKUI_NUM_RIGHT                                        (OLED_NUM_RIGHT)  // 右对齐，x为数字右端
+#define ARKUI_NUM_FIT                                          (OLED_NUM_FIT)    // 放不下时减少小数位
 
 /*------------------------------反色显示------------------------------*/
 #define ArkUIModifyColor(x)                                     (OLED_InvertDisplay(x))    // 1开启反色,0关闭反色
 
+/*------------------------------对比度------------------------------*/
+#define ArkUISetContrast(x)                                    (OLED_SetContrast(x))      // 随下一次ArkUISendBuffer发送
+#define ArkUIGetContrast()                                     (OLED_GetContrast())
+#define ArkUISendCommands()                                    (OLED_FlushCommands())     // 立即发送对比度等命令(不发送显存数据)
+
+/*------------------------------硬件滚动------------------------------*/
+#if OLED_USE_HW_SCROLL
+#define ArkUIScrollLines(dy)                                   (OLED_ScrollLines(dy))     // 屏幕内容整体上移dy行(只改显示起始行)，随下一次ArkUISendBuffer生效
+#else
+#define ArkUIScrollLines(dy)                                   ((void)(dy))               // 未启用硬件滚动：空操作
+#endif
+
+/*------------------------------列表坐标取整------------------------------*/
+#ifndef ARKUI_LIST_FLOOR_POS
+#define ARKUI_LIST_FLOOR_POS                                   (ARKUI_LIST_SHIFT_SCROLL || OLED_USE_HW_SCROLL) // 1：item坐标向下取整，整页滚动时各行移动量一致；0：向零取整(原来的做法)
+#endif
+
+/*------------------------------显存写入计数------------------------------*/
+#define ArkUIDrawStamp()                                       (OLED_GetDrawStamp())      // 显存每被绘图函数改写一次就增加，用来判断上一帧画完后显存是否被改过
+
 /** 
  * @brief 延时函数相关API接口对齐
  */ 
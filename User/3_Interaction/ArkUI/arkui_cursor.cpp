@@ -38,6 +38,7 @@ void Class_ArkUI_Cursor::Init()
     Target_X = Target_Y = Target_W = Target_H = 0;
     T_ms = 0;
     Dur_ms = 1;
+    Drawn = 0;
 }
 
 /**
@@ -170,6 +171,7 @@ void Class_ArkUI_Cursor::Update(uint16_t __dt_ms)
  */
 void Class_ArkUI_Cursor::Draw_Cursor()
 {
+    Drawn = 0;
     if (!Visible) return;
 
     int16_t x = (int16_t)(Now_X + 0.5f);
@@ -182,6 +184,24 @@ void Class_ArkUI_Cursor::Draw_Cursor()
     ArkUISetDrawColor(OLED_DRAWMODE_XOR);
     ArkUIDrawRBox(x, y, w, h, 1, Radius);
     ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
+
+    Drawn_X = x; Drawn_Y = y; Drawn_W = w; Drawn_H = h;
+    Drawn_Radius = Radius;
+    Drawn = 1;
+}
+
+/**
+ * @brief 从显存中擦掉上一次画出的光标(在原位置再异或一次)
+ * @note 只在显存仍是上一帧内容时使用，例如列表滚动时平移上一帧之前
+ */
+void Class_ArkUI_Cursor::Erase_Cursor()
+{
+    if (!Drawn) return;
+
+    ArkUISetDrawColor(OLED_DRAWMODE_XOR);
+    ArkUIDrawRBox(Drawn_X, Drawn_Y, Drawn_W, Drawn_H, 1, Drawn_Radius);
+    ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
+    Drawn = 0;
 }
 
 /************************ COPYRIGHT(C) 2026 WANG FANGZHUO **************************/
@@ -59,6 +59,8 @@ public:
 
     void Draw_Cursor();
 
+    void Erase_Cursor();
+
 protected:
     // 当前矩形（浮点用于平滑）
     float Now_X = 0;
@@ -90,6 +92,14 @@ protected:
     //对象的标识,Object = (pageId << 16) | (index << 8) | ...
     uint32_t Object = 0xFFFFFFFFu;
 
+    // 上一次实际画出的矩形(异或绘制，原样再画一次即可擦掉)
+    int16_t Drawn_X = 0;
+    int16_t Drawn_Y = 0;
+    int16_t Drawn_W = 0;
+    int16_t Drawn_H = 0;
+    uint8_t Drawn_Radius = 1;
+    uint8_t Drawn = 0;//显存中是否留有上一次画出的光标
+
     // 工具函数
     inline float Lerp(float a, float b, float t);
     inline float Clamp01(float t);
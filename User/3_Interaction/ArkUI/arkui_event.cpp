@@ -41,8 +41,8 @@ void ArkUIEventChangeUint(ArkUIItem_t *item)
 
     // Display information and draw box
     height = ITEM_HEIGHT * 4 + 2;
-    if (strlen(item->title) + 1 > 12)
-        width = (strlen(item->title) + 1) * FONT_WIDTH + 7;
+    if (item->titleWidth + FONT_WIDTH > 12 * FONT_WIDTH)
+        width = item->titleWidth + FONT_WIDTH + 7;
     else
         width = 12 * FONT_WIDTH + 7;
     if (width < 2 * SCREEN_WIDTH / 3)
@@ -53,7 +53,7 @@ void ArkUIEventChangeUint(ArkUIItem_t *item)
 	ArkUIDrawRBox(x - 1,y - 1,width + 2,height + 2,0,8);
 	ArkUIDrawRFrame(x - 1,y - 1,width + 2, height + 2,1,8);
     ArkUIDisplayStr(x + 3, y + itemHeightOffset, item->title);
-    ArkUIDisplayStr(x + 3 + strlen(item->title) * FONT_WIDTH, y + itemHeightOffset, ":");
+    ArkUIDisplayStr(x + 3 + item->titleWidth, y + itemHeightOffset, ":");
     ArkUIDisplayStr(x + 3, y + 2 * ITEM_HEIGHT + itemHeightOffset, "Step:");
     ArkUIDisplayStr(x + 3, y + 3 * ITEM_HEIGHT + itemHeightOffset, "Save");
     ArkUIDisplayStr(x + width - 6 * FONT_WIDTH - 4, y + 3 * ITEM_HEIGHT + itemHeightOffset, "Return");
@@ -61,7 +61,7 @@ void ArkUIEventChangeUint(ArkUIItem_t *item)
     if (changeVal)
     {
         ArkUISetDrawColor(OLED_DRAWMODE_XOR);
-        ArkUIDrawRBox(x + 1, y + 1, (strlen(item->title) + 1) * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
+        ArkUIDrawRBox(x + 1, y + 1, item->titleWidth + FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
         ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
         if (opnUp)
             *item->param += step;
@@ -124,7 +124,7 @@ void ArkUIEventChangeUint(ArkUIItem_t *item)
 
     // Draw indicator
     if (index == 1)
-        ArkUIDrawRFrame(x + 1, y + 1, (strlen(item->title) + 1) * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
+        ArkUIDrawRFrame(x + 1, y + 1, item->titleWidth + FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
     else if (index == 2)
         ArkUIDrawRFrame(x + 1, y + 1 + 2 * ITEM_HEIGHT, 5 * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
     else if (index == 3)
@@ -193,8 +193,8 @@ void ArkUIEventChangeUint_Cursor(ArkUIItem_t *item)
 
     // --------- 弹窗布局 ---------
     height = ITEM_HEIGHT * 4 + 2;
-    if (strlen(item->title) + 1 > 12)
-        width = (strlen(item->title) + 1) * FONT_WIDTH + 7;
+    if (item->titleWidth + FONT_WIDTH > 12 * FONT_WIDTH)
+        width = item->titleWidth + FONT_WIDTH + 7;
     else
         width = 12 * FONT_WIDTH + 7;
 
@@ -210,7 +210,7 @@ void ArkUIEventChangeUint_Cursor(ArkUIItem_t *item)
 
     // 文本
     ArkUIDisplayStr(x + 3, y + itemHeightOffset, item->title);
-    ArkUIDisplayStr(x + 3 + strlen(item->title) * FONT_WIDTH, y + itemHeightOffset, ":");
+    ArkUIDisplayStr(x + 3 + item->titleWidth, y + itemHeightOffset, ":");
     ArkUIDisplayStr(x + 3, y + 2 * ITEM_HEIGHT + itemHeightOffset, "Step:");
     ArkUIDisplayStr(x + 3, y + 3 * ITEM_HEIGHT + itemHeightOffset, "Save");
     ArkUIDisplayStr(x + width - 6 * FONT_WIDTH - 4, y + 3 * ITEM_HEIGHT + itemHeightOffset, "Return");
@@ -267,7 +267,7 @@ void ArkUIEventChangeUint_Cursor(ArkUIItem_t *item)
     {
         targetX = (float)(x + 1);
         targetY = (float)(y + 1);
-        targetW = (float)((strlen(item->title) + 1) * FONT_WIDTH + 5);
+        targetW = (float)(item->titleWidth + FONT_WIDTH + 5);
     }
     else if (index == 2)
     {
@@ -426,8 +426,8 @@ void ArkUIEventChangeInt(ArkUIItem_t *item)
 
     // Display information and draw box
     height = ITEM_HEIGHT * 4 + 2;
-    if (strlen(item->title) + 1 > 12)
-        width = (strlen(item->title) + 1) * FONT_WIDTH + 7;
+    if (item->titleWidth + FONT_WIDTH > 12 * FONT_WIDTH)
+        width = item->titleWidth + FONT_WIDTH + 7;
     else
         width = 12 * FONT_WIDTH + 7;
     if (width < 2 * SCREEN_WIDTH / 3)
@@ -438,7 +438,7 @@ void ArkUIEventChangeInt(ArkUIItem_t *item)
 	ArkUIDrawRBox(x - 1,y - 1,width + 2,height + 2,0,8);
 	ArkUIDrawRFrame(x - 1,y - 1,width + 2, height + 2,1,8);
     ArkUIDisplayStr(x + 3, y + itemHeightOffset, item->title);
-    ArkUIDisplayStr(x + 3 + strlen(item->title) * FONT_WIDTH, y + itemHeightOffset, ":");
+    ArkUIDisplayStr(x + 3 + item->titleWidth, y + itemHeightOffset, ":");
     ArkUIDisplayStr(x + 3, y + 2 * ITEM_HEIGHT + itemHeightOffset, "Step:");
     ArkUIDisplayStr(x + 3, y + 3 * ITEM_HEIGHT + itemHeightOffset, "Save");
     ArkUIDisplayStr(x + width - 6 * FONT_WIDTH - 4, y + 3 * ITEM_HEIGHT + itemHeightOffset, "Return");
@@ -447,7 +447,7 @@ void ArkUIEventChangeInt(ArkUIItem_t *item)
     if (changeVal)
     {
         ArkUISetDrawColor(OLED_DRAWMODE_XOR);
-        ArkUIDrawRBox(x + 1, y + 1, (strlen(item->title) + 1) * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
+        ArkUIDrawRBox(x + 1, y + 1, item->titleWidth + FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
         ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
         if (opnUp)
             *item->param += step;
@@ -505,7 +505,7 @@ void ArkUIEventChangeInt(ArkUIItem_t *item)
 
     // Draw indicator
     if (index == 1)
-        ArkUIDrawRFrame(x + 1, y + 1, (strlen(item->title) + 1) * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
+        ArkUIDrawRFrame(x + 1, y + 1, item->titleWidth + FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
     else if (index == 2)
         ArkUIDrawRFrame(x + 1, y + 1 + 2 * ITEM_HEIGHT, 5 * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
     else if (index == 3)
@@ -581,8 +581,8 @@ void ArkUIEventChangeFloat(ArkUIItem_t *item)
     // 计算对话框高度，固定为 4 个列表项高度加 2 像素边距
     height = ITEM_HEIGHT * 4 + 2;
     // 根据标题长度计算对话框宽度，如果标题较长则使用标题长度计算，否则使用默认值 12
-    if (strlen(item->title) + 1 > 12)
-        width = (strlen(item->title) + 1) * FONT_WIDTH + 7;
+    if (item->titleWidth + FONT_WIDTH > 12 * FONT_WIDTH)
+        width = item->titleWidth + FONT_WIDTH + 7;
     else
         width = 12 * FONT_WIDTH + 7;
     // 确保对话框宽度不小于屏幕宽度的 2/3
@@ -599,7 +599,7 @@ void ArkUIEventChangeFloat(ArkUIItem_t *item)
     // 显示对话框标题
     ArkUIDisplayStr(x + 3, y + itemHeightOffset, item->title);
     // 显示对话框标题后的冒号
-    ArkUIDisplayStr(x + 3 + strlen(item->title) * FONT_WIDTH, y + itemHeightOffset, ":");
+    ArkUIDisplayStr(x + 3 + item->titleWidth, y + itemHeightOffset, ":");
     // 显示步进值提示文本
     ArkUIDisplayStr(x + 3, y + 2 * ITEM_HEIGHT + itemHeightOffset, "Step:");
     // 显示保存提示文本
@@ -614,7 +614,7 @@ void ArkUIEventChangeFloat(ArkUIItem_t *item)
         // 设置绘制模式为异或模式，高亮显示当前修改区域
         ArkUISetDrawColor(OLED_DRAWMODE_XOR);
         // 绘制高亮区域
-        ArkUIDrawRBox(x + 1, y + 1, (strlen(item->title) + 1) * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
+        ArkUIDrawRBox(x + 1, y + 1, item->titleWidth + FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
         // 恢复绘制模式为正常模式
         ArkUISetDrawColor(OLED_DRAWMODE_NORMAL);
         // 如果向上按键被按下，增加参数值
@@ -697,7 +697,7 @@ void ArkUIEventChangeFloat(ArkUIItem_t *item)
         ArkUIDisplayStr(x + 3 + 6 * FONT_WIDTH, y + 2 * ITEM_HEIGHT + itemHeightOffset, "1");
     // Draw indicator
     if (index == 1)
-        ArkUIDrawRFrame(x + 1, y + 1, (strlen(item->title) + 1) * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
+        ArkUIDrawRFrame(x + 1, y + 1, item->titleWidth + FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
     else if (index == 2)
         ArkUIDrawRFrame(x + 1, y + 1 + 2 * ITEM_HEIGHT, 5 * FONT_WIDTH + 5, ITEM_HEIGHT, 1, 4);
     else if (index == 3)
@@ -800,6 +800,7 @@ void IconPageEvent(ArkUIPage_t *page)
     /* ================ 0) 配置常量 （统一调参） ================ */
     const int ICON_W          = 32;   // 图标宽 (px)
     const int ICON_H          = 32;   // 图标高 (px)
+    const int ICON_ZOOM       = 8;    // 居中图标放大的像素（32 -> 40，离中心一个槽位时恢复原尺寸）
     const int ICON_SPACING    = 10;   // 图标间距（中心到中心额外距离）
     const int SLOT_DX         = ICON_W + ICON_SPACING; // 槽位中心间距
     const int ICON_CENTER_Y   = (SCREEN_HEIGHT * 2) / 5; // 图标群垂直中心（上 ~2/3）
@@ -900,8 +901,8 @@ void IconPageEvent(ArkUIPage_t *page)
         // 5) entry 开始：Cursor 跨页面插值（item->icon / event->icon）
         {
             const uint16_t dt_ms = (uint16_t)(g_arkui_tick_ms ? g_arkui_tick_ms : 1);
-            const float targetW = (float)(ICON_W + 3);
-            const float targetH = (float)(ICON_H + 3);
+            const float targetW = (float)(ICON_W + ICON_ZOOM + 3);
+            const float targetH = (float)(ICON_H + ICON_ZOOM + 3);
             const float targetX = (float)(centerX) - targetW * 0.5f;
             const float targetY = (float)(ICON_CENTER_Y) - targetH * 0.5f;
 
@@ -990,8 +991,8 @@ void IconPageEvent(ArkUIPage_t *page)
 
             // 这里不能直接用后面 section 10 的 targetX/targetY/dt_ms（作用域不在这里），所以本地重算一次。
             const uint16_t dt_ms_now = (uint16_t)(g_arkui_tick_ms ? g_arkui_tick_ms : 1);
-            const float targetW_now = (float)(ICON_W + 3);
-            const float targetH_now = (float)(ICON_H + 3);
+            const float targetW_now = (float)(ICON_W + ICON_ZOOM + 3);
+            const float targetH_now = (float)(ICON_H + ICON_ZOOM + 3);
             const float targetX_now = (float)(centerX) - targetW_now * 0.5f;
             const float targetY_now = (float)(ICON_CENTER_Y) - targetH_now * 0.5f;
 
@@ -1109,26 +1110,31 @@ void IconPageEvent(ArkUIPage_t *page)
         if (posX < - (float)ICON_W * 2 || posX > (float)SCREEN_WIDTH + (float)ICON_W * 2) {
             continue;
         }
+        // 离中心越近图标越大：翻页/进场时滑向中心的图标逐渐放大，离开的逐渐缩回
+        float d = fabsf(posX - (float)centerX);
+        int zoom = (d < (float)SLOT_DX) ? (int)((float)ICON_ZOOM * (1.0f - d / (float)SLOT_DX) + 0.5f) : 0;
+        int iconW = ICON_W + zoom;
+        int iconH = ICON_H + zoom;
         // 计算绘制左上角坐标
-        int16_t drawX = (int16_t)(posX - (ICON_W / 2.0f) + 0.5f);
-        int16_t drawY = (int16_t)(ICON_CENTER_Y - (ICON_H / 2.0f) + 0.5f);
-        // 绘制图标或占位框
+        int16_t drawX = (int16_t)(posX - (iconW / 2.0f) + 0.5f);
+        int16_t drawY = (int16_t)(ICON_CENTER_Y - (iconH / 2.0f) + 0.5f);
+        // 绘制图标或占位框（原尺寸走普通位图，放大时由同一张取模缩放，Flash里不存多份尺寸）
         ArkUIItem_t *it = ArkUI_FindItemById(page, i);
         if (it != NULL && it->icon) {
-            ArkUIDisplayBMP(drawX, drawY, ICON_W, ICON_H, it->icon);
+            if (zoom == 0) ArkUIDisplayBMP(drawX, drawY, ICON_W, ICON_H, it->icon);
+            else           ArkUIDisplayScaledBMP(drawX, drawY, ICON_W, ICON_H, it->icon, iconW, iconH);
         } else {
-            ArkUIDrawRFrame(drawX, drawY, ICON_W, ICON_H, 1, 4);
+            ArkUIDrawRFrame(drawX, drawY, iconW, iconH, 1, 4);
         }
         // 记录最接近 center 的项为视觉中心（视觉上处于正中）
-        float d = fabsf(posX - (float)centerX);
         if (d < bestDist) { bestDist = d; visualCenterId = i; }
     }
 
     /* ================ 10) 光标（Cursor库）：跨页面插值 + 吸附（还原手感） ================ */
     // 目标矩形（居中高亮中间图标）
     const uint16_t dt_ms = (uint16_t)(g_arkui_tick_ms ? g_arkui_tick_ms : 1);
-    const float targetW = (float)(ICON_W + 3);
-    const float targetH = (float)(ICON_H + 3);
+    const float targetW = (float)(ICON_W + ICON_ZOOM + 3);
+    const float targetH = (float)(ICON_H + ICON_ZOOM + 3);
     const float targetX = (float)(centerX) - targetW * 0.5f;
     const float targetY = (float)(ICON_CENTER_Y) - targetH * 0.5f;
 
@@ -1198,7 +1204,7 @@ void IconPageEvent(ArkUIPage_t *page)
                     int OFF = (SCREEN_HEIGHT - TITLE_Y) + FONT_HEIGHT + TITLE_EXTRA_PAD;
                     float startY = (float)TITLE_Y + (float)OFF;
                     float curY = startY + ((float)TITLE_Y - startY) * t_title;
-                    int textW = (int)(strlen(itn->title) * FONT_WIDTH);
+                    int textW = (int)itn->titleWidth;
                     int tx = (int)((float)centerX - (float)textW / 2.0f + 0.5f);
                     ArkUIDisplayStr(tx, (int)(curY + 0.5f), itn->title);
                 }
@@ -1211,7 +1217,7 @@ void IconPageEvent(ArkUIPage_t *page)
                 if (ito != NULL && ito->title != NULL) {
                     int OFF = (SCREEN_HEIGHT - TITLE_Y) + FONT_HEIGHT + TITLE_EXTRA_PAD;
                     float oldY = (float)TITLE_Y + (float)OFF * t_title; // 0 -> OFF
-                    int textW = (int)(strlen(ito->title) * FONT_WIDTH);
+                    int textW = (int)ito->titleWidth;
                     int tx = (int)((float)centerX - (float)textW / 2.0f + 0.5f);
                     ArkUIDisplayStr(tx, (int)(oldY + 0.5f), ito->title);
                 }
@@ -1222,7 +1228,7 @@ void IconPageEvent(ArkUIPage_t *page)
                 if (itn != NULL && itn->title != NULL) {
                     int OFF = (SCREEN_HEIGHT - TITLE_Y) + FONT_HEIGHT + TITLE_EXTRA_PAD;
                     float newY = (float)TITLE_Y + (float)OFF * (1.0f - t_title); // OFF -> 0
-                    int textW = (int)(strlen(itn->title) * FONT_WIDTH);
+                    int textW = (int)itn->titleWidth;
                     int tx = (int)((float)centerX - (float)textW / 2.0f + 0.5f);
                     ArkUIDisplayStr(tx, (int)(newY + 0.5f), itn->title);
                 }
@@ -1249,7 +1255,7 @@ void IconPageEvent(ArkUIPage_t *page)
         if (titleCurrent >= 0 && titleCurrent < totalItems) {
             ArkUIItem_t *itc = ArkUI_FindItemById(page, titleCurrent);
             if (itc != NULL && itc->title != NULL) {
-                int textW = (int)(strlen(itc->title) * FONT_WIDTH);
+                int textW = (int)itc->titleWidth;
                 int tx = centerX - textW / 2;
                 ArkUIDisplayStr(tx, TITLE_Y, itc->title);
             }
@@ -1335,7 +1341,7 @@ static int ArkUI_ClampInt(int v, int lo, int hi)
 }
 
 typedef enum {
-    BR_NORMAL = 0,
+    BR_NORMAL = 0, // o   (顺序与 sprite_Brick 一致)
     BR_GOLD,     // $
     BR_WIDE,     // W
     BR_SLOW,     // S
@@ -1344,19 +1350,6 @@ typedef enum {
     BR_SHIELD    // D
 } BrickType_t;
 
-static char CatchBrick_TypeChar(uint8_t t)
-{
-    switch ((BrickType_t)t) {
-        default:        return 'o';
-        case BR_GOLD:   return '$';
-        case BR_BOMB:   return '!';
-        case BR_WIDE:   return 'W';
-        case BR_SLOW:   return 'S';
-        case BR_LIFE:   return '+';
-        case BR_SHIELD: return 'D';
-    }
-}
-
 void ArkUIEventCatchBrick(ArkUIItem_t *item)
 {
     (void)item;
@@ -1657,7 +1650,7 @@ void ArkUIEventCatchBrick(ArkUIItem_t *item)
     if (feverTick  > 0) ArkUIDisplayStr(32, 10, "F");
     if (!paused && !gameOver && combo >= 5) ArkUIPrintf(50, 10, "C:%d", combo);
 
-    /* 砖块（ASCII 单字符） */
+    /* 砖块（带描边的字符精灵：落到 HUD/边框上也看得清） */
     for (int i = 0; i < 10; ++i) {
         if (!bricks[i].alive) continue;
 
@@ -1669,8 +1662,7 @@ void ArkUIEventCatchBrick(ArkUIItem_t *item)
         int cx = (bricks[i].x / FONT_WIDTH) * FONT_WIDTH;
         int cy = by;
 
-        char ch = CatchBrick_TypeChar(bricks[i].type);
-        ArkUIPrintf(cx, cy, "%c", ch);
+        ArkUIDisplaySprite(cx, cy, BRICK_W, BRICK_H, sprite_Brick[bricks[i].type]);
     }
 
     /* Paddle：一排 '='（ASCII 风格） */
@@ -55,6 +55,16 @@ extern "C" void TIM2_IRQHandler(void){
     }
 }
 
+#if OLED_USE_HW_SPI_DMA
+/**
+ * @brief DMA1通道5中断函数(SPI2_TX),OLED异步刷新的一段数据发送完成
+ *
+ */
+extern "C" void DMA1_Channel5_IRQHandler(void){
+    OLED_DMA_IRQHandler();
+}
+#endif
+
 /**
  * @brief 初始化任务
  *